@@ -27,8 +27,14 @@
 
 namespace ae {
 class Aether;
+#if AE_TASK_TIMER_WHEEL
+using TaskScheduler = ManualTaskScheduler<
+    TaskManagerConf<AE_TASK_MAX_COUNT, AE_TASK_MAX_SIZE, AE_TASK_ALIGN,
+                    TimerWheelDelayedQueue<>>>;
+#else
 using TaskScheduler = ManualTaskScheduler<
     TaskManagerConf<AE_TASK_MAX_COUNT, AE_TASK_MAX_SIZE, AE_TASK_ALIGN>>;
+#endif
 
 struct AeCtxTable {
   Aether& (*aether_getter)(void* obj);
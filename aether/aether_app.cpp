@@ -365,6 +365,8 @@ AetherApp::~AetherApp() {
   // reset telemetry before delete all objects
   TELE_SINK::Instance().SetTrap(nullptr);
   aether_.Reset();
+  // do not leave the deferred cycles until the thread exit
+  CycleCollector::Collect();
 }
 
 }  // namespace ae
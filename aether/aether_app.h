@@ -27,6 +27,7 @@
 #include "aether/obj/domain.h"
 #include "aether/ptr/ptr.h"
 #include "aether/ptr/rc_ptr.h"
+#include "aether/ptr/cycle_collector.h"
 
 #include "aether/actions/action.h"  // IWYU pragma: keep
 #include "aether/events/events.h"   // IWYU pragma: keep
@@ -171,7 +172,14 @@ class AetherApp {
    * \brief Run one iteration of application update loop.
    */
   TimePoint Update(TimePoint current_time) {
-    return aether_->task_scheduler->Update(current_time);
+    auto next_time = aether_->task_scheduler->Update(current_time);
+    // collect the dropped reference cycles by bounded batches
+    if (CycleCollector::IsDeferred() &&
+        !CycleCollector::Collect(AE_PTR_CYCLE_COLLECTOR_BUDGET)) {
+      // more roots left, run the next update without waiting
+      return current_time;
+    }
+    return next_time;
   }
 
   /**
@@ -45,6 +45,7 @@
 
 #include "aether/domain_storage/domain_storage_factory.h"
 #include "aether/domain_storage/file_system_std_storage.h"
+#include "aether/domain_storage/mmap_domain_storage.h"
 #include "aether/domain_storage/ram_domain_storage.h"
 #include "aether/domain_storage/registrar_domain_storage.h"
 #include "aether/domain_storage/spifs_domain_storage.h"
@@ -17,6 +17,11 @@
 #ifndef AETHER_API_PROTOCOL_API_CLASS_IMPL_H_
 #define AETHER_API_PROTOCOL_API_CLASS_IMPL_H_
 
+#include <array>
+#include <limits>
+#include <cstddef>
+#include <cstdint>
+
 #include "aether-miscpp/reflect/reflect.h"
 #include "aether/api_protocol/api_class.h"
 #include "aether/api_protocol/api_pack_parser.h"
@@ -39,16 +44,16 @@ struct IsPromiseResult<PromiseResult<T>> : std::true_type {};
 
 /**
  * \brief Use as helper to continue parsing with subapi.
+ * Parses the sub api data in place, so it's valid only during the method call.
  */
 template <typename Api>
 struct SubContextImpl {
   SubContextImpl(ProtocolContext& protocol_context,
-                 std::vector<std::uint8_t>&& data)
-      : sub_data{std::move(data)}, parser{protocol_context, sub_data} {}
+                 Span<std::uint8_t const> data)
+      : parser{protocol_context, data} {}
 
   void Parse(Api& api) { parser.Parse(api); }
 
-  std::vector<std::uint8_t> sub_data;
   ApiParser parser;
 };
 
@@ -136,11 +141,11 @@ struct MethodInvoke<message_id, TApi, method_ptr> {
   static void Invoke(TApi* obj, Message&& message, ApiParser& parser) {
     std::apply(
         [&](auto&&... args) {
-          auto data = parser.Extract<std::vector<std::uint8_t>>();
+          // sub api data is parsed in place of the parent's data
+          auto data = parser.ExtractSpan();
 
-          (obj->*method_ptr)(
-              SubContextImpl<TSubApi>{parser.Context(), std::move(data)},
-              std::forward<Args>(args)...);
+          (obj->*method_ptr)(SubContextImpl<TSubApi>{parser.Context(), data},
+                             std::forward<Args>(args)...);
         },
         std::move(message).fields);
   }
@@ -167,6 +172,7 @@ struct ExtApi;
 template <typename T, typename M, M T::* ptr>
 struct ExtApi<ptr> {
   using type = T;
+  using ext_type = M;
   using Field = reflect::reflect_internal::FieldPtr<T, ptr>;
 };
 
@@ -187,47 +193,90 @@ template <typename T>
 struct HasApiMethods<T, std::void_t<decltype(T::ApiMethods())>>
     : std::true_type {};
 
+static constexpr std::size_t kMessageIdCount =
+    std::size_t{std::numeric_limits<MessageId>::max()} + 1;
+
+template <typename Api>
+using LoadFunc = void (*)(Api* api, MessageId message_id, ApiParser& parser);
+
+using DispatchIndices = std::array<std::uint8_t, kMessageIdCount>;
+
 template <typename Api, typename T>
 struct LoadSelector;
 
-template <typename ImplList, typename Api, std::size_t... Is>
-static bool ApiLoadFactory(Api* api, MessageId message_id, ApiParser& parser,
-                           std::index_sequence<Is...>) {
-  return (LoadSelector<Api, TypeAt_t<Is, ImplList>>::Load(api, message_id,
-                                                          parser) ||
-          ...);
-}
+/**
+ * \brief Compile time message dispatch table generated from Api::ApiMethods.
+ * Each message id selects the load function by a byte index, 0 is for unknown
+ * message id, so dispatch is one indirect call for any count of methods.
+ * Byte indices keep the table 256 bytes instead of 256 pointers per api.
+ */
+template <typename Api, typename TImplList = decltype(Api::ApiMethods())>
+struct ApiDispatchTable;
+
+template <typename Api, typename... TRegs>
+struct ApiDispatchTable<Api, ImplList<TRegs...>> {
+  static_assert(sizeof...(TRegs) < std::numeric_limits<std::uint8_t>::max(),
+                "Too many registered methods");
+
+  static constexpr std::array<LoadFunc<Api>, sizeof...(TRegs) + 1> kLoads{
+      nullptr, &LoadSelector<Api, TRegs>::Load...};
+
+  static constexpr DispatchIndices kIndices = [] {
+    auto indices = DispatchIndices{};
+    std::uint8_t slot = 0;
+    // the first registration of message id wins
+    (LoadSelector<Api, TRegs>::Fill(indices, ++slot), ...);
+    return indices;
+  }();
+
+  static constexpr LoadFunc<Api> Get(MessageId message_id) {
+    return kLoads[kIndices[message_id]];
+  }
+};
 
 template <typename Api, MessageId Id, auto method>
 struct LoadSelector<Api, RegMethod<Id, method>> {
-  static bool Load(Api* api, MessageId message_id, ApiParser& parser) {
-    if (Id != message_id) {
-      return false;
+  static constexpr void Fill(DispatchIndices& indices, std::uint8_t slot) {
+    if (indices[Id] == 0) {
+      indices[Id] = slot;
     }
+  }
+
+  static void Load(Api* api, MessageId /* message_id */, ApiParser& parser) {
     using Method = typename RegMethod<Id, method>::Method;
     auto message = parser.Extract<typename Method::Message>();
     Method::Invoke(api, std::move(message), parser);
-    return true;
   }
 };
 
 template <typename Api, auto ptr>
 struct LoadSelector<Api, ExtApi<ptr>> {
-  static bool Load(Api* api, MessageId message_id, ApiParser& parser) {
+  using ExtTable = ApiDispatchTable<typename ExtApi<ptr>::ext_type>;
+
+  static constexpr void Fill(DispatchIndices& indices, std::uint8_t slot) {
+    for (std::size_t i = 0; i < indices.size(); ++i) {
+      if ((indices[i] == 0) && (ExtTable::kIndices[i] != 0)) {
+        indices[i] = slot;
+      }
+    }
+  }
+
+  static void Load(Api* api, MessageId message_id, ApiParser& parser) {
     using Field = typename ExtApi<ptr>::Field;
     auto&& ext_api = Field::get(*api);
-    return LoadFactoryImpl(&ext_api, message_id, parser);
+    ExtTable::Get(message_id)(&ext_api, message_id, parser);
   }
 };
 
 template <typename Api>
 static bool LoadFactoryImpl(Api* api, MessageId message_id, ApiParser& parser) {
   static_assert(HasApiMethods<Api>::value, "Api should provide ApiMethods");
-  using List = decltype(Api::ApiMethods());
-  constexpr auto list_size = TypeListSize_v<typename List::Impls>;
-
-  return ApiLoadFactory<typename List::Impls>(
-      api, message_id, parser, std::make_index_sequence<list_size>());
+  auto load = ApiDispatchTable<Api>::Get(message_id);
+  if (load == nullptr) {
+    return false;
+  }
+  load(api, message_id, parser);
+  return true;
 }
 
 /**
@@ -22,36 +22,11 @@
 
 #include "aether/memory.h"
 #include "aether/common.h"
+#include "aether/types/data_buffer_pool.h"
 #include "aether/api_protocol/packet_builder.h"
 #include "aether/api_protocol/api_pack_parser.h"
 
 namespace ae {
-/**
- * \brief Stack of packed messages to generate one packet
- */
-class PacketStack {
- public:
-  PacketStack() = default;
-
-  AE_CLASS_MOVE_ONLY(PacketStack)
-
-  template <typename TApi, typename TMessage>
-  void Push(TApi&& api, TMessage&& message) & {
-    packets_.emplace_back(make_unique<PackMessage>(
-        std::forward<TApi>(api), std::forward<TMessage>(message)));
-  }
-
-  void Pack(ApiPacker& packer) && {
-    for (auto& packet : packets_) {
-      std::move(*packet).Pack(packer);
-    }
-    packets_.clear();
-  }
-
- private:
-  std::vector<std::unique_ptr<IPackMessage>> packets_;
-};
-
 /**
  * \brief Used as a child data for sub api packet.
  * Provide it's own specialization for operator<< to message_ostream.
@@ -66,10 +41,10 @@ class ChildPacketStack {
 
   friend message_ostream& operator<<(
       message_ostream& os, ChildPacketStack const& child_packet_stack) {
-    auto data = std::vector<std::uint8_t>{};
-    auto packer = ApiPacker{os.ob_.packer.Context(), data};
-    std::move(*child_packet_stack.packet_stack_).Pack(packer);
-    os << data;
+    // packed directly into the parent's buffer
+    os.ob_.packer.PackSized([&](ApiPacker& packer) {
+      std::move(*child_packet_stack.packet_stack_).Pack(packer);
+    });
     return os;
   }
 
@@ -113,7 +88,7 @@ class ApiContext {
   }
 
   [[nodiscard]] std::vector<std::uint8_t> Pack() && {
-    auto data = std::vector<std::uint8_t>{};
+    auto data = DataBufferPool::Acquire(0);
 
     ApiPacker packer{api_->protocol_context(), data};
 
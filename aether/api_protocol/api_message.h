@@ -25,6 +25,7 @@
 
 #include "aether/mstream.h"
 #include "aether/mstream_buffers.h"
+#include "aether/types/span.h"
 
 namespace ae {
 
@@ -41,9 +42,9 @@ struct MessageBufferWriter : VectorWriter<PackedSize> {
 
   ApiPacker& packer;
 };
-struct MessageBufferReader : VectorReader<PackedSize> {
-  MessageBufferReader(std::vector<uint8_t> const& data, ApiParser& p)
-      : VectorReader(data), parser{p} {}
+struct MessageBufferReader : SpanReader<PackedSize> {
+  MessageBufferReader(Span<std::uint8_t const> data, ApiParser& p)
+      : SpanReader(data), parser{p} {}
   ApiParser& parser;
 };
 
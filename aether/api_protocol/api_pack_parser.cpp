@@ -16,15 +16,22 @@
 
 #include "aether/api_protocol/api_pack_parser.h"
 
+#include <cstddef>
+#include <algorithm>
+
 #include "aether/api_protocol/child_data.h"
 
 namespace ae {
 ApiParser::ApiParser(ProtocolContext& protocol_context,
-                     std::vector<std::uint8_t> const& data)
+                     Span<std::uint8_t const> data)
     : protocol_context_{protocol_context}, buffer_reader_{data, *this} {
   protocol_context_.PushParser(*this);
 }
 
+ApiParser::ApiParser(ProtocolContext& protocol_context,
+                     std::vector<std::uint8_t> const& data)
+    : ApiParser{protocol_context, Span{data.data(), data.size()}} {}
+
 ApiParser::ApiParser(ProtocolContext& protocol_context_,
                      ChildData const& child_data)
     : ApiParser{protocol_context_, child_data.PackData()} {}
@@ -45,6 +52,44 @@ ApiPacker::ApiPacker(ProtocolContext& protocol_context_,
 
 ApiPacker::~ApiPacker() { protocol_context_.PopPacker(); }
 
+namespace {
+// max size of serialized PackedSize
+constexpr std::size_t kMaxSizeBytes =
+    sizeof(std::uint8_t) + sizeof(PackedSize::ValueType);
+}  // namespace
+
+std::size_t ApiPacker::SizeBytes(std::size_t size) {
+  auto size_writer = ArrayWriter<kMaxSizeBytes, PackedSize>{};
+  auto os = omstream{size_writer};
+  os << PackedSize{size};
+  return size_writer.written;
+}
+
+void ApiPacker::PatchSize(std::size_t offset, std::size_t reserved,
+                          std::size_t size) {
+  protocol_context_.set_packed_size_hint(size);
+
+  auto size_writer = ArrayWriter<kMaxSizeBytes, PackedSize>{};
+  auto os = omstream{size_writer};
+  os << PackedSize{size};
+
+  auto const& size_bytes = size_writer.buffer;
+  auto written = size_writer.written;
+  auto& data = buffer_writer_.data_;
+  auto slot = static_cast<std::ptrdiff_t>(offset);
+  // the hint missed, move the packed data to the real size width
+  if (written > reserved) {
+    data.insert(data.begin() + slot + static_cast<std::ptrdiff_t>(reserved),
+                written - reserved, 0);
+  } else if (written < reserved) {
+    data.erase(data.begin() + slot + static_cast<std::ptrdiff_t>(written),
+               data.begin() + slot + static_cast<std::ptrdiff_t>(reserved));
+  }
+  std::copy(size_bytes.begin(),
+            size_bytes.begin() + static_cast<std::ptrdiff_t>(written),
+            data.begin() + slot);
+}
+
 MessageBufferWriter& ApiPacker::Buffer() { return buffer_writer_; }
 
 ProtocolContext& ApiPacker::Context() { return protocol_context_; }
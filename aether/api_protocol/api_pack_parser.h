@@ -23,6 +23,8 @@
 #include <cassert>
 #include <cstdint>
 
+#include "aether/types/span.h"
+#include "aether/types/borrowed_data.h"
 #include "aether/api_protocol/api_message.h"
 #include "aether/api_protocol/protocol_context.h"
 
@@ -35,6 +37,10 @@ class ApiPacker;
 // Parsing raw data buffer to API messages
 class ApiParser {
  public:
+  /**
+   * \brief Parse data in place, data must outlive the parser.
+   */
+  ApiParser(ProtocolContext& protocol_context_, Span<std::uint8_t const> data);
   ApiParser(ProtocolContext& protocol_context_,
             std::vector<std::uint8_t> const& data);
   ApiParser(ProtocolContext& protocol_context_, ChildData const& child_data);
@@ -63,6 +69,14 @@ class ApiParser {
     return result;
   }
 
+  /**
+   * \brief Extract size prefixed bytes without copying.
+   * The result refers to the parsed data.
+   */
+  Span<std::uint8_t const> ExtractSpan() {
+    return Extract<BorrowedData>().span();
+  }
+
   // cancel parsing
   void Cancel();
   ProtocolContext& Context();
@@ -86,11 +100,33 @@ class ApiPacker {
     std::forward<Message>(msg).Save(ostream_);
   }
 
+  /**
+   * \brief Pack nested messages with the size prefix into the same buffer.
+   * The size prefix is reserved as wide as the last nested data packed at
+   * this depth, and patched in place after packing. Only if the real size
+   * needs another width the packed data is moved.
+   */
+  template <typename TPackFunc>
+  void PackSized(TPackFunc&& pack_func) {
+    auto& data = buffer_writer_.data_;
+    auto offset = data.size();
+    auto reserved = SizeBytes(protocol_context_.packed_size_hint());
+    data.resize(offset + reserved);
+    {
+      auto packer = ApiPacker{protocol_context_, data};
+      std::forward<TPackFunc>(pack_func)(packer);
+    }
+    PatchSize(offset, reserved, data.size() - offset - reserved);
+  }
+
   MessageBufferWriter& Buffer();
 
   ProtocolContext& Context();
 
  private:
+  static std::size_t SizeBytes(std::size_t size);
+  void PatchSize(std::size_t offset, std::size_t reserved, std::size_t size);
+
   ProtocolContext& protocol_context_;
   MessageBufferWriter buffer_writer_;
   message_ostream ostream_{buffer_writer_};
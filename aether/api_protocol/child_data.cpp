@@ -26,26 +26,33 @@ ChildData::ChildData(std::unique_ptr<IPackMessage> pack_message)
 
 std::vector<std::uint8_t> ChildData::PackData(
     ProtocolContext& protocol_context) && {
-  if (pack_data_.index() == 0) {
-    return DataPackMessage(protocol_context,
-                           std::move(*std::get<0>(pack_data_)));
+  if (is_packed()) {
+    return std::get<std::vector<std::uint8_t>>(std::move(pack_data_));
   }
-  return std::get<1>(pack_data_);
+  auto res = DataBufferPool::Acquire(0);
+  auto packer = ApiPacker{protocol_context, res};
+  std::move(*this).Pack(packer);
+  return res;
 }
 
 std::vector<std::uint8_t> const& ChildData::PackData() const {
-  if (pack_data_.index() == 0) {
+  if (!is_packed()) {
     assert(false);
   }
-  return std::get<1>(pack_data_);
+  return std::get<std::vector<std::uint8_t>>(pack_data_);
 }
 
-std::vector<std::uint8_t> ChildData::DataPackMessage(
-    ProtocolContext& protocol_context, IPackMessage&& pack_message) {
-  std::vector<std::uint8_t> res;
-  auto packer = ApiPacker{protocol_context, res};
-  std::move(pack_message).Pack(packer);
-  return res;
+void ChildData::Pack(ApiPacker& packer) && {
+  if (auto* pack_message =
+          std::get_if<std::unique_ptr<IPackMessage>>(&pack_data_);
+      pack_message != nullptr) {
+    std::move(**pack_message).Pack(packer);
+  } else if (auto* packet_stack = std::get_if<PacketStack>(&pack_data_);
+             packet_stack != nullptr) {
+    std::move(*packet_stack).Pack(packer);
+  } else {
+    assert(false && "Data is already packed");
+  }
 }
 
 }  // namespace ae
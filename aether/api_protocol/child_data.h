@@ -37,11 +37,13 @@ class ChildData {
 
   template <typename TApiClass, typename... TMessages>
   ChildData(PackMessage<TApiClass, TMessages...> pack_message)
-      : ChildData{std::make_unique<PackMessage<TApiClass, TMessages...>>(
-            std::move(pack_message))} {}
+      : pack_data_{std::in_place_type<PacketStack>} {
+    std::get<PacketStack>(pack_data_)
+        .Emplace<PackMessage<TApiClass, TMessages...>>(std::move(pack_message));
+  }
 
   ChildData(PacketBuilder&& packet_builder)
-      : ChildData{std::move(packet_builder).Pack()} {}
+      : pack_data_{std::move(packet_builder).TakeMessages()} {}
 
   ChildData(ChildData&& other) : pack_data_{std::move(other.pack_data_)} {}
   ChildData(ChildData const& other) : ChildData{other.PackData()} {}
@@ -63,13 +65,20 @@ class ChildData {
   std::vector<std::uint8_t> PackData(ProtocolContext& protocol_context) &&;
   std::vector<std::uint8_t> const& PackData() const;
 
+  /**
+   * \brief Pack not packed messages by packer.
+   */
+  void Pack(ApiPacker& packer) &&;
+
+  bool is_packed() const {
+    return std::holds_alternative<std::vector<std::uint8_t>>(pack_data_);
+  }
+
   void clear() { pack_data_ = std::vector<std::uint8_t>{}; }
 
  private:
-  static std::vector<std::uint8_t> DataPackMessage(
-      ProtocolContext& protocol_context, IPackMessage&& pack_message);
-
-  std::variant<std::unique_ptr<IPackMessage>, std::vector<std::uint8_t>>
+  std::variant<std::unique_ptr<IPackMessage>, std::vector<std::uint8_t>,
+               PacketStack>
       pack_data_;
 };
 
@@ -82,8 +91,14 @@ imstream<Ib>& operator>>(imstream<Ib>& is, ChildData& ch_d) {
 }
 
 inline message_ostream& operator<<(message_ostream& os, ChildData const& ch_d) {
-  os << std::move(const_cast<ChildData&>(ch_d))
-            .PackData(os.ob_.packer.Context());
+  auto& child_data = const_cast<ChildData&>(ch_d);
+  if (child_data.is_packed()) {
+    os << child_data.PackData();
+  } else {
+    // packed directly into the parent's buffer
+    os.ob_.packer.PackSized(
+        [&](ApiPacker& packer) { std::move(child_data).Pack(packer); });
+  }
   return os;
 }
 
@@ -17,12 +17,16 @@
 #ifndef AETHER_API_PROTOCOL_PACKET_BUILDER_H_
 #define AETHER_API_PROTOCOL_PACKET_BUILDER_H_
 
+#include <new>
 #include <tuple>
 #include <utility>
-#include <memory>
+#include <cstddef>
 #include <cstdint>
 #include <vector>
+#include <algorithm>
 
+#include "aether/common.h"
+#include "aether/types/data_buffer_pool.h"
 #include "aether/api_protocol/api_pack_parser.h"
 
 namespace ae {
@@ -61,15 +65,128 @@ template <typename TApiClass, typename... TApiMessages>
 PackMessage(TApiClass&& api_class, TApiMessages&&... api_messages)
     -> PackMessage<TApiClass, std::decay_t<TApiMessages>...>;
 
+/**
+ * \brief Stack of packed messages to generate one packet.
+ * Messages are placed one after another into a pooled buffer sized by the
+ * first message, only the messages not fitted into it are allocated
+ * separately.
+ */
+class PacketStack {
+  struct Node {
+    IPackMessage* message;
+    Node* next;
+    bool allocated;
+  };
+
+ public:
+  PacketStack() = default;
+  ~PacketStack() {
+    clear();
+    DataBufferPool::Release(std::move(storage_));
+  }
+
+  AE_CLASS_NO_COPY(PacketStack)
+
+  // messages are not moved, only the storage is
+  PacketStack(PacketStack&& other) noexcept
+      : storage_{std::move(other.storage_)},
+        used_{std::exchange(other.used_, 0)},
+        head_{std::exchange(other.head_, nullptr)},
+        tail_{std::exchange(other.tail_, nullptr)} {}
+
+  PacketStack& operator=(PacketStack&& other) noexcept {
+    if (this != &other) {
+      clear();
+      DataBufferPool::Release(std::move(storage_));
+      storage_ = std::move(other.storage_);
+      used_ = std::exchange(other.used_, 0);
+      head_ = std::exchange(other.head_, nullptr);
+      tail_ = std::exchange(other.tail_, nullptr);
+    }
+    return *this;
+  }
+
+  template <typename TApi, typename TMessage>
+  void Push(TApi&& api, TMessage&& message) & {
+    Emplace<PackMessage<TApi, std::decay_t<TMessage>>>(
+        std::forward<TApi>(api), std::forward<TMessage>(message));
+  }
+
+  template <typename TPackMessage, typename... TArgs>
+  void Emplace(TArgs&&... args) & {
+    static_assert(alignof(TPackMessage) <= alignof(std::max_align_t));
+    static constexpr auto kMessageOffset =
+        (sizeof(Node) + alignof(TPackMessage) - 1) &
+        ~(alignof(TPackMessage) - 1);
+    static constexpr auto kSize = kMessageOffset + sizeof(TPackMessage);
+
+    auto* memory =
+        Allocate(kSize, std::max(alignof(Node), alignof(TPackMessage)));
+    auto allocated = (memory == nullptr);
+    if (allocated) {
+      memory = static_cast<std::uint8_t*>(::operator new(kSize));
+    }
+    auto* message = ::new (memory + kMessageOffset)
+        TPackMessage(std::forward<TArgs>(args)...);
+    auto* node = ::new (memory) Node{message, nullptr, allocated};
+    if (tail_ != nullptr) {
+      tail_->next = node;
+    } else {
+      head_ = node;
+    }
+    tail_ = node;
+  }
+
+  void Pack(ApiPacker& packer) && {
+    for (auto* node = head_; node != nullptr; node = node->next) {
+      std::move(*node->message).Pack(packer);
+    }
+    clear();
+  }
+
+  bool empty() const { return head_ == nullptr; }
+
+  void clear() {
+    for (auto* node = head_; node != nullptr;) {
+      auto* next = node->next;
+      node->message->~IPackMessage();
+      if (node->allocated) {
+        ::operator delete(node);
+      }
+      node = next;
+    }
+    head_ = tail_ = nullptr;
+    used_ = 0;
+  }
+
+ private:
+  std::uint8_t* Allocate(std::size_t size, std::size_t align) {
+    if (storage_.empty()) {
+      // the pool may round the size up to its size class, use it all
+      storage_ = DataBufferPool::Acquire(size);
+      storage_.resize(storage_.capacity());
+    }
+    auto offset = (used_ + align - 1) & ~(align - 1);
+    if ((offset + size) > storage_.size()) {
+      return nullptr;
+    }
+    used_ = offset + size;
+    return storage_.data() + offset;
+  }
+
+  DataBuffer storage_;
+  std::size_t used_{};
+  Node* head_{};
+  Node* tail_{};
+};
+
 class PacketBuilder {
  public:
   template <typename... TPackMessages>
   explicit PacketBuilder(ProtocolContext& protocol_context,
                          TPackMessages&&... pack_messages)
       : protocol_context_{protocol_context} {
-    (pack_messages_.push_back(std::make_unique<std::decay_t<TPackMessages>>(
-         std::forward<TPackMessages>(pack_messages))),
-     ...);
+    (Push(std::forward<TPackMessages>(pack_messages)), ...);
   }
 
   template <typename TApiClass, typename... TApiMessages>
@@ -79,27 +196,30 @@ class PacketBuilder {
   }
 
   std::vector<std::uint8_t> Pack() && {
-    auto data = std::vector<std::uint8_t>{};
+    auto data = DataBufferPool::Acquire(0);
 
     ApiPacker packer{protocol_context_, data};
 
-    for (auto& pack_message : pack_messages_) {
-      std::move(*pack_message).Pack(packer);
-    }
+    std::move(pack_messages_).Pack(packer);
     return data;
   }
 
+  /**
+   * \brief Get not packed messages, e.g. to pack them into the parent packet.
+   */
+  PacketStack TakeMessages() && { return std::move(pack_messages_); }
+
   operator std::vector<std::uint8_t>() && { return std::move(*this).Pack(); }
 
  private:
   template <typename TPackMessage>
   void Push(TPackMessage&& pack_message) {
-    pack_messages_.push_back(std::make_unique<std::decay_t<TPackMessage>>(
-        std::forward<TPackMessage>(pack_message)));
+    pack_messages_.Emplace<std::decay_t<TPackMessage>>(
+        std::forward<TPackMessage>(pack_message));
   }
 
   ProtocolContext& protocol_context_;
-  std::vector<std::unique_ptr<IPackMessage>> pack_messages_;
+  PacketStack pack_messages_;
 };
 
 }  // namespace ae
@@ -0,0 +1,205 @@
+/*
+ * Copyright 2026 Aethernet Inc.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef AETHER_API_PROTOCOL_PENDING_TABLE_H_
+#define AETHER_API_PROTOCOL_PENDING_TABLE_H_
+
+#include <bit>
+#include <array>
+#include <limits>
+#include <cassert>
+#include <cstddef>
+#include <cstdint>
+#include <type_traits>
+
+#include "aether/clock.h"
+#include "aether/api_protocol/request_id.h"
+
+namespace ae {
+/**
+ * \brief Fixed capacity table of pending values by request id.
+ * Values are indexed by an open addressed hash with linear probing, and
+ * linked into a list ordered by deadline, so the earliest deadline and the
+ * oldest entry of the same deadline are at the front.
+ * All operations are O(1) for the same timeout of all the entries.
+ */
+template <typename T, std::size_t Capacity>
+class PendingTable {
+  using Index = std::conditional_t<(Capacity < 0xFFFF), std::uint16_t,
+                                   std::uint32_t>;
+  static_assert(Capacity < std::numeric_limits<Index>::max());
+
+  static constexpr auto kEnd = static_cast<Index>(Capacity);
+  // keep the load factor under 0.5
+  static constexpr std::size_t kBuckets = std::bit_ceil(Capacity * 2);
+  static constexpr std::size_t kBucketMask = kBuckets - 1;
+  static constexpr auto kBucketBits = std::countr_zero(kBuckets);
+
+  struct Slot {
+    RequestId request_id;
+    T* value;
+    TimePoint deadline;
+    Index prev;
+    Index next;
+  };
+
+ public:
+  struct Entry {
+    RequestId request_id;
+    T* value;
+  };
+
+  PendingTable() {
+    for (std::size_t i = 0; i < Capacity; ++i) {
+      slots_[i].next = static_cast<Index>(i + 1);
+    }
+    buckets_.fill(kEnd);
+  }
+
+  PendingTable(PendingTable const&) = delete;
+  PendingTable& operator=(PendingTable const&) = delete;
+
+  bool empty() const { return size_ == 0; }
+  bool full() const { return size_ == Capacity; }
+  std::size_t size() const { return size_; }
+  static constexpr std::size_t max_size() { return Capacity; }
+
+  /**
+   * \brief The deadline of the front entry or TimePoint::max() if empty.
+   */
+  TimePoint next_deadline() const {
+    return (head_ == kEnd) ? TimePoint::max() : slots_[head_].deadline;
+  }
+
+  /**
+   * \brief Insert value for request_id.
+   * Table must not be full and must not contain request_id.
+   */
+  void Insert(RequestId request_id, T* value, TimePoint deadline) {
+    assert(!full() && "Pending table is full");
+    auto index = free_;
+    auto& slot = slots_[index];
+    free_ = slot.next;
+    slot.request_id = request_id;
+    slot.value = value;
+    slot.deadline = deadline;
+    LinkOrdered(index);
+
+    auto bucket = Home(request_id);
+    while (buckets_[bucket] != kEnd) {
+      assert(slots_[buckets_[bucket]].request_id != request_id &&
+             "Request id is already in pending table");
+      bucket = (bucket + 1) & kBucketMask;
+    }
+    buckets_[bucket] = index;
+    ++size_;
+  }
+
+  /**
+   * \brief Remove and return the value for request_id, nullptr if not found.
+   */
+  T* Take(RequestId request_id) {
+    auto bucket = Home(request_id);
+    for (; buckets_[bucket] != kEnd; bucket = (bucket + 1) & kBucketMask) {
+      auto index = buckets_[bucket];
+      if (slots_[index].request_id == request_id) {
+        EraseBucket(bucket);
+        return Release(index);
+      }
+    }
+    return nullptr;
+  }
+
+  /**
+   * \brief Remove and return the front entry.
+   */
+  Entry TakeFront() {
+    assert(!empty() && "Pending table is empty");
+    auto index = head_;
+    auto request_id = slots_[index].request_id;
+    auto bucket = Home(request_id);
+    while (buckets_[bucket] != index) {
+      bucket = (bucket + 1) & kBucketMask;
+    }
+    EraseBucket(bucket);
+    return Entry{request_id, Release(index)};
+  }
+
+ private:
+  static std::size_t Home(RequestId request_id) {
+    // fibonacci hashing spreads the sequential request ids
+    auto hash = static_cast<std::uint32_t>(request_id.id * 0x9E3779B1U);
+    if constexpr (kBucketBits == 0) {
+      return 0;
+    } else {
+      return static_cast<std::size_t>(hash >> (32 - kBucketBits));
+    }
+  }
+
+  void LinkOrdered(Index index) {
+    auto& slot = slots_[index];
+    // entries are mostly added with the latest deadline, search from the tail
+    auto prev = tail_;
+    while ((prev != kEnd) && (slots_[prev].deadline > slot.deadline)) {
+      prev = slots_[prev].prev;
+    }
+    auto next = (prev == kEnd) ? head_ : slots_[prev].next;
+    slot.prev = prev;
+    slot.next = next;
+    (prev == kEnd ? head_ : slots_[prev].next) = index;
+    (next == kEnd ? tail_ : slots_[next].prev) = index;
+  }
+
+  T* Release(Index index) {
+    auto& slot = slots_[index];
+    (slot.prev == kEnd ? head_ : slots_[slot.prev].next) = slot.next;
+    (slot.next == kEnd ? tail_ : slots_[slot.next].prev) = slot.prev;
+    slot.next = free_;
+    free_ = index;
+    --size_;
+    return slot.value;
+  }
+
+  // backward shift deletion, keeps probe sequences without tombstones
+  void EraseBucket(std::size_t hole) {
+    auto bucket = hole;
+    for (;;) {
+      bucket = (bucket + 1) & kBucketMask;
+      if (buckets_[bucket] == kEnd) {
+        break;
+      }
+      auto home = Home(slots_[buckets_[bucket]].request_id);
+      // entry stays if its home is cyclically in (hole, bucket]
+      bool stays = (hole <= bucket) ? ((hole < home) && (home <= bucket))
+                                    : ((hole < home) || (home <= bucket));
+      if (!stays) {
+        buckets_[hole] = buckets_[bucket];
+        hole = bucket;
+      }
+    }
+    buckets_[hole] = kEnd;
+  }
+
+  std::array<Slot, Capacity> slots_{};
+  std::array<Index, kBuckets> buckets_;
+  Index head_{kEnd};
+  Index tail_{kEnd};
+  Index free_{0};
+  std::size_t size_{};
+};
+}  // namespace ae
+
+#endif  // AETHER_API_PROTOCOL_PENDING_TABLE_H_
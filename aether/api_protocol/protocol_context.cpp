@@ -38,6 +38,7 @@ void ProtocolContext::SetSendResultResponse(RequestId request_id) {
   if (entry.response == nullptr) {
     AE_TELED_DEBUG("No callback for request id {} cancel parse", request_id);
     parser()->Cancel();
+    return;
   }
 
   auto* p = parser();
@@ -53,12 +54,39 @@ void ProtocolContext::SetSendErrorResponse(RequestId req_id,
   if (entry.response == nullptr) {
     AE_TELED_DEBUG("No callback for error with request id {}", req_id);
     parser()->Cancel();
+    return;
   }
 
   entry.response->OnError(error_type, static_cast<std::int32_t>(error_code));
   DestroyPending(entry);
 }
 
+TimePoint ProtocolContext::UpdatePending(TimePoint current_time) {
+  while (pending_responses_.next_deadline() <= current_time) {
+    auto entry = TakeOldestPending();
+    AE_TELED_DEBUG("Pending response for request id {} timed out",
+                   entry.request_id);
+    EvictPending(entry);
+  }
+  return pending_responses_.next_deadline();
+}
+
+TimePoint ProtocolContext::next_pending_deadline() const {
+  return pending_responses_.next_deadline();
+}
+
+std::size_t ProtocolContext::pending_count() const {
+  return pending_responses_.size();
+}
+
+TimePoint ProtocolContext::DefaultDeadline() {
+  if constexpr (kPendingResponseTimeout.count() == 0) {
+    return TimePoint::max();
+  } else {
+    return Now() + kPendingResponseTimeout;
+  }
+}
+
 void ProtocolContext::EvictPending(PendingEntry const& entry) {
   assert(entry.response != nullptr &&
          "EvictPending requires a pending response entry");
@@ -95,30 +123,20 @@ void ProtocolContext::PreparePendingResponseSlot(RequestId request_id) {
 
 ProtocolContext::PendingEntry ProtocolContext::TakePending(
     RequestId request_id) {
-  auto* it =
-      std::find_if(std::begin(pending_responses_), std::end(pending_responses_),
-                   [request_id](auto const& pe) noexcept {
-                     return pe.request_id == request_id;
-                   });
-  if (it == std::end(pending_responses_)) {
+  auto* response = pending_responses_.Take(request_id);
+  if (response == nullptr) {
     return PendingEntry{RequestId{}, nullptr};
   }
-
-  auto found = *it;
-  pending_responses_.erase(it);
-  return found;
+  return PendingEntry{request_id, response};
 }
 
 ProtocolContext::PendingEntry ProtocolContext::TakeOldestPending() {
   assert(!pending_responses_.empty() &&
          "TakeOldestPending requires a pending response");
 
-  // oldest is the first
-  auto* it = pending_responses_.begin();
-  auto found = *it;
-  pending_responses_.erase(it);
-
-  return found;
+  // the earliest deadline and the oldest is the first
+  auto front = pending_responses_.TakeFront();
+  return PendingEntry{front.request_id, front.value};
 }
 
 void ProtocolContext::PushPacketStack(PacketStack& packet_stack) {
@@ -181,4 +199,18 @@ ApiPacker* ProtocolContext::packer() {
   return packer;
 }
 
+std::size_t ProtocolContext::packed_size_hint() const {
+  if (packers_.empty()) {
+    return 0;
+  }
+  return packed_size_hints_[packers_.size() - 1];
+}
+
+void ProtocolContext::set_packed_size_hint(std::size_t size) {
+  if (packers_.empty()) {
+    return;
+  }
+  packed_size_hints_[packers_.size() - 1] = size;
+}
+
 }  // namespace ae
@@ -17,6 +17,7 @@
 #ifndef AETHER_API_PROTOCOL_PROTOCOL_CONTEXT_H_
 #define AETHER_API_PROTOCOL_PROTOCOL_CONTEXT_H_
 
+#include <array>
 #include <cassert>
 #include <cstddef>
 #include <cstdint>
@@ -27,10 +28,11 @@
 DISABLE_WARNING_PUSH()
 IGNORE_IMPLICIT_CONVERSION()
 #include <etl/stack.h>
-#include <etl/vector.h>
 DISABLE_WARNING_POP()
 
+#include "aether/clock.h"
 #include "aether/api_protocol/request_id.h"
+#include "aether/api_protocol/pending_table.h"
 #include "aether/config.h"
 
 namespace ae {
@@ -46,6 +48,7 @@ class ProtocolContext {
 
     virtual void OnResult(ApiParser& parser) = 0;
     virtual void OnError(std::uint8_t error_type, std::int32_t error_code) = 0;
+    // evicted by a newer response or dropped by the deadline
     virtual void OnEvicted() = 0;
   };
 
@@ -55,6 +58,8 @@ class ProtocolContext {
       AE_API_PROTOCOL_PENDING_RESPONSE_MAX_SIZE;
   static constexpr auto kPendingResponseAlign =
       AE_API_PROTOCOL_PENDING_RESPONSE_ALIGN;
+  static constexpr auto kPendingResponseTimeout =
+      std::chrono::milliseconds{AE_API_PROTOCOL_PENDING_RESPONSE_TIMEOUT_MS};
   static constexpr auto kMaxPacketStackDepth =
       AE_API_PROTOCOL_MAX_PACKET_STACK_DEPTH;
   static constexpr auto kMaxParserPackerDepth =
@@ -71,8 +76,13 @@ class ProtocolContext {
   ProtocolContext();
   ~ProtocolContext();
 
+  /**
+   * \brief Create pending response for request_id.
+   * If it's not resolved until the deadline, it's evicted by UpdatePending.
+   */
   template <typename Entry>
-  Entry& CreatePendingResponse(RequestId request_id) {
+  Entry& CreatePendingResponse(RequestId request_id,
+                               TimePoint deadline = DefaultDeadline()) {
     static_assert(sizeof(Entry) <= kPendingResponseMaxSize,
                   "Pending response entry exceeds "
                   "AE_API_PROTOCOL_PENDING_RESPONSE_MAX_SIZE");
@@ -85,10 +95,18 @@ class ProtocolContext {
     auto* entry_ptr = pending_response_pool_.template create<Entry>();
     assert(entry_ptr != nullptr &&
            "Pending response pool allocation failed after slot preparation");
-    pending_responses_.emplace_back(PendingEntry{request_id, entry_ptr});
+    pending_responses_.Insert(request_id, entry_ptr, deadline);
     return *entry_ptr;
   }
 
+  /**
+   * \brief Evict pending responses with the deadline passed.
+   * \return the next deadline or TimePoint::max() if there is nothing to wait.
+   */
+  TimePoint UpdatePending(TimePoint current_time);
+  TimePoint next_pending_deadline() const;
+  std::size_t pending_count() const;
+
   void SetSendResultResponse(RequestId request_id);
   void SetSendErrorResponse(RequestId req_id, std::uint8_t error_type,
                             std::uint32_t error_code);
@@ -105,6 +123,13 @@ class ProtocolContext {
   void PopPacker();
   ApiPacker* packer();
 
+  /**
+   * \brief Size of the last nested data packed at the current packer depth.
+   * Used to reserve the size prefix of the next nested data.
+   */
+  std::size_t packed_size_hint() const;
+  void set_packed_size_hint(std::size_t size);
+
  private:
   using PendingResponsePool =
       etl::generic_pool<kPendingResponseMaxSize, kPendingResponseAlign,
@@ -115,11 +140,13 @@ class ProtocolContext {
     PendingResponse* response;
   };
 
-  using PendingList = etl::vector<PendingEntry, kMaxPendingResponses>;
+  using PendingList = PendingTable<PendingResponse, kMaxPendingResponses>;
   using PacketStackStack = etl::stack<PacketStack*, kMaxPacketStackDepth>;
   using ParserStack = etl::stack<ApiParser*, kMaxParserPackerDepth>;
   using PackerStack = etl::stack<ApiPacker*, kMaxParserPackerDepth>;
 
+  static TimePoint DefaultDeadline();
+
   void EvictPending(PendingEntry const& entry);
   void DestroyPending(PendingEntry const& entry);
   void PreparePendingResponseSlot(RequestId request_id);
@@ -132,6 +159,7 @@ class ProtocolContext {
   PacketStackStack packet_stacks_;
   ParserStack parsers_;
   PackerStack packers_;
+  std::array<std::size_t, kMaxParserPackerDepth> packed_size_hints_{};
 };
 }  // namespace ae
 
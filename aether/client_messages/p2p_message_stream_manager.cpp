@@ -66,7 +66,7 @@ P2pMessageStreamManager::GetOrCreatePort(Uid const& destination) {
   return {port, true};
 }
 
-void P2pMessageStreamManager::NewMessageReceived(AeMessage const& message) {
+void P2pMessageStreamManager::NewMessageReceived(AeMessageView const& message) {
   AE_TELED_DEBUG("New message received {}", message.uid);
 
   auto [port, is_new] = GetOrCreatePort(message.uid);
@@ -76,7 +76,8 @@ void P2pMessageStreamManager::NewMessageReceived(AeMessage const& message) {
     new_port_event_.Emit(P2pPortHandle{port});
   }
 
-  port->Deliver(message.data);
+  // the only copy of received data on its way to the stream
+  port->Deliver(message.data.ToBuffer());
 }
 
 void P2pMessageStreamManager::CleanUpPorts() {
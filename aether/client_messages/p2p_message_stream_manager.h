@@ -47,7 +47,7 @@ class P2pMessageStreamManager {
   NewPortEvent::Subscriber new_port_event();
 
  private:
-  void NewMessageReceived(AeMessage const& message);
+  void NewMessageReceived(AeMessageView const& message);
   void CleanUpPorts();
 
   using PortsMap =
@@ -33,19 +33,71 @@
 #  define AE_TASK_MAX_COUNT 128
 #endif
 
+// use hierarchical timer wheel for delayed tasks instead of sorted queue
+#ifndef AE_TASK_TIMER_WHEEL
+#  define AE_TASK_TIMER_WHEEL 0
+#endif
+
 // task max size, this should be more than 16 bytes
 #ifndef AE_TASK_MAX_SIZE
-#  define AE_TASK_MAX_SIZE 8 * sizeof(void*)
+#  if AE_TASK_TIMER_WHEEL
+// timer wheel node takes 5 pointers more
+#    define AE_TASK_MAX_SIZE 13 * sizeof(void*)
+#  else
+#    define AE_TASK_MAX_SIZE 8 * sizeof(void*)
+#  endif
 #endif
 // task alignment
 #ifndef AE_TASK_ALIGN
 #  define AE_TASK_ALIGN alignof(std::max_align_t)
 #endif
 
+// count of freed data buffers kept for reuse in each size class of
+// DataBufferPool, 0 - buffers are not kept and reserve the exact size
+// Pooled buffers stay allocated for the whole program life, so it's off by
+// default, host builds with high traffic may enable it e.g. with 16
+#ifndef AE_DATA_BUFFER_POOL_SIZE
+#  define AE_DATA_BUFFER_POOL_SIZE 0
+#endif
+// space reserved in the data buffers after the data, enough for the crypto
+// mac and nonce appended to the data
+#ifndef AE_DATA_BUFFER_TAILROOM
+#  define AE_DATA_BUFFER_TAILROOM 32
+#endif
+
+// collect Ptr reference cycles from AetherApp::Update instead of on each
+// dropped reference \see CycleCollector
+#ifndef AE_PTR_DEFERRED_CYCLE_COLLECTION
+#  define AE_PTR_DEFERRED_CYCLE_COLLECTION 0
+#endif
+// count of objects visited and marked by deferred cycle collection per
+// update, a bigger graph is continued by the next updates
+#ifndef AE_PTR_CYCLE_COLLECTOR_BUDGET
+#  define AE_PTR_CYCLE_COLLECTOR_BUDGET 512
+#endif
+
+// keep domain storage in a single memory mapped file instead of a file per
+// object \see MmapDomainStorage
+#ifndef AE_DOMAIN_STORAGE_MMAP
+#  define AE_DOMAIN_STORAGE_MMAP 0
+#endif
+
+// count of api responses awaited at once per connection, the oldest one is
+// evicted on overflow
+// The default suits a few calls in flight, applications making thousands of
+// concurrent calls must raise it, otherwise responses are evicted before they
+// arrive
 #ifndef AE_API_PROTOCOL_MAX_PENDING_RESPONSES
 #  define AE_API_PROTOCOL_MAX_PENDING_RESPONSES 10
 #endif
 
+// time in milliseconds to wait for api response before it's dropped with
+// error, 0 - wait until evicted
+// A deadline may also be set for each call on pending response creation
+#ifndef AE_API_PROTOCOL_PENDING_RESPONSE_TIMEOUT_MS
+#  define AE_API_PROTOCOL_PENDING_RESPONSE_TIMEOUT_MS 0
+#endif
+
 #ifndef AE_API_PROTOCOL_MAX_PACKET_STACK_DEPTH
 #  define AE_API_PROTOCOL_MAX_PACKET_STACK_DEPTH 4
 #endif
@@ -137,6 +189,26 @@
 #  define AE_LWIP_SOCKET_TYPES LWIP_CB_SOCKETS
 #endif
 
+// count of epoll poller worker threads \see aether/poller/epoll_poller.h
+#ifndef AE_EPOLL_POLLER_SHARDS
+#  define AE_EPOLL_POLLER_SHARDS 1
+#endif
+
+// max count of events handled by one epoll_wait call
+#ifndef AE_EPOLL_POLLER_MAX_EVENTS
+#  define AE_EPOLL_POLLER_MAX_EVENTS 10
+#endif
+
+// io_uring submission queue size \see aether/poller/io_uring_poller.h
+#ifndef AE_IO_URING_QUEUE_DEPTH
+#  define AE_IO_URING_QUEUE_DEPTH 256
+#endif
+// io_uring completion queue size, should be more than count of watched
+// descriptors, the overflowed completions are kept by kernel but slower
+#ifndef AE_IO_URING_CQ_DEPTH
+#  define AE_IO_URING_CQ_DEPTH (4 * AE_IO_URING_QUEUE_DEPTH)
+#endif
+
 #ifndef AE_FREERTOS_POLLER_STACK_SIZE
 #  define AE_FREERTOS_POLLER_STACK_SIZE 4096
 #endif
@@ -266,6 +338,16 @@
 #  define AE_SAFE_STREAM_RTO_GROW_FACTOR 1.5
 #endif  // AE_SAFE_STREAM_RTO_GROW_FACTOR
 
+// safe stream congestion control, AE_NONE keeps window fixed to window_size
+#ifndef AE_SAFE_STREAM_CONGESTION_CONTROL
+#  define AE_SAFE_STREAM_CONGESTION_CONTROL AE_NONE
+#endif  // AE_SAFE_STREAM_CONGESTION_CONTROL
+
+// safe stream max count of sent and not acknowledged chunks
+#ifndef AE_SAFE_STREAM_MAX_SENDING_CHUNKS
+#  define AE_SAFE_STREAM_MAX_SENDING_CHUNKS 32
+#endif  // AE_SAFE_STREAM_MAX_SENDING_CHUNKS
+
 // window size for connection statistics
 #ifndef AE_STATISTICS_CONNECTION_WINDOW_SIZE
 #  define AE_STATISTICS_CONNECTION_WINDOW_SIZE 100
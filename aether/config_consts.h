@@ -42,6 +42,10 @@
 #define AE_BLAKE2B 1
 #define AE_HYDRO_HASH 2
 
+// AE_SAFE_STREAM_CONGESTION_CONTROL, Safe stream congestion control
+#define AE_CONGESTION_AIMD 1
+#define AE_CONGESTION_PACING 2
+
 #define AE_LITTLE_ENDIAN 1
 #define AE_BIG_ENDIAN 2
 
@@ -30,6 +30,16 @@ class IEncryptProvider {
    * \brief Encrypts the data.
    */
   virtual DataBuffer Encrypt(DataBuffer const& data) = 0;
+  /**
+   * \brief Encrypts the data where it is.
+   * EncryptOverhead() bytes are appended to the data, reserve them to avoid
+   * reallocation.
+   * \return false if encryption failed.
+   */
+  virtual bool EncryptInPlace(DataBuffer& data) {
+    data = Encrypt(data);
+    return !data.empty();
+  }
   virtual std::size_t EncryptOverhead() const = 0;
 };
 
@@ -41,6 +51,15 @@ class IDecryptProvider {
    * \brief Decrypts the data.
    */
   virtual DataBuffer Decrypt(DataBuffer const& data) = 0;
+  /**
+   * \brief Decrypts the data where it is, the data is shrunk to the decrypted
+   * size.
+   * \return false if decryption failed, the data is in unspecified state.
+   */
+  virtual bool DecryptInPlace(DataBuffer& data) {
+    data = Decrypt(data);
+    return !data.empty();
+  }
 };
 
 class ICryptoProvider {
@@ -20,72 +20,58 @@
 
 #  include <algorithm>
 #  include <cassert>
+#  include <iterator>
 #  include <utility>
-#  include <vector>
 
+#  include "aether/types/data_buffer_pool.h"
 #  include "aether/crypto/crypto_nonce.h"
 #  include "aether/tele.h"
 
 namespace ae {
 
 namespace _internal {
-inline DataBuffer EncryptWithSymmetric(
-    SodiumChacha20Poly1305Key const& secret_key, CryptoNonce const& nonce,
-    DataBuffer const& raw_data) {
-  std::vector<uint8_t> ciphertext(raw_data.size() +
-                                  crypto_aead_chacha20poly1305_ABYTES +
-                                  nonce.value.size());
-
-  unsigned long long ciphertext_len;
-
-  [[maybe_unused]] auto r = crypto_aead_chacha20poly1305_encrypt(
-      ciphertext.data(), &ciphertext_len, raw_data.data(), raw_data.size(),
-      nullptr, 0, nullptr, nonce.value.data(), secret_key.key.data());
-
-  assert(r == 0);
-
-  ciphertext.resize(
-      static_cast<std::size_t>(ciphertext_len + nonce.value.size()));
+// data is encrypted in place and followed by mac and nonce
+inline bool EncryptWithSymmetric(SodiumChacha20Poly1305Key const& secret_key,
+                                 CryptoNonce const& nonce, DataBuffer& data) {
+  auto data_size = data.size();
+  data.resize(data_size + crypto_aead_chacha20poly1305_ABYTES +
+              nonce.value.size());
+  auto* mac = data.data() + data_size;
+
+  auto r = crypto_aead_chacha20poly1305_encrypt_detached(
+      data.data(), mac, nullptr, data.data(), data_size, nullptr, 0, nullptr,
+      nonce.value.data(), secret_key.key.data());
+  if (r != 0) {
+    return false;
+  }
 
   // add nonce to the end of ciphertext
-  std::copy(
-      std::begin(nonce.value), std::end(nonce.value),
-      std::begin(ciphertext) + static_cast<std::ptrdiff_t>(ciphertext_len));
-
-  return ciphertext;
+  std::copy(std::begin(nonce.value), std::end(nonce.value),
+            mac + crypto_aead_chacha20poly1305_ABYTES);
+  return true;
 }
 
-inline DataBuffer DecryptWithSymmetric(
-    SodiumChacha20Poly1305Key const& secret_key,
-    DataBuffer const& encrypted_data) {
-  if (encrypted_data.size() <=
-      kNonceSize + crypto_aead_chacha20poly1305_ABYTES) {
-    return {};
+// data is decrypted in place and shrunk to the decrypted size
+inline bool DecryptWithSymmetric(SodiumChacha20Poly1305Key const& secret_key,
+                                 DataBuffer& data) {
+  if (data.size() <= kNonceSize + crypto_aead_chacha20poly1305_ABYTES) {
+    return false;
   }
 
-  auto nonce = CryptoNonce{};
-  auto encrypted_data_size = encrypted_data.size() - nonce.value.size();
-
-  // get nonce from the end of child_data_
-  std::copy(
-      encrypted_data.begin() + static_cast<std::ptrdiff_t>(encrypted_data_size),
-      encrypted_data.end(), nonce.value.begin());
-
-  auto decrypted_data = std::vector<uint8_t>(
-      encrypted_data_size - crypto_aead_chacha20poly1305_ABYTES);
-  unsigned long long decrypted_len{0};
-
-  auto r = crypto_aead_chacha20poly1305_decrypt(
-      decrypted_data.data(), &decrypted_len, nullptr, encrypted_data.data(),
-      encrypted_data_size, nullptr, 0, nonce.value.data(),
-      secret_key.key.data());
+  auto decrypted_size =
+      data.size() - kNonceSize - crypto_aead_chacha20poly1305_ABYTES;
+  auto const* mac = data.data() + decrypted_size;
+  auto const* nonce = mac + crypto_aead_chacha20poly1305_ABYTES;
 
+  auto r = crypto_aead_chacha20poly1305_decrypt_detached(
+      data.data(), nullptr, data.data(), decrypted_size, mac, nullptr, 0,
+      nonce, secret_key.key.data());
   if (r != 0) {
-    return {};
+    return false;
   }
 
-  decrypted_data.resize(static_cast<std::size_t>(decrypted_len));
-  return decrypted_data;
+  data.resize(decrypted_size);
+  return true;
 }
 }  // namespace _internal
 
@@ -94,11 +80,25 @@ SodiumSyncEncryptProvider::SodiumSyncEncryptProvider(
     : key_provider_{std::move(key_provider)} {}
 
 DataBuffer SodiumSyncEncryptProvider::Encrypt(DataBuffer const& data) {
+  auto ciphertext = DataBufferPool::Acquire(data.size());
+  ciphertext.assign(std::begin(data), std::end(data));
+  if (!EncryptInPlace(ciphertext)) {
+    DataBufferPool::Release(std::move(ciphertext));
+    return {};
+  }
+  return ciphertext;
+}
+
+bool SodiumSyncEncryptProvider::EncryptInPlace(DataBuffer& data) {
   auto key = key_provider_->GetKey();
   assert(key.Index() == CryptoKeyType::kSodiumChacha20Poly1305);
 
-  return _internal::EncryptWithSymmetric(key.Get<SodiumChacha20Poly1305Key>(),
-                                         key_provider_->Nonce(), data);
+  if (!_internal::EncryptWithSymmetric(key.Get<SodiumChacha20Poly1305Key>(),
+                                       key_provider_->Nonce(), data)) {
+    AE_TELED_ERROR("Sync encrypt failed");
+    return false;
+  }
+  return true;
 }
 
 std::size_t SodiumSyncEncryptProvider::EncryptOverhead() const {
@@ -110,15 +110,25 @@ SodiumSyncDecryptProvider::SodiumSyncDecryptProvider(
     : key_provider_{std::move(key_provider)} {}
 
 DataBuffer SodiumSyncDecryptProvider::Decrypt(DataBuffer const& data) {
+  auto decrypted = DataBufferPool::Acquire(data.size());
+  decrypted.assign(std::begin(data), std::end(data));
+  if (!DecryptInPlace(decrypted)) {
+    DataBufferPool::Release(std::move(decrypted));
+    return {};
+  }
+  return decrypted;
+}
+
+bool SodiumSyncDecryptProvider::DecryptInPlace(DataBuffer& data) {
   auto key = key_provider_->GetKey();
   assert(key.Index() == CryptoKeyType::kSodiumChacha20Poly1305);
 
-  auto decrypted = _internal::DecryptWithSymmetric(
-      key.Get<SodiumChacha20Poly1305Key>(), data);
-  if (decrypted.empty()) {
+  if (!_internal::DecryptWithSymmetric(key.Get<SodiumChacha20Poly1305Key>(),
+                                       data)) {
     AE_TELED_WARNING("Dropped packet: sync decrypt failed");
+    return false;
   }
-  return decrypted;
+  return true;
 }
 
 }  // namespace ae
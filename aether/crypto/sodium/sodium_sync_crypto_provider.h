@@ -33,6 +33,7 @@ class SodiumSyncEncryptProvider : public IEncryptProvider {
       std::unique_ptr<ISyncKeyProvider> key_provider);
 
   DataBuffer Encrypt(DataBuffer const& data) override;
+  bool EncryptInPlace(DataBuffer& data) override;
   std::size_t EncryptOverhead() const override;
 
  private:
@@ -45,6 +46,7 @@ class SodiumSyncDecryptProvider : public IDecryptProvider {
       std::unique_ptr<ISyncKeyProvider> key_provider);
 
   DataBuffer Decrypt(DataBuffer const& data) override;
+  bool DecryptInPlace(DataBuffer& data) override;
 
  private:
   std::unique_ptr<ISyncKeyProvider> key_provider_;
@@ -91,6 +91,10 @@ DataBuffer SyncEncryptProvider::Encrypt(DataBuffer const& data) {
   return impl_->Encrypt(data);
 }
 
+bool SyncEncryptProvider::EncryptInPlace(DataBuffer& data) {
+  return impl_->EncryptInPlace(data);
+}
+
 std::size_t SyncEncryptProvider::EncryptOverhead() const {
   return impl_->EncryptOverhead();
 }
@@ -111,4 +115,8 @@ DataBuffer SyncDecryptProvider::Decrypt(DataBuffer const& data) {
   return impl_->Decrypt(data);
 }
 
+bool SyncDecryptProvider::DecryptInPlace(DataBuffer& data) {
+  return impl_->DecryptInPlace(data);
+}
+
 }  // namespace ae
@@ -28,6 +28,7 @@ class SyncEncryptProvider : public IEncryptProvider {
   explicit SyncEncryptProvider(std::unique_ptr<ISyncKeyProvider> key_provider);
 
   DataBuffer Encrypt(DataBuffer const& data) override;
+  bool EncryptInPlace(DataBuffer& data) override;
   std::size_t EncryptOverhead() const override;
 
  private:
@@ -38,6 +39,7 @@ class SyncDecryptProvider : public IDecryptProvider {
  public:
   explicit SyncDecryptProvider(std::unique_ptr<ISyncKeyProvider> key_provider);
   DataBuffer Decrypt(DataBuffer const& data) override;
+  bool DecryptInPlace(DataBuffer& data) override;
 
  private:
   std::unique_ptr<IDecryptProvider> impl_;
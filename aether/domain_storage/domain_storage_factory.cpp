@@ -16,11 +16,14 @@
 
 #include "aether/domain_storage/domain_storage_factory.h"
 
+#include "aether/config.h"
+
 // IWYU pragma: begin_keeps
 #include "aether/domain_storage/ram_domain_storage.h"
 #include "aether/domain_storage/sync_domain_storage.h"
 #include "aether/domain_storage/spifs_domain_storage.h"
 #include "aether/domain_storage/static_domain_storage.h"
+#include "aether/domain_storage/mmap_domain_storage.h"
 #include "aether/domain_storage/file_system_std_storage.h"
 
 #if defined FS_INIT
@@ -43,7 +46,9 @@ std::unique_ptr<IDomainStorage> DomainStorageFactory::Create() {
 }
 
 std::unique_ptr<IDomainStorage> DomainStorageFactory::CreateRwStorage() {
-#if defined AE_FILE_SYSTEM_STD_ENABLED
+#if defined AE_MMAP_DOMAIN_STORAGE_ENABLED && AE_DOMAIN_STORAGE_MMAP
+  return make_unique<MmapDomainStorage>();
+#elif defined AE_FILE_SYSTEM_STD_ENABLED
   return make_unique<FileSystemStdStorage>();
 #elif defined AE_SPIFS_DOMAIN_STORAGE_ENABLED
   return make_unique<SpiFsDomainStorage>();
@@ -19,7 +19,7 @@
 
 #include "aether/tele.h"
 
-AE_TELE_MODULE(kDomainStorage, 9, 171, 185);
+AE_TELE_MODULE(kDomainStorage, 9, 171, 189);
 AE_TELE_MODULE(kDomainStorageDebug, 109, 300, 320);
 
 AE_TAG(kFileSystemDsLoadObjClassIdNotFound, kDomainStorage)
@@ -55,4 +55,15 @@ AE_TAG(kSpifsDsObjSaved, kDomainStorageDebug)
 AE_TAG(kSpifsDsObjLoaded, kDomainStorageDebug)
 AE_TAG(kSpifsDsObjRemoved, kDomainStorageDebug)
 
+AE_TAG(kMmapDsOpenError, kDomainStorage)
+AE_TAG(kMmapDsWriteError, kDomainStorage)
+AE_TAG(kMmapDsBrokenRecord, kDomainStorage)
+AE_TAG(kMmapDsLoadObjNotFound, kDomainStorage)
+
+AE_TAG(kMmapDsEnumerated, kDomainStorageDebug)
+AE_TAG(kMmapDsObjSaved, kDomainStorageDebug)
+AE_TAG(kMmapDsObjLoaded, kDomainStorageDebug)
+AE_TAG(kMmapDsObjRemoved, kDomainStorageDebug)
+AE_TAG(kMmapDsCompacted, kDomainStorageDebug)
+
 #endif  // AETHER_DOMAIN_STORAGE_DOMAIN_STORAGE_TELE_H_
@@ -0,0 +1,614 @@
+/*
+ * Copyright 2026 Aethernet Inc.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "aether/domain_storage/mmap_domain_storage.h"
+
+#if defined AE_MMAP_DOMAIN_STORAGE_ENABLED
+
+#  include <fcntl.h>
+#  include <unistd.h>
+#  include <sys/uio.h>
+#  include <sys/mman.h>
+#  include <sys/stat.h>
+
+#  include <array>
+#  include <cerrno>
+#  include <cstdio>
+#  include <cstring>
+#  include <cassert>
+#  include <utility>
+#  include <algorithm>
+
+#  include "aether-miscpp/crc.h"
+
+#  include "aether/mstream_buffers.h"
+#  include "aether/types/span.h"
+#  include "aether/domain_storage/domain_storage_tele.h"
+
+namespace ae {
+namespace mmap_domain_storage_internal {
+static constexpr std::array<char, 4> kFileMagic{'A', 'E', 'D', 'S'};
+static constexpr std::uint32_t kFormatVersion = 1;
+static constexpr std::uint32_t kRecordMagic = 0xAE5D0BEC;
+
+enum class RecordKind : std::uint8_t {
+  kData,
+  kRemoved,
+};
+
+struct FileHeader {
+  std::array<char, 4> magic;
+  std::uint32_t format_version;
+};
+
+/**
+ * \brief Header of each record in file, the record data follows it.
+ */
+struct RecordHeader {
+  std::uint32_t magic;
+  std::uint32_t obj_id;
+  std::uint32_t class_id;
+  std::uint32_t size;
+  std::uint32_t crc;
+  std::uint8_t version;
+  RecordKind kind;
+  std::uint16_t reserved;
+};
+static_assert(sizeof(RecordHeader) == 24, "Record header must be packed");
+
+std::uint32_t DataCrc(void const* data, std::size_t size) {
+  return crc32::from_buffer(static_cast<std::uint8_t const*>(data), size)
+      .value;
+}
+
+iovec Iov(void const* data, std::size_t size) {
+  return iovec{const_cast<void*>(data), size};
+}
+
+/**
+ * \brief Write all the buffers, repeat on partial write.
+ */
+template <std::size_t Count>
+bool WriteAll(int fd, std::array<iovec, Count> iov) {
+  auto* it = iov.data();
+  auto count = static_cast<int>(Count);
+  while (count > 0) {
+    auto res = ::writev(fd, it, count);
+    if (res < 0) {
+      if (errno == EINTR) {
+        continue;
+      }
+      return false;
+    }
+    auto written = static_cast<std::size_t>(res);
+    while ((count > 0) && (written >= it->iov_len)) {
+      written -= it->iov_len;
+      ++it;
+      --count;
+    }
+    if (count > 0) {
+      it->iov_base = static_cast<std::uint8_t*>(it->iov_base) + written;
+      it->iov_len -= written;
+    }
+  }
+  return true;
+}
+}  // namespace mmap_domain_storage_internal
+
+using namespace mmap_domain_storage_internal;
+
+class MmapStorageWriter final : public IDomainStorageWriter {
+ public:
+  MmapStorageWriter(DomainQuery q, MmapDomainStorage& s)
+      : query{std::move(q)}, storage{&s}, vector_writer{data_buffer} {}
+
+  ~MmapStorageWriter() override { storage->SaveData(query, data_buffer); }
+
+  void write(void const* data, std::size_t size) override {
+    vector_writer.write(data, size);
+  }
+
+  DomainQuery query;
+  MmapDomainStorage* storage;
+  ObjectData data_buffer;
+  VectorWriter<IDomainStorageWriter::size_type> vector_writer;
+};
+
+/**
+ * \brief Reads object data right from the mapped file.
+ * The mapping is kept alive while any reader is opened.
+ */
+class MmapStorageReader final : public IDomainStorageReader {
+ public:
+  MmapStorageReader(Span<std::uint8_t const> d, MmapDomainStorage& s)
+      : data{d}, storage{&s}, offset{} {
+    ++storage->readers_;
+  }
+
+  ~MmapStorageReader() override { storage->ReaderClosed(); }
+
+  void read(void* out, std::size_t size) override {
+    auto available = std::min(size, data.size() - offset);
+    std::memcpy(out, data.data() + offset, available);
+    offset += available;
+    if (available != size) {
+      // never read out of the record
+      std::memset(static_cast<std::uint8_t*>(out) + available, 0,
+                  size - available);
+      read_result = ReadResult::kNo;
+      return;
+    }
+    read_result = ReadResult::kYes;
+  }
+
+  ReadResult result() const override { return read_result; }
+  void result(ReadResult res) override { read_result = res; }
+
+  Span<std::uint8_t const> data;
+  MmapDomainStorage* storage;
+  std::size_t offset;
+  ReadResult read_result{ReadResult::kYes};
+};
+
+MmapDomainStorage::MmapDomainStorage(std::string path)
+    : path_{std::move(path)},
+      fd_{-1},
+      mapping_{},
+      file_size_{},
+      stale_size_{},
+      readers_{},
+      compaction_pending_{} {
+  Open();
+}
+
+MmapDomainStorage::~MmapDomainStorage() {
+  assert((readers_ == 0) && "Readers must not outlive the storage");
+  Close();
+}
+
+std::unique_ptr<IDomainStorageWriter> MmapDomainStorage::Store(
+    DomainQuery const& query) {
+  return std::make_unique<MmapStorageWriter>(query, *this);
+}
+
+ClassList MmapDomainStorage::Enumerate(ObjId const& obj_id) {
+  auto const* object = index_.Find(obj_id.id());
+  if ((object == nullptr) || object->removed) {
+    return {};
+  }
+
+  ClassList classes;
+  classes.reserve(object->records.size());
+  for (auto const& record : object->records) {
+    classes.emplace_back(record.class_id);
+  }
+  // the same class may be stored with a few versions
+  std::sort(std::begin(classes), std::end(classes));
+  classes.erase(std::unique(std::begin(classes), std::end(classes)),
+                std::end(classes));
+  AE_TELE_DEBUG(kMmapDsEnumerated, "Enumerated for obj {} classes {}",
+                obj_id.ToString(), classes);
+  return classes;
+}
+
+DomainLoad MmapDomainStorage::Load(DomainQuery const& query) {
+  auto const* object = index_.Find(query.id.id());
+  if (object == nullptr) {
+    return {DomainLoadResult::kEmpty, {}};
+  }
+  if (object->removed) {
+    return {DomainLoadResult::kRemoved, {}};
+  }
+
+  auto record_it = std::find_if(
+      std::begin(object->records), std::end(object->records),
+      [&](auto const& r) {
+        return (r.class_id == query.class_id) && (r.version == query.version);
+      });
+  if (record_it == std::end(object->records)) {
+    AE_TELE_INFO(kMmapDsLoadObjNotFound,
+                 "Unable to find object id={}, class id={}, version={}",
+                 query.id.ToString(), query.class_id,
+                 static_cast<int>(query.version));
+    return {DomainLoadResult::kEmpty, {}};
+  }
+
+  // records appended after the file was mapped
+  if ((record_it->offset + record_it->size) > mapping_.size) {
+    MapFile();
+    if ((record_it->offset + record_it->size) > mapping_.size) {
+      return {DomainLoadResult::kEmpty, {}};
+    }
+  }
+
+  AE_TELE_DEBUG(kMmapDsObjLoaded,
+                "Loaded object id={}, class id={}, version={}, size={}",
+                query.id.ToString(), query.class_id,
+                static_cast<int>(query.version), record_it->size);
+
+  return {DomainLoadResult::kLoaded,
+          std::make_unique<MmapStorageReader>(
+              Span{mapping_.data + record_it->offset, record_it->size},
+              *this)};
+}
+
+void MmapDomainStorage::Remove(ObjId const& obj_id) {
+  if (fd_ < 0) {
+    return;
+  }
+  auto header = RecordHeader{
+      kRecordMagic,         obj_id.id(), 0, 0, DataCrc(nullptr, 0), 0,
+      RecordKind::kRemoved, 0,
+  };
+  if (!Append(&header, sizeof(header), nullptr, 0)) {
+    return;
+  }
+  AddRemoved(obj_id.id());
+  AE_TELE_DEBUG(kMmapDsObjRemoved, "Removed object {}", obj_id.ToString());
+  CompactIfNeeded();
+}
+
+void MmapDomainStorage::CleanUp() {
+  if (fd_ < 0) {
+    return;
+  }
+  Reset();
+}
+
+void MmapDomainStorage::Compact() {
+  if (fd_ < 0) {
+    return;
+  }
+  if (readers_ != 0) {
+    compaction_pending_ = true;
+    return;
+  }
+  compaction_pending_ = false;
+  // all the records must be mapped to copy them
+  MapFile();
+
+  auto tmp_path = path_ + ".tmp";
+  auto tmp_fd = CreateFile(tmp_path);
+  if (tmp_fd < 0) {
+    return;
+  }
+
+  auto ok = true;
+  std::uint64_t size = sizeof(FileHeader);
+  // new offsets are applied only if the whole file is written
+  std::vector<std::uint64_t> offsets;
+  index_.ForEach([&](auto id, auto const& object) {
+    if (!ok) {
+      return;
+    }
+    if (object.removed) {
+      // keep removed mark to hide the object in the other storages
+      auto header = RecordHeader{
+          kRecordMagic, id, 0, 0, DataCrc(nullptr, 0), 0, RecordKind::kRemoved,
+          0,
+      };
+      ok = WriteAll(tmp_fd, std::array{Iov(&header, sizeof(header))});
+      size += sizeof(header);
+      return;
+    }
+    for (auto const& record : object.records) {
+      // copy record with its header as is
+      auto const* begin = mapping_.data + record.offset - sizeof(RecordHeader);
+      auto size_with_header = sizeof(RecordHeader) + record.size;
+      ok = ok && WriteAll(tmp_fd, std::array{Iov(begin, size_with_header)});
+      offsets.push_back(size + sizeof(RecordHeader));
+      size += size_with_header;
+    }
+  });
+  if (!ReplaceFile(tmp_fd, tmp_path, ok)) {
+    return;
+  }
+
+  AE_TELE_DEBUG(kMmapDsCompacted, "Compacted file {} from {} to {} bytes",
+                path_, file_size_, size);
+
+  file_size_ = size;
+  stale_size_ = 0;
+  auto offset_it = std::begin(offsets);
+  index_.ForEach([&](auto, auto& object) {
+    for (auto& record : object.records) {
+      record.offset = *offset_it++;
+    }
+  });
+  MapFile();
+}
+
+void MmapDomainStorage::Open() {
+  fd_ = ::open(path_.c_str(), O_RDWR | O_CREAT | O_APPEND | O_CLOEXEC, 0644);
+  if (fd_ < 0) {
+    AE_TELE_ERROR(kMmapDsOpenError, "Unable to open file {} error {}", path_,
+                  std::strerror(errno));
+    return;
+  }
+  struct stat file_stat {};
+  if (::fstat(fd_, &file_stat) != 0) {
+    AE_TELE_ERROR(kMmapDsOpenError, "Unable to stat file {} error {}", path_,
+                  std::strerror(errno));
+    ::close(fd_);
+    fd_ = -1;
+    return;
+  }
+  file_size_ = static_cast<std::uint64_t>(file_stat.st_size);
+  if (file_size_ == 0) {
+    // new file
+    if (!Reset()) {
+      Close();
+    }
+    return;
+  }
+  MapFile();
+  if (mapping_.data == nullptr) {
+    // don't touch the file which can't be read
+    ::close(fd_);
+    fd_ = -1;
+    return;
+  }
+
+  auto header = FileHeader{};
+  if (mapping_.size >= sizeof(header)) {
+    std::memcpy(&header, mapping_.data, sizeof(header));
+  }
+  if ((header.magic != kFileMagic) ||
+      (header.format_version != kFormatVersion)) {
+    AE_TELE_ERROR(kMmapDsBrokenRecord, "Unknown format of file {}, reset it",
+                  path_);
+    if (!Reset()) {
+      Close();
+    }
+    return;
+  }
+  ScanRecords();
+}
+
+void MmapDomainStorage::Close() {
+  Unmap(mapping_);
+  mapping_ = {};
+  for (auto const& mapping : retired_mappings_) {
+    Unmap(mapping);
+  }
+  retired_mappings_.clear();
+  if (fd_ >= 0) {
+    ::close(fd_);
+    fd_ = -1;
+  }
+}
+
+bool MmapDomainStorage::Reset() {
+  // replace the file instead of truncation, opened readers still use the old
+  // one's mapping
+  auto tmp_path = path_ + ".tmp";
+  auto tmp_fd = CreateFile(tmp_path);
+  if ((tmp_fd < 0) || !ReplaceFile(tmp_fd, tmp_path, true)) {
+    return false;
+  }
+  index_.Clear();
+  file_size_ = sizeof(FileHeader);
+  stale_size_ = 0;
+  MapFile();
+  return true;
+}
+
+int MmapDomainStorage::CreateFile(std::string const& path) {
+  auto fd = ::open(path.c_str(),
+                   O_RDWR | O_CREAT | O_TRUNC | O_APPEND | O_CLOEXEC, 0644);
+  if (fd < 0) {
+    AE_TELE_ERROR(kMmapDsWriteError, "Unable to open file {} error {}", path,
+                  std::strerror(errno));
+    return -1;
+  }
+  auto file_header = FileHeader{kFileMagic, kFormatVersion};
+  if (!WriteAll(fd, std::array{Iov(&file_header, sizeof(file_header))})) {
+    AE_TELE_ERROR(kMmapDsWriteError, "Unable to write file {} error {}", path,
+                  std::strerror(errno));
+    ::close(fd);
+    ::unlink(path.c_str());
+    return -1;
+  }
+  return fd;
+}
+
+bool MmapDomainStorage::ReplaceFile(int tmp_fd, std::string const& tmp_path,
+                                    bool written) {
+  auto ok = written && (::fsync(tmp_fd) == 0) &&
+            (::rename(tmp_path.c_str(), path_.c_str()) == 0);
+  if (!ok) {
+    AE_TELE_ERROR(kMmapDsWriteError, "Unable to replace file {} error {}",
+                  path_, std::strerror(errno));
+    ::close(tmp_fd);
+    ::unlink(tmp_path.c_str());
+    return false;
+  }
+  // the old file's mapping stays valid until it's unmapped
+  if (readers_ != 0) {
+    retired_mappings_.push_back(mapping_);
+  } else {
+    Unmap(mapping_);
+  }
+  mapping_ = {};
+  if (fd_ >= 0) {
+    ::close(fd_);
+  }
+  fd_ = tmp_fd;
+  return true;
+}
+
+void MmapDomainStorage::ScanRecords() {
+  std::uint64_t offset = sizeof(FileHeader);
+  while ((file_size_ - offset) >= sizeof(RecordHeader)) {
+    auto header = RecordHeader{};
+    std::memcpy(&header, mapping_.data + offset, sizeof(header));
+    auto data_offset = offset + sizeof(header);
+    if ((header.magic != kRecordMagic) ||
+        (header.size > (file_size_ - data_offset)) ||
+        (DataCrc(mapping_.data + data_offset, header.size) != header.crc)) {
+      break;
+    }
+    if (header.kind == RecordKind::kData) {
+      AddRecord(header.obj_id, Record{header.class_id, header.version,
+                                      header.size, data_offset});
+    } else if (header.kind == RecordKind::kRemoved) {
+      AddRemoved(header.obj_id);
+    } else {
+      break;
+    }
+    offset = data_offset + header.size;
+  }
+
+  if (offset != file_size_) {
+    // the tail was not completely written
+    AE_TELE_ERROR(kMmapDsBrokenRecord,
+                  "Broken record in file {} at {}, drop {} bytes", path_,
+                  offset, file_size_ - offset);
+    if (::ftruncate(fd_, static_cast<off_t>(offset)) == 0) {
+      file_size_ = offset;
+      MapFile();
+    }
+  }
+}
+
+void MmapDomainStorage::MapFile() {
+  if (mapping_.size == file_size_) {
+    return;
+  }
+  if (readers_ != 0) {
+    retired_mappings_.push_back(mapping_);
+  } else {
+    Unmap(mapping_);
+  }
+  mapping_ = {};
+  if (file_size_ == 0) {
+    return;
+  }
+  auto* data = ::mmap(nullptr, static_cast<std::size_t>(file_size_),
+                      PROT_READ, MAP_SHARED, fd_, 0);
+  if (data == MAP_FAILED) {
+    AE_TELE_ERROR(kMmapDsOpenError, "Unable to map file {} error {}", path_,
+                  std::strerror(errno));
+    return;
+  }
+  mapping_ = Mapping{static_cast<std::uint8_t const*>(data),
+                     static_cast<std::size_t>(file_size_)};
+}
+
+void MmapDomainStorage::Unmap(Mapping mapping) {
+  if (mapping.data != nullptr) {
+    ::munmap(const_cast<std::uint8_t*>(mapping.data), mapping.size);
+  }
+}
+
+bool MmapDomainStorage::Append(void const* header, std::size_t header_size,
+                               void const* data, std::size_t data_size) {
+  if (!WriteAll(fd_, std::array{Iov(header, header_size),
+                                Iov(data, data_size)})) {
+    AE_TELE_ERROR(kMmapDsWriteError, "Unable to write file {} error {}",
+                  path_, std::strerror(errno));
+    // drop partially written record
+    [[maybe_unused]] auto res =
+        ::ftruncate(fd_, static_cast<off_t>(file_size_));
+    return false;
+  }
+  file_size_ += header_size + data_size;
+  return true;
+}
+
+void MmapDomainStorage::SaveData(DomainQuery const& query,
+                                 ObjectData const& data) {
+  if (fd_ < 0) {
+    return;
+  }
+  auto header = RecordHeader{
+      kRecordMagic,
+      query.id.id(),
+      query.class_id,
+      static_cast<std::uint32_t>(data.size()),
+      DataCrc(data.data(), data.size()),
+      query.version,
+      RecordKind::kData,
+      0,
+  };
+  auto data_offset = file_size_ + sizeof(header);
+  if (!Append(&header, sizeof(header), data.data(), data.size())) {
+    return;
+  }
+  AddRecord(query.id.id(),
+            Record{query.class_id, query.version, header.size, data_offset});
+  AE_TELE_DEBUG(kMmapDsObjSaved,
+                "Saved object id={}, class id={}, version={}, size={}",
+                query.id.ToString(), query.class_id,
+                static_cast<int>(query.version), data.size());
+  CompactIfNeeded();
+}
+
+void MmapDomainStorage::AddRecord(ObjId::Type id, Record const& record) {
+  auto& object = index_[id];
+  if (object.removed) {
+    // object is stored again after remove, remove mark is stale
+    object.removed = false;
+    stale_size_ += sizeof(RecordHeader);
+  }
+  auto it = std::find_if(
+      std::begin(object.records), std::end(object.records),
+      [&](auto const& r) {
+        return (r.class_id == record.class_id) && (r.version == record.version);
+      });
+  if (it == std::end(object.records)) {
+    object.records.push_back(record);
+    return;
+  }
+  stale_size_ += sizeof(RecordHeader) + it->size;
+  *it = record;
+}
+
+void MmapDomainStorage::AddRemoved(ObjId::Type id) {
+  auto& object = index_[id];
+  for (auto const& record : object.records) {
+    stale_size_ += sizeof(RecordHeader) + record.size;
+  }
+  object.records.clear();
+  if (object.removed) {
+    stale_size_ += sizeof(RecordHeader);
+  }
+  object.removed = true;
+}
+
+void MmapDomainStorage::ReaderClosed() {
+  assert(readers_ > 0);
+  if (--readers_ != 0) {
+    return;
+  }
+  for (auto const& mapping : retired_mappings_) {
+    Unmap(mapping);
+  }
+  retired_mappings_.clear();
+  if (compaction_pending_) {
+    Compact();
+  }
+}
+
+void MmapDomainStorage::CompactIfNeeded() {
+  if ((stale_size_ >= kCompactionThreshold) &&
+      ((stale_size_ * 2) > file_size_)) {
+    Compact();
+  }
+}
+}  // namespace ae
+
+#endif  // AE_MMAP_DOMAIN_STORAGE_ENABLED
@@ -0,0 +1,127 @@
+/*
+ * Copyright 2026 Aethernet Inc.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef AETHER_DOMAIN_STORAGE_MMAP_DOMAIN_STORAGE_H_
+#define AETHER_DOMAIN_STORAGE_MMAP_DOMAIN_STORAGE_H_
+
+#if (defined(__linux__) || defined(__unix__) || defined(__APPLE__) || \
+     defined(__FreeBSD__))
+
+#  define AE_MMAP_DOMAIN_STORAGE_ENABLED 1
+
+#  include <string>
+#  include <vector>
+#  include <cstddef>
+#  include <cstdint>
+#  include <string_view>
+
+#  include "aether/types/flat_hash_map.h"
+#  include "aether/obj/idomain_storage.h"
+
+namespace ae {
+/**
+ * \brief Domain storage in a single append-only memory mapped file.
+ * Each Store and Remove appends a record to the file and updates an in-memory
+ * index of the latest record for each object id, class id and version.
+ * Load is an index lookup and the reader reads right from the mapped file.
+ * Stale records are dropped by compaction, which rewrites the file with only
+ * the live records when the stale ones take more than a half of it.
+ */
+class MmapDomainStorage : public IDomainStorage {
+  friend class MmapStorageWriter;
+  friend class MmapStorageReader;
+
+ public:
+  static constexpr std::string_view kDefaultPath = "state.aedb";
+  // don't compact files with less stale data
+  static constexpr std::uint64_t kCompactionThreshold = 64 * 1024;
+
+  explicit MmapDomainStorage(std::string path = std::string{kDefaultPath});
+  ~MmapDomainStorage() override;
+
+  std::unique_ptr<IDomainStorageWriter> Store(
+      DomainQuery const& query) override;
+  ClassList Enumerate(ObjId const& obj_id) override;
+  DomainLoad Load(DomainQuery const& query) override;
+  void Remove(ObjId const& obj_id) override;
+  void CleanUp() override;
+
+  /**
+   * \brief Rewrite the file with only the live records.
+   * It's postponed until the last opened reader is closed.
+   */
+  void Compact();
+
+  std::uint64_t file_size() const { return file_size_; }
+  std::uint64_t stale_size() const { return stale_size_; }
+
+ private:
+  struct Record {
+    std::uint32_t class_id;
+    std::uint8_t version;
+    std::uint32_t size;
+    // offset of the record data in file
+    std::uint64_t offset;
+  };
+
+  struct ObjectRecords {
+    bool removed{};
+    std::vector<Record> records;
+  };
+
+  struct Mapping {
+    std::uint8_t const* data;
+    std::size_t size;
+  };
+
+  void Open();
+  void Close();
+  bool Reset();
+  // create a file with only the file header
+  int CreateFile(std::string const& path);
+  /**
+   * \brief Replace the storage file with the written tmp file.
+   * On failure the tmp file is removed and the storage is not changed.
+   */
+  bool ReplaceFile(int tmp_fd, std::string const& tmp_path, bool written);
+  void ScanRecords();
+  void MapFile();
+  void Unmap(Mapping mapping);
+
+  bool Append(void const* header, std::size_t header_size, void const* data,
+              std::size_t data_size);
+  void SaveData(DomainQuery const& query, ObjectData const& data);
+  void AddRecord(ObjId::Type id, Record const& record);
+  void AddRemoved(ObjId::Type id);
+
+  void ReaderClosed();
+  void CompactIfNeeded();
+
+  std::string path_;
+  int fd_;
+  Mapping mapping_;
+  std::uint64_t file_size_;
+  std::uint64_t stale_size_;
+  std::size_t readers_;
+  bool compaction_pending_;
+  // mappings replaced while readers still use them
+  std::vector<Mapping> retired_mappings_;
+  FlatHashMap<ObjId::Type, ObjectRecords> index_;
+};
+}  // namespace ae
+
+#endif
+#endif  // AETHER_DOMAIN_STORAGE_MMAP_DOMAIN_STORAGE_H_
@@ -16,30 +16,26 @@
 
 #include "aether/events/event_list.h"
 
+#include <bit>
+#include <cassert>
+
 namespace ae {
-EventHandlersList::IteratorAdapter::Iterator::Iterator(
-    typename ListType::iterator it, std::uint16_t index, std::uint16_t size)
-    : size_{size} {
-  auto counter = index;
-  for (auto i = it; counter < size_; ++i, ++counter) {
-    if (i->is_alive) {
-      it_ = i;
-      index_ = counter;
-      return;
-    }
+EventHandlersList::IteratorAdapter::Iterator::Iterator(EventHandlersList* list,
+                                                       std::uint16_t index,
+                                                       std::uint16_t size)
+    : list_{list}, index_{index}, size_{size} {
+  if (index_ < size_) {
+    auto chunk_index = ChunkOf(index_);
+    slot_ = &list_->slot(index_);
+    chunk_end_ = list_->chunk(chunk_index) + (std::size_t{1} << chunk_index);
   }
-  index_ = size_;
+  SkipRemoved();
 }
+
 EventHandlersList::IteratorAdapter::Iterator&
 EventHandlersList::IteratorAdapter::Iterator::operator++() {
-  ++it_;
-  ++index_;
-  if (index_ == size_) {
-    return *this;
-  }
-  if (!it_->is_alive) {
-    return operator++();
-  }
+  Next();
+  SkipRemoved();
   return *this;
 }
 
@@ -60,49 +56,164 @@ bool EventHandlersList::IteratorAdapter::Iterator::operator!=(
   return !(*this == other);
 }
 
+void EventHandlersList::IteratorAdapter::Iterator::Next() {
+  ++index_;
+  if (index_ == size_) {
+    return;
+  }
+  ++slot_;
+  // go to the next chunk
+  if (slot_ == chunk_end_) {
+    auto chunk_index = ChunkOf(index_);
+    slot_ = list_->chunk(chunk_index);
+    chunk_end_ = slot_ + (std::size_t{1} << chunk_index);
+  }
+}
+
+void EventHandlersList::IteratorAdapter::Iterator::SkipRemoved() {
+  while ((index_ < size_) &&
+         !slot_->is_alive.load(std::memory_order::relaxed)) {
+    Next();
+  }
+}
+
 EventHandlersList::IteratorAdapter::IteratorAdapter(EventHandlersList* self)
     : self_{self},
-      begin_{std::begin(self_->handlers_), 0,
-             static_cast<std::uint16_t>(self_->handlers_.size())},
-      end_{std::end(self_->handlers_),
-           static_cast<std::uint16_t>(self_->handlers_.size()),
-           static_cast<std::uint16_t>(self_->handlers_.size())} {
-  ++self_->use_counter_;
+      begin_{self_, 0, self_->size_},
+      end_{self_, self_->size_, self_->size_} {
+  self_->IncrementUse();
 }
 
 EventHandlersList::IteratorAdapter::~IteratorAdapter() {
-  if ((--self_->use_counter_) == 0) {
+  if (self_->DecrementUse() == 0) {
     self_->CleanUp();
   }
 }
 
+EventHandlersList::EventHandlersList(EventSyncPolicy sync_policy)
+    : sync_policy_{sync_policy} {}
+
 EventHandlersList::IteratorAdapter EventHandlersList::Iterator() {
-  auto lock = std::scoped_lock{lock_handlers_};
+  auto lock = Lock();
   return IteratorAdapter{this};
 }
 
 void EventHandlersList::Remove(Index index) {
-  auto lock = std::scoped_lock{lock_handlers_};
-  index.it->is_alive = false;
+  auto lock = Lock();
+  auto& s = slot(index.index);
+  if ((s.generation != index.generation) ||
+      !s.is_alive.load(std::memory_order::relaxed)) {
+    return;
+  }
+  s.is_alive.store(false, std::memory_order::relaxed);
+  if (use_counter_.load(std::memory_order::relaxed) != 0) {
+    // destroyed after iteration
+    ++removed_count_;
+    return;
+  }
+  FreeSlot(index.index);
 }
 
 bool EventHandlersList::Alive(Index index) const {
-  auto lock = std::scoped_lock{lock_handlers_};
-  return index.it->is_alive;
+  auto lock = Lock();
+  auto const& s = slot(index.index);
+  return (s.generation == index.generation) &&
+         s.is_alive.load(std::memory_order::relaxed);
+}
+
+std::unique_lock<std::mutex> EventHandlersList::Lock() const {
+  if (sync_policy_ == EventSyncPolicy::kSingleThread) {
+    return {};
+  }
+  return std::unique_lock{lock_handlers_};
+}
+
+void EventHandlersList::IncrementUse() {
+  if (sync_policy_ == EventSyncPolicy::kSingleThread) {
+    use_counter_.store(use_counter_.load(std::memory_order::relaxed) + 1,
+                       std::memory_order::relaxed);
+    return;
+  }
+  ++use_counter_;
+}
+
+std::int16_t EventHandlersList::DecrementUse() {
+  if (sync_policy_ == EventSyncPolicy::kSingleThread) {
+    auto count = static_cast<std::int16_t>(
+        use_counter_.load(std::memory_order::relaxed) - 1);
+    use_counter_.store(count, std::memory_order::relaxed);
+    return count;
+  }
+  return --use_counter_;
+}
+
+std::size_t EventHandlersList::ChunkOf(std::uint16_t index) {
+  auto pos = static_cast<unsigned>(index) + 1U;
+  return static_cast<std::size_t>(std::bit_width(pos) - 1);
+}
+
+EventHandlersList::Slot* EventHandlersList::chunk(std::size_t chunk_index) {
+  if (chunk_index == 0) {
+    return &first_;
+  }
+  return (*spill_)[chunk_index - 1].get();
+}
+
+EventHandlersList::Slot& EventHandlersList::slot(std::uint16_t index) {
+  auto chunk_index = ChunkOf(index);
+  return chunk(chunk_index)[(static_cast<std::size_t>(index) + 1U) -
+                            (std::size_t{1} << chunk_index)];
+}
+
+EventHandlersList::Slot const& EventHandlersList::slot(
+    std::uint16_t index) const {
+  return const_cast<EventHandlersList*>(this)->slot(index);
+}
+
+std::uint16_t EventHandlersList::AllocSlot() {
+  // a freed slot may be before the end of running iteration, reuse it only if
+  // there is no one to not invoke the new handler in the current emit
+  if ((free_head_ != kNoFree) &&
+      (use_counter_.load(std::memory_order::relaxed) == 0)) {
+    auto index = free_head_;
+    free_head_ = slot(index).next_free;
+    return index;
+  }
+  assert((size_ < kMaxSize) && "Event handlers list is full");
+  auto chunk_index = ChunkOf(size_);
+  if (chunk_index != 0) {
+    if (!spill_) {
+      spill_ = std::make_unique<SpillChunks>();
+    }
+    auto& spill_chunk = (*spill_)[chunk_index - 1];
+    if (!spill_chunk) {
+      spill_chunk = std::make_unique<Slot[]>(std::size_t{1} << chunk_index);
+    }
+  }
+  return size_++;
+}
+
+void EventHandlersList::FreeSlot(std::uint16_t index) {
+  auto& s = slot(index);
+  s.value.reset();
+  ++s.generation;
+  s.next_free = free_head_;
+  free_head_ = index;
 }
 
 void EventHandlersList::CleanUp() {
-  auto lock = std::scoped_lock{lock_handlers_};
-  if (use_counter_ != 0) {
+  auto lock = Lock();
+  if ((use_counter_.load(std::memory_order::relaxed) != 0) ||
+      (removed_count_ == 0)) {
     return;
   }
-  // remove only from the end to prevent held indexes invalidation
-  auto remove_begin = std::end(handlers_);
-  auto it = std::find_if(std::rbegin(handlers_), std::rend(handlers_),
-                         [](auto const& h) { return h.is_alive; });
-  if (it != std::rend(handlers_)) {
-    remove_begin = it.base();
+  for (std::uint16_t i = 0; (i < size_) && (removed_count_ != 0); ++i) {
+    auto& s = slot(i);
+    if (!s.is_alive.load(std::memory_order::relaxed) &&
+        s.value.has_value()) {
+      FreeSlot(i);
+      --removed_count_;
+    }
   }
-  handlers_.erase(remove_begin, std::end(handlers_));
 }
 }  // namespace ae
@@ -17,36 +17,59 @@
 #ifndef AETHER_EVENTS_EVENT_LIST_H_
 #define AETHER_EVENTS_EVENT_LIST_H_
 
-#include <algorithm>
+#include <array>
+#include <mutex>
 #include <atomic>
+#include <memory>
 #include <cstddef>
-#include <list>
-#include <mutex>
+#include <cstdint>
+#include <optional>
 
 #include "aether-miscpp/types/aligned_storage.h"
 #include "aether/events/event_handler.h"
 
 namespace ae {
+/**
+ * \brief Synchronization of the event handlers list.
+ * kSingleThread is for events subscribed and emitted only on one thread, e.g.
+ * the scheduler's one, it skips locks and atomic read-modify-write.
+ */
+enum class EventSyncPolicy : std::uint8_t {
+  kMutex,
+  kSingleThread,
+};
+
 class EventHandlersList {
   using TemplateHandler = EventHandler<void(int)>;
   // all event handlers has the same size
   static constexpr std::size_t kElementSize = sizeof(TemplateHandler);
   static constexpr std::size_t kElementAlign = alignof(TemplateHandler);
   using ValueType = ManagedStorage<kElementSize, kElementAlign>;
-  struct StoreType {
-    template <typename U>
-      requires(!std::is_same_v<StoreType, std::decay_t<U>>)
-    explicit StoreType(U&& value) : value{std::forward<U>(value)} {}
 
-    ValueType value;
-    bool is_alive = true;
+  struct Slot {
+    std::optional<ValueType> value;
+    // changed each time slot is freed to invalidate the old indexes
+    std::uint16_t generation{};
+    std::uint16_t next_free{};
+    // read by emit without lock
+    std::atomic_bool is_alive{};
   };
 
-  using ListType = std::list<StoreType>;
+  /**
+   * Slots are stored in chunks of growing size 1, 2, 4, ... so their
+   * addresses are stable while the list grows even if handler is invoked.
+   * The first chunk is inline, most of events has only one handler, the rest
+   * are allocated with the second one.
+   */
+  static constexpr std::size_t kMaxChunks = 16;
+  using SpillChunks = std::array<std::unique_ptr<Slot[]>, kMaxChunks - 1>;
+  static constexpr std::uint16_t kMaxSize = (1U << kMaxChunks) - 1U;
+  static constexpr std::uint16_t kNoFree = kMaxSize;
 
  public:
   struct Index {
-    typename ListType::iterator it;
+    std::uint16_t index;
+    std::uint16_t generation;
   };
 
   /**
@@ -65,7 +88,7 @@ class EventHandlersList {
      public:
       Iterator() = default;
 
-      Iterator(typename ListType::iterator it, std::uint16_t index,
+      Iterator(EventHandlersList* list, std::uint16_t index,
                std::uint16_t size);
 
       AE_CLASS_COPY_MOVE(Iterator)
@@ -79,15 +102,20 @@ class EventHandlersList {
       bool operator!=(const Iterator& other) const;
       template <typename TSignature>
       auto* get() const {
-        return it_->value.template ptr<EventHandler<TSignature>>();
+        return slot_->value->template ptr<EventHandler<TSignature>>();
       }
 
      private:
-      typename ListType::iterator it_{};
+      void Next();
+      void SkipRemoved();
+
+      EventHandlersList* list_{};
+      Slot* slot_{};
+      Slot* chunk_end_{};
       /**
        * index and size used to control the end of the list.
-       * using end iterator is not appropriate here because it's grow with new
-       * elements added.
+       * size is fixed on iteration start, so the handlers added while
+       * iterating are not visited.
        */
       std::uint16_t index_{};
       std::uint16_t size_{};
@@ -98,7 +126,7 @@ class EventHandlersList {
     explicit IteratorAdapter(EventHandlersList* self);
     ~IteratorAdapter();
 
-    AE_CLASS_COPY_MOVE(IteratorAdapter)
+    AE_CLASS_NO_COPY_MOVE(IteratorAdapter)
 
     iterator begin() { return begin_; }
     iterator end() { return end_; }
@@ -109,7 +137,10 @@ class EventHandlersList {
     iterator end_;
   };
 
-  EventHandlersList() = default;
+  explicit EventHandlersList(
+      EventSyncPolicy sync_policy = EventSyncPolicy::kMutex);
+
+  AE_CLASS_NO_COPY_MOVE(EventHandlersList)
 
   /**
    * \brief Insert a new event handler into the list.
@@ -118,9 +149,12 @@ class EventHandlersList {
    */
   template <typename TSignature>
   Index Insert(EventHandler<TSignature>&& handler) {
-    auto lock = std::scoped_lock{lock_handlers_};
-    auto it = handlers_.emplace(handlers_.end(), std::move(handler));
-    return Index{it};
+    auto lock = Lock();
+    auto index = AllocSlot();
+    auto& s = slot(index);
+    s.value.emplace(std::move(handler));
+    s.is_alive.store(true, std::memory_order::relaxed);
+    return Index{index, s.generation};
   }
 
   /**
@@ -132,7 +166,8 @@ class EventHandlersList {
 
   /**
    * \brief Remove element by index.
-   * It only marks the handler as dead.
+   * It only marks the handler as dead, if the list is iterated it's destroyed
+   * after the iteration.
    */
   void Remove(Index index);
 
@@ -142,14 +177,30 @@ class EventHandlersList {
   bool Alive(Index index) const;
 
  private:
+  std::unique_lock<std::mutex> Lock() const;
+  void IncrementUse();
+  std::int16_t DecrementUse();
+
+  static std::size_t ChunkOf(std::uint16_t index);
+  Slot* chunk(std::size_t chunk_index);
+  Slot& slot(std::uint16_t index);
+  Slot const& slot(std::uint16_t index) const;
+  std::uint16_t AllocSlot();
+  void FreeSlot(std::uint16_t index);
+
   /**
-   * \brief Remove last unalived handlers.
+   * \brief Destroy removed handlers.
    */
   void CleanUp();
 
+  EventSyncPolicy sync_policy_;
+  std::uint16_t size_{};
+  std::uint16_t removed_count_{};
+  std::uint16_t free_head_{kNoFree};
   std::atomic_int16_t use_counter_{0};
   mutable std::mutex lock_handlers_;
-  ListType handlers_;
+  Slot first_;
+  std::unique_ptr<SpillChunks> spill_;
 };
 }  // namespace ae
 
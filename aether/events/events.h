@@ -46,7 +46,19 @@ class Event<void(TArgs...)> {
   using Subscriber = EventSubscriber<CallbackSignature>;
   using List = EventHandlersList;
 
-  explicit Event() : events_list_{MakeRcPtr<List>()} {}
+  /**
+   * \brief Use EventSyncPolicy::kSingleThread for events subscribed and
+   * emitted only on one thread.
+   * Handlers list of single thread event is allocated by the first
+   * subscription, the other events may be subscribed on one thread while
+   * emitted on another and allocate it here.
+   */
+  explicit Event(EventSyncPolicy sync_policy = EventSyncPolicy::kMutex)
+      : sync_policy_{sync_policy} {
+    if (sync_policy_ != EventSyncPolicy::kSingleThread) {
+      events_list_ = MakeRcPtr<List>(sync_policy_);
+    }
+  }
 
   ~Event() = default;
 
@@ -58,6 +70,9 @@ class Event<void(TArgs...)> {
    * subscriptions.
    */
   void Emit(TArgs... args) {
+    if (!events_list_) {
+      return;
+    }
     EmitImpl(events_list_, std::forward<TArgs>(args)...);
   }
 
@@ -67,6 +82,9 @@ class Event<void(TArgs...)> {
    * returns event deleter
    */
   auto Add(EventHandler<CallbackSignature>&& handler) {
+    if (!events_list_) {
+      events_list_ = MakeRcPtr<List>(sync_policy_);
+    }
     auto index = events_list_->Insert(std::move(handler));
     return EventHandlerDeleter{events_list_, index};
   }
@@ -87,6 +105,7 @@ class Event<void(TArgs...)> {
     }
   }
 
+  EventSyncPolicy sync_policy_;
   RcPtr<List> events_list_;
 };
 
@@ -31,6 +31,8 @@
 
 #include <chrono>
 #include <functional>
+#include <algorithm>
+#include <cstddef>
 #include <cstdint>
 #include <cstring>
 #include <deque>
@@ -49,6 +51,7 @@
 #include "aether-miscpp/reflect/domain_visitor.h"  // IWYU pragma: keep
 #include "aether-miscpp/reflect/reflect.h"
 #include "aether/clock.h"
+#include "aether/type_traits.h"
 #include "aether/types/nullable_type.h"
 
 namespace ae {
@@ -147,6 +150,51 @@ struct has_imstream<
     std::void_t<decltype(std::declval<imstream<Ib>&>() >> std::declval<T&>())>>
     : std::true_type {};
 
+/**
+ * \brief IBuffer knows the count of bytes left to read.
+ * struct BoundedIBuffer : IBuffer {
+ * size_t remaining() const;
+ * };
+ * Sizes read from such a buffer are checked before memory allocation.
+ */
+template <typename Ib, typename Enable = void>
+struct is_bounded_ibuffer : std::false_type {};
+
+template <typename Ib>
+struct is_bounded_ibuffer<
+    Ib, std::void_t<decltype(std::declval<Ib const&>().remaining())>>
+    : std::true_type {};
+
+/**
+ * \brief Check if the input has enough bytes for count elements of
+ * element_size.
+ * Sets read result to kNo if it has not. Always true for not bounded buffers.
+ */
+template <typename Ib>
+bool can_read(imstream<Ib>& s, std::size_t count, std::size_t element_size) {
+  if constexpr (is_bounded_ibuffer<Ib>::value) {
+    if ((element_size != 0) && (count > (s.ib_.remaining() / element_size))) {
+      s.result(ReadResult::kNo);
+      return false;
+    }
+  }
+  return true;
+}
+
+/**
+ * \brief Count of elements to reserve before reading them one by one.
+ * For bounded buffers it's not more than bytes left, as an element is at least
+ * one byte in practice.
+ */
+template <typename Ib>
+std::size_t reserve_count(imstream<Ib>& s, std::size_t count) {
+  if constexpr (is_bounded_ibuffer<Ib>::value) {
+    return std::min(count, s.ib_.remaining());
+  } else {
+    return count;
+  }
+}
+
 /*********************** operator << implementation **************** */
 template <typename T, typename Ob>
 omstream_enable_if_t<!std::is_enum<T>::value && std::is_arithmetic<T>::value,
@@ -225,7 +273,7 @@ template <typename Ib>
 imstream<Ib>& operator>>(imstream<Ib>& s, std::string& t) {
   typename Ib::size_type size;
   s >> size;
-  if (data_was_read(s)) {
+  if (data_was_read(s) && can_read(s, static_cast<std::size_t>(size), 1)) {
     t.resize(static_cast<size_t>(size));
     s.read(t.data(), static_cast<size_t>(size));
   }
@@ -240,7 +288,7 @@ omstream<Ob>& operator<<(omstream<Ob>& s, const std::string_view& t) {
 }
 
 template <typename T, typename Ob>
-omstream_enable_if_t<std::is_scalar_v<T>, Ob> operator<<(
+omstream_enable_if_t<IsBulkSerializable<T>::value, Ob> operator<<(
     omstream<Ob>& s, const std::vector<T>& t) {
   s << static_cast<typename Ob::size_type>(t.size());
   s.write(reinterpret_cast<uint8_t const*>(t.data()), t.size() * sizeof(T));
@@ -248,11 +296,12 @@ omstream_enable_if_t<std::is_scalar_v<T>, Ob> operator<<(
 }
 
 template <typename T, typename Ib>
-imstream_enable_if_t<std::is_scalar_v<T>, Ib> operator>>(imstream<Ib>& s,
-                                                         std::vector<T>& t) {
+imstream_enable_if_t<IsBulkSerializable<T>::value, Ib> operator>>(
+    imstream<Ib>& s, std::vector<T>& t) {
   typename Ib::size_type size;
   s >> size;
-  if (data_was_read(s)) {
+  if (data_was_read(s) &&
+      can_read(s, static_cast<std::size_t>(size), sizeof(T))) {
     t.resize(static_cast<size_t>(size));
     s.read(reinterpret_cast<uint8_t*>(t.data()), t.size() * sizeof(T));
   }
@@ -260,7 +309,7 @@ imstream_enable_if_t<std::is_scalar_v<T>, Ib> operator>>(imstream<Ib>& s,
 }
 
 template <typename T, typename Ob>
-omstream_enable_if_t<!std::is_scalar_v<T>, Ob> operator<<(
+omstream_enable_if_t<!IsBulkSerializable<T>::value, Ob> operator<<(
     omstream<Ob>& s, const std::vector<T>& t) {
   s << static_cast<typename Ob::size_type>(t.size());
   for (const T& v : t) {
@@ -270,16 +319,19 @@ omstream_enable_if_t<!std::is_scalar_v<T>, Ob> operator<<(
 }
 
 template <typename T, typename Ib>
-imstream_enable_if_t<!std::is_scalar_v<T>, Ib> operator>>(imstream<Ib>& s,
-                                                          std::vector<T>& t) {
+imstream_enable_if_t<!IsBulkSerializable<T>::value, Ib> operator>>(
+    imstream<Ib>& s, std::vector<T>& t) {
   typename Ib::size_type size;
   s >> size;
   if (!data_was_read(s)) {
     return s;
   }
-  t.resize(static_cast<std::size_t>(size));
-  for (auto& v : t) {
-    s >> v;
+  auto count = static_cast<std::size_t>(size);
+  // grow by the read elements, not by the size from the input
+  t.clear();
+  t.reserve(reserve_count(s, count));
+  for (std::size_t i = 0; i < count; ++i) {
+    s >> t.emplace_back();
     if (!data_was_read(s)) {
       break;
     }
@@ -288,35 +340,35 @@ imstream_enable_if_t<!std::is_scalar_v<T>, Ib> operator>>(imstream<Ib>& s,
 }
 
 template <size_t N, typename T, typename Ob>
-omstream_enable_if_t<std::is_scalar_v<T>, Ob> operator<<(omstream<Ob>& s,
-                                                         T const (&t)[N]) {
+omstream_enable_if_t<IsBulkSerializable<T>::value, Ob> operator<<(
+    omstream<Ob>& s, T const (&t)[N]) {
   s.write(reinterpret_cast<uint8_t const*>(t), N * sizeof(T));
   return s;
 }
 
 template <size_t N, typename T, typename Ib>
-imstream_enable_if_t<std::is_scalar_v<T>, Ib> operator>>(imstream<Ib>& s,
-                                                         T (&t)[N]) {
+imstream_enable_if_t<IsBulkSerializable<T>::value, Ib> operator>>(
+    imstream<Ib>& s, T (&t)[N]) {
   s.read(reinterpret_cast<uint8_t*>(t), N * sizeof(T));
   return s;
 }
 
 template <size_t N, typename T, typename Ob>
-omstream_enable_if_t<std::is_scalar_v<T>, Ob> operator<<(
+omstream_enable_if_t<IsBulkSerializable<T>::value, Ob> operator<<(
     omstream<Ob>& s, const std::array<T, N>& t) {
   s.write(reinterpret_cast<uint8_t const*>(t.data()), t.size() * sizeof(T));
   return s;
 }
 
 template <size_t N, typename T, typename Ib>
-imstream_enable_if_t<std::is_scalar_v<T>, Ib> operator>>(imstream<Ib>& s,
-                                                         std::array<T, N>& t) {
+imstream_enable_if_t<IsBulkSerializable<T>::value, Ib> operator>>(
+    imstream<Ib>& s, std::array<T, N>& t) {
   s.read(reinterpret_cast<uint8_t*>(t.data()), t.size() * sizeof(T));
   return s;
 }
 
 template <size_t N, typename T, typename Ob>
-omstream_enable_if_t<!std::is_scalar_v<T>, Ob> operator<<(
+omstream_enable_if_t<!IsBulkSerializable<T>::value, Ob> operator<<(
     omstream<Ob>& s, const std::array<T, N>& t) {
   for (const T& v : t) {
     s << v;
@@ -325,8 +377,8 @@ omstream_enable_if_t<!std::is_scalar_v<T>, Ob> operator<<(
 }
 
 template <size_t N, typename T, typename Ib>
-imstream_enable_if_t<!std::is_scalar_v<T>, Ib> operator>>(imstream<Ib>& s,
-                                                          std::array<T, N>& t) {
+imstream_enable_if_t<!IsBulkSerializable<T>::value, Ib> operator>>(
+    imstream<Ib>& s, std::array<T, N>& t) {
   for (auto& v : t) {
     s >> v;
     if (!data_was_read(s)) {
@@ -380,8 +432,8 @@ imstream<Ib>& operator>>(imstream<Ib>& s, std::unordered_map<T1, T2>& t) {
     return s;
   }
   t.clear();
-  t.reserve(static_cast<size_t>(size));
-  for (auto i = 0; i < static_cast<size_t>(size); ++i) {
+  t.reserve(reserve_count(s, static_cast<size_t>(size)));
+  for (std::size_t i = 0; i < static_cast<size_t>(size); ++i) {
     std::pair<T1, T2> kv;
     s >> kv;
     if (!data_was_read(s)) {
@@ -419,10 +471,10 @@ imstream<Ib>& operator>>(imstream<Ib>& s, std::deque<T>& t) {
   if (!data_was_read(s)) {
     return s;
   }
-  t.resize(static_cast<size_t>(size));
-
-  for (auto& v : t) {
-    s >> v;
+  auto count = static_cast<std::size_t>(size);
+  t.clear();
+  for (std::size_t i = 0; i < count; ++i) {
+    s >> t.emplace_back();
     if (!data_was_read(s)) {
       break;
     }
@@ -17,10 +17,13 @@
 #ifndef AETHER_MSTREAM_BUFFERS_H_
 #define AETHER_MSTREAM_BUFFERS_H_
 
+#include <array>
 #include <vector>
 #include <cstdint>
+#include <cstring>
 
 #include "aether/mstream.h"
+#include "aether/types/span.h"
 #include "aether/memory_buffer.h"
 
 namespace ae {
@@ -63,6 +66,51 @@ struct VectorReader {
     return size;
   }
 
+  std::size_t remaining() const { return data_.size() - offset_; }
+
+  ReadResult result() const { return result_; }
+  void result(ReadResult result) { result_ = result; }
+};
+
+/**
+ * \brief Reader over the not owned memory, e.g. to parse data in place.
+ */
+template <typename SizeType = std::uint32_t>
+struct SpanReader {
+  using size_type = SizeType;
+  Span<std::uint8_t const> data_;
+  std::size_t offset_ = 0;
+  ReadResult result_{};
+
+  explicit SpanReader(Span<std::uint8_t const> data) : data_(data) {}
+
+  size_t read(void* data, size_t size) {
+    if (offset_ + size > data_.size()) {
+      result_ = ReadResult::kNo;
+      return 0;
+    }
+    std::memcpy(data, data_.data() + offset_, size);
+    offset_ += size;
+    result_ = ReadResult::kYes;
+    return size;
+  }
+
+  /**
+   * \brief Take the next size bytes in place, without copying.
+   */
+  Span<std::uint8_t const> borrow(std::size_t size) {
+    if (offset_ + size > data_.size()) {
+      result_ = ReadResult::kNo;
+      return {};
+    }
+    auto res = data_.sub(offset_, size);
+    offset_ += size;
+    result_ = ReadResult::kYes;
+    return res;
+  }
+
+  std::size_t remaining() const { return data_.size() - offset_; }
+
   ReadResult result() const { return result_; }
   void result(ReadResult result) { result_ = result; }
 };
@@ -94,6 +142,31 @@ struct LimitVectorWriter {
   bool end = false;
 };
 
+/**
+ * \brief Writer to the fixed size inline buffer, e.g. for small headers.
+ * Writes nothing if data does not fit.
+ */
+template <std::size_t Capacity, typename SizeType = std::uint32_t>
+struct ArrayWriter {
+  using size_type = SizeType;
+
+  std::size_t write(void const* data, std::size_t size) {
+    if ((written + size) > Capacity) {
+      return 0;
+    }
+    std::memcpy(buffer.data() + written, data, size);
+    written += size;
+    return size;
+  }
+
+  Span<std::uint8_t const> span() const {
+    return Span{buffer.data(), written};
+  }
+
+  std::array<std::uint8_t, Capacity> buffer;
+  std::size_t written = 0;
+};
+
 template <typename SizeType = std::uint32_t>
 struct MemStreamReader {
   using size_type = SizeType;
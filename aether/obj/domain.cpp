@@ -107,17 +107,13 @@ Ptr<Obj> Domain::ConstructObj(Factory const& factory, ObjId obj_id) {
   return o;
 }
 
-bool Domain::IsLast(uint32_t class_id) const {
-  return registry_->relations.find(class_id) == registry_->relations.end();
-}
-
 bool Domain::IsExisting(uint32_t class_id) const {
   return registry_->IsExisting(class_id);
 }
 
 Ptr<Obj> Domain::Find(ObjId obj_id) const {
-  if (auto it = id_objects_.find(obj_id.id()); it != id_objects_.end()) {
-    return it->second.Lock();
+  if (auto const* obj = id_objects_.Find(obj_id.id()); obj != nullptr) {
+    return obj->Lock();
   }
   return {};
 }
@@ -126,7 +122,7 @@ void Domain::AddObject(ObjId id, Ptr<Obj> const& obj) {
   id_objects_[id.id()] = obj;
 }
 
-void Domain::RemoveObject(Obj* ptr) { id_objects_.erase(ptr->obj_id.id()); }
+void Domain::RemoveObject(Obj* ptr) { id_objects_.Erase(ptr->obj_id.id()); }
 
 Factory* Domain::GetMostRelatedFactory(ObjId id) {
   auto classes = storage_->Enumerate(id);
@@ -152,33 +148,20 @@ Factory* Domain::GetMostRelatedFactory(ObjId id) {
     return nullptr;
   }
 
-  // Build inheritance chain.
-  // from base to derived.
-  std::sort(std::begin(classes), std::end(classes),
-            [this](auto left, auto right) {
-              if (registry_->GenerationDistance(right, left) > 0) {
-                return false;
-              }
-              if (registry_->GenerationDistance(left, right) >= 0) {
-                return true;
-              }
-              // All classes must be in one inheritance chain.
-              assert(false);
-              return false;
-            });
-
-  // Find the Final class for the most derived class provided and create it.
-  for (auto& f : registry_->factories) {
-    if (IsLast(f.first)) {
-      // check with most derived class
-      int distance = registry_->GenerationDistance(classes.back(), f.first);
-      if (distance >= 0) {
-        return &f.second;
-      }
-    }
-  }
-
-  return nullptr;
+  // The most derived class of inheritance chain.
+  auto most_derived = *std::max_element(
+      std::begin(classes), std::end(classes), [this](auto left, auto right) {
+        return registry_->GenerationDistance(left, right) > 0;
+      });
+  // All classes must be in one inheritance chain.
+  assert(std::all_of(std::begin(classes), std::end(classes),
+                     [this, most_derived](auto c) {
+                       return registry_->GenerationDistance(
+                                  c, most_derived) >= 0;
+                     }));
+
+  // Create the Final class for the most derived class provided.
+  return registry_->FindFinalFactory(most_derived);
 }
 
 Factory* Domain::FindClassFactory(std::uint32_t class_id) {
@@ -17,8 +17,6 @@
 #ifndef AETHER_OBJ_DOMAIN_H_
 #define AETHER_OBJ_DOMAIN_H_
 
-#include <map>
-#include <set>
 #include <cstdint>
 #include <cassert>
 #include <utility>
@@ -29,6 +27,7 @@
 #include "aether/mstream.h"
 
 #include "aether/ptr/ptr_view.h"
+#include "aether/types/flat_hash_map.h"
 #include "aether-miscpp/reflect/reflect.h"
 #include "aether-miscpp/reflect/domain_visitor.h"
 
@@ -43,24 +42,13 @@ class Domain;
 class DomainGraph;
 
 struct DomainCycleDetector {
-  struct Node {
-    bool operator==(const Node& other) const {
-      return id == other.id && class_id == other.class_id;
-    }
-    bool operator<(const Node& other) const {
-      return id < other.id || (id == other.id && class_id < other.class_id);
-    }
-
-    ObjId id;
-    std::uint32_t class_id;
-  };
-
   bool Add(std::uint32_t class_id, ObjId obj_id) {
-    auto [_, ok] = visited_nodes.insert(Node{obj_id, class_id});
-    return ok;
+    // object is visited once for each class of its inheritance chain
+    return visited_nodes.Insert(
+        (static_cast<std::uint64_t>(obj_id.id()) << 32) | class_id);
   }
 
-  std::set<Node> visited_nodes;
+  FlatHashSet<std::uint64_t> visited_nodes;
 };
 
 class DomainStorageReaderEmpty final : public IDomainStorageReader {
@@ -147,7 +135,6 @@ class Domain {
  private:
   Ptr<Obj> ConstructObj(Factory const& factory, ObjId id);
 
-  bool IsLast(uint32_t class_id) const;
   bool IsExisting(uint32_t class_id) const;
 
   Factory* FindClassFactory(std::uint32_t class_id);
@@ -157,7 +144,7 @@ class Domain {
   IDomainStorage* storage_;
   Registry* registry_;
 
-  std::map<ObjId::Type, PtrView<Obj>> id_objects_;
+  FlatHashMap<ObjId::Type, PtrView<Obj>> id_objects_;
 };
 
 template <typename T>
@@ -16,6 +16,8 @@
 
 #include "aether/obj/registry.h"
 
+#include <vector>
+#include <cassert>
 #include <utility>
 
 #include "aether-miscpp/crc.h"
@@ -42,62 +44,128 @@ void Registry::RegisterClass(uint32_t cls_id, std::uint32_t base_id,
   // Refer to
   // https://learn.microsoft.com/en-us/cpp/overview/compiler-versions?view=msvc-170
 #  if !defined(_MSC_VER) || _MSC_VER >= 1920
-  auto no_duplication = factories.find(cls_id) == factories.end();
+  auto no_duplication = !factories.Contains(cls_id);
   assert(no_duplication && "Duplicate class id in registry");
 #  endif  // !defined(_MSC_VER) || _MSC_VER >= 1920
 #endif    // DEBUG
-  factories.emplace(cls_id, std::move(factory));
+  auto lock = std::scoped_lock{lock_};
+  auto [slot, inserted] = factories.Insert(cls_id);
+  if (!inserted) {
+    return;
+  }
+  *slot = std::move(factory);
   // TODO: maybe remove this check
   if (base_id != crc32::from_literal("Obj").value) {
     relations[base_id].push_back(cls_id);
   }
+  class_table_dirty_ = true;
 }
 
 bool Registry::IsExisting(uint32_t class_id) {
-  return factories.find(class_id) != factories.end();
+  return factories.Contains(class_id);
 }
 
-int Registry::GenerationDistanceInternal(std::uint32_t base_id,
-                                         std::uint32_t derived_id) {
-  auto d = relations.find(base_id);
-  // The base class is final.
-  if (d == relations.end()) {
+int Registry::GenerationDistance(std::uint32_t base_id,
+                                 std::uint32_t derived_id) {
+  if (!IsExisting(base_id) || !IsExisting(derived_id)) {
     return -1;
   }
 
-  for (auto& c : d->second) {
-    if (derived_id == c) {
-      return 1;
-    }
-
-    int distance = GenerationDistanceInternal(c, derived_id);
-    if (distance >= 0) {
-      return distance + 1;
-    }
+  auto base = FindClassInfo(base_id);
+  auto derived = FindClassInfo(derived_id);
+  assert(base && derived);
+  // derived is not in the base's subtree
+  if ((derived->enter < base->enter) || (derived->enter >= base->exit)) {
+    return -1;
   }
+  return static_cast<int>(derived->depth - base->depth);
+}
 
-  return -1;
+Factory* Registry::FindFactory(std::uint32_t base_id) {
+  return factories.Find(base_id);
 }
 
-int Registry::GenerationDistance(std::uint32_t base_id,
-                                 std::uint32_t derived_id) {
-  if (!IsExisting(base_id) || !IsExisting(derived_id)) {
-    return -1;
+Factory* Registry::FindFinalFactory(std::uint32_t class_id) {
+  auto info = FindClassInfo(class_id);
+  if (!info || !info->final_id) {
+    return nullptr;
   }
+  return factories.Find(*info->final_id);
+}
 
-  if (base_id == derived_id) {
-    return 0;
+std::optional<Registry::ClassInfo> Registry::FindClassInfo(
+    std::uint32_t class_id) {
+  auto lock = std::scoped_lock{lock_};
+  if (class_table_dirty_) {
+    BuildClassTable();
   }
-
-  return GenerationDistanceInternal(base_id, derived_id);
+  auto const* info = class_table_.Find(class_id);
+  if (info == nullptr) {
+    return std::nullopt;
+  }
+  return *info;
 }
 
-Factory* Registry::FindFactory(std::uint32_t base_id) {
-  auto it = factories.find(base_id);
-  if (it == factories.end()) {
-    return nullptr;
+void Registry::BuildClassTable() {
+  class_table_.Clear();
+  class_table_dirty_ = false;
+
+  // the roots of inheritance forest are the classes with no registered base
+  auto derived = FlatHashSet<std::uint32_t>{};
+  relations.ForEach([&](auto, auto const& children) {
+    for (auto c : children) {
+      derived.Insert(c);
+    }
+  });
+  auto roots = std::vector<std::uint32_t>{};
+  factories.ForEach([&](auto cls_id, auto const&) {
+    if (!derived.Contains(cls_id)) {
+      roots.push_back(cls_id);
+    }
+  });
+  relations.ForEach([&](auto cls_id, auto const&) {
+    if (!derived.Contains(cls_id) && !factories.Contains(cls_id)) {
+      roots.push_back(cls_id);
+    }
+  });
+
+  // depth first walk, with the class and index of its next child
+  std::uint32_t order = 0;
+  auto stack = std::vector<std::pair<std::uint32_t, std::size_t>>{};
+  auto enter = [&](std::uint32_t cls_id, std::uint32_t depth) {
+    class_table_[cls_id] = ClassInfo{depth, order++, 0, std::nullopt};
+    stack.emplace_back(cls_id, 0);
+  };
+
+  for (auto root : roots) {
+    enter(root, 0);
+    while (!stack.empty()) {
+      auto [cls_id, next] = stack.back();
+      auto const* children = relations.Find(cls_id);
+      if ((children != nullptr) && (next < children->size())) {
+        stack.back().second = next + 1;
+        enter((*children)[next], class_table_.Find(cls_id)->depth + 1);
+        continue;
+      }
+      stack.pop_back();
+
+      auto* info = class_table_.Find(cls_id);
+      info->exit = order;
+      if (children == nullptr) {
+        // final class
+        if (factories.Contains(cls_id)) {
+          info->final_id = cls_id;
+        }
+        continue;
+      }
+      for (auto c : *children) {
+        if (auto final_id = class_table_.Find(c)->final_id; final_id) {
+          info->final_id = final_id;
+          break;
+        }
+      }
+    }
   }
-  return &it->second;
 }
 
 #ifdef DEBUG
@@ -115,10 +183,10 @@ std::string_view Registry::ClassName(std::uint32_t class_id) {
 
 void Registry::Log() {
 #ifdef DEBUG
-  for (const auto& c : factories) {
+  factories.ForEach([](auto, auto const& factory) {
     AE_TELE_DEBUG(ObjectRegistryLog, "name {}, id {}, base_id {}",
-                  c.second.class_name, c.second.cls_id, c.second.base_id);
-  }
+                  factory.class_name, factory.cls_id, factory.base_id);
+  });
 #endif  // DEBUG
 }
 
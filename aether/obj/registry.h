@@ -17,14 +17,16 @@
 #ifndef AETHER_OBJ_REGISTRY_H_
 #define AETHER_OBJ_REGISTRY_H_
 
+#include <mutex>
 #include <cstdint>
 #include <vector>
 #include <string>
-#include <unordered_map>
+#include <optional>
 
 #include "aether/config.h"
 #include "aether/ptr/ptr.h"
 #include "aether/obj/obj_id.h"
+#include "aether/types/flat_hash_map.h"
 
 namespace ae {
 class Obj;
@@ -49,8 +51,10 @@ struct Factory {
 
 class Registry {
  public:
-  using Relations = std::unordered_map<uint32_t, std::vector<uint32_t>>;
-  using Factories = std::unordered_map<uint32_t, Factory>;
+  using Relations = FlatHashMap<uint32_t, std::vector<uint32_t>>;
+  // factories are moved on registration, keep pointers only after all classes
+  // are registered
+  using Factories = FlatHashMap<uint32_t, Factory>;
 
   static Registry& GetRegistry();
 
@@ -58,15 +62,15 @@ class Registry {
   void Log();
   bool IsExisting(uint32_t class_id);
 
-  int GenerationDistanceInternal(std::uint32_t base_id,
-                                 std::uint32_t derived_id);
-
   // Calculates distance from base to derived in generations:
   //  -1 - derived is not inherited directly or indirectly from base or any
   //  class doesn't exist.
   int GenerationDistance(std::uint32_t base_id, std::uint32_t derived_id);
 
   Factory* FindFactory(uint32_t base_id);
+  // Factory of a final class derived from class_id or class_id itself if it's
+  // final
+  Factory* FindFinalFactory(std::uint32_t class_id);
 
 #ifdef DEBUG
   std::string_view ClassName(std::uint32_t class_id);
@@ -74,6 +78,28 @@ class Registry {
 
   Relations relations;
   Factories factories;
+
+ private:
+  // class place in the inheritance forest
+  struct ClassInfo {
+    std::uint32_t depth;
+    // preorder indices, derived classes are in [enter, exit)
+    std::uint32_t enter;
+    std::uint32_t exit;
+    // id of the final class factory, factories are moved on registration so
+    // it's found by id
+    std::optional<std::uint32_t> final_id;
+  };
+
+  // a copy, the table may be rebuilt by the other thread
+  std::optional<ClassInfo> FindClassInfo(std::uint32_t class_id);
+  // classes are registered by static initialization, so the table is built
+  // once on the first query, guarded by lock_
+  void BuildClassTable();
+
+  std::mutex lock_;
+  FlatHashMap<std::uint32_t, ClassInfo> class_table_;
+  bool class_table_dirty_ = true;
 };
 }  // namespace ae
 
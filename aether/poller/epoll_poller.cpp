@@ -23,9 +23,12 @@
 #  include <sys/epoll.h>
 #  include <sys/eventfd.h>
 
-#  include <array>
 #  include <cerrno>
+#  include <cassert>
 #  include <cstring>
+#  include <utility>
+#  include <algorithm>
+#  include <functional>
 
 #  include "aether/poller/poller_tele.h"
 
@@ -61,27 +64,46 @@ EventType EpollEventToEventType(std::uint32_t event_flags) {
 
 }  // namespace epoll_poller_internal
 
-EpollImpl::EpollImpl()
-    : epoll_fd_{InitEpoll()},
-      event_fd_{MakeEventFd()},
-      thread_(&EpollImpl::Loop, this) {
+EpollImpl::EpollImpl() : EpollImpl{Config{}} {}
+
+EpollImpl::EpollImpl(Config config)
+    : config_{config}, event_fd_{MakeEventFd()} {
   AE_TELE_INFO(kEpollWorkerCreate);
 
-  auto lock = std::scoped_lock{poller_mutex_};
-  // add wake up fd to epoll
-  if (event_fd_ != -1) {
-    Callback(DescriptorType{event_fd_}, [](auto, auto) {});
-    Event(DescriptorType{event_fd_}, EventType::kRead | EventType::kError);
+  config_.shards = std::max(config_.shards, std::size_t{1});
+  config_.max_events = std::max(config_.max_events, std::size_t{1});
+
+  shards_.reserve(config_.shards);
+  for (std::size_t i = 0; i < config_.shards; ++i) {
+    auto& shard = *shards_.emplace_back(std::make_unique<Shard>());
+    shard.epoll_fd = InitEpoll();
+    // add wake up fd to each epoll
+    if ((event_fd_ != -1) && (shard.epoll_fd != -1)) {
+      struct epoll_event epoll_event{};
+      epoll_event.events = EPOLLIN | EPOLLET;
+      epoll_event.data.fd = event_fd_;
+      auto res =
+          epoll_ctl(shard.epoll_fd, EPOLL_CTL_ADD, event_fd_, &epoll_event);
+      if (res < 0) {
+        AE_TELE_ERROR(kEpollAddFailed, "Failed to add to epoll {} {}", errno,
+                      strerror(errno));
+        assert(false);
+      }
+    }
+  }
+  // start workers after all shards are ready
+  for (auto& shard : shards_) {
+    shard->thread = std::thread(&EpollImpl::Loop, this, std::ref(*shard));
   }
 }
 
 EpollImpl::~EpollImpl() {
-  AE_TELED_DEBUG("Destroy EpollImpl event fd {}, thread is joinable {}",
-                 event_fd_, thread_.joinable());
+  AE_TELED_DEBUG("Destroy EpollImpl event fd {}, shards {}", event_fd_,
+                 shards_.size());
 
   stop_requested_ = true;
   if (event_fd_ != -1) {
-    // write something
+    // write something, it wakes up all the shards
     std::uint64_t b{1};
     auto res = write(event_fd_, &b, sizeof(b));
     if (res != sizeof(b)) {
@@ -90,12 +112,13 @@ EpollImpl::~EpollImpl() {
     }
   }
 
-  if (thread_.joinable()) {
-    thread_.join();
-  }
-
-  if (epoll_fd_ != -1) {
-    close(epoll_fd_);
+  for (auto& shard : shards_) {
+    if (shard->thread.joinable()) {
+      shard->thread.join();
+    }
+    if (shard->epoll_fd != -1) {
+      close(shard->epoll_fd);
+    }
   }
   if (event_fd_ != -1) {
     close(event_fd_);
@@ -103,18 +126,25 @@ EpollImpl::~EpollImpl() {
   AE_TELE_INFO(kEpollWorkerDestroyed);
 }
 
-void EpollImpl::lock() { poller_mutex_.lock(); }
-void EpollImpl::unlock() { poller_mutex_.unlock(); }
+void EpollImpl::Lock(DescriptorType fd) { ShardOf(fd).mutex.lock(); }
+void EpollImpl::Unlock(DescriptorType fd) { ShardOf(fd).mutex.unlock(); }
 
 void EpollImpl::Callback(DescriptorType fd, EventCb cb) {
   AE_TELE_DEBUG(kEpollAddDescriptor, "Poller callback for fd:{}", fd);
-  event_map_.emplace(fd, EventHandler{.cb = std::move(cb), .events = {}});
+  auto& shard = ShardOf(fd);
+  auto index = static_cast<std::size_t>(fd) / config_.shards;
+  if (index >= shard.handlers.size()) {
+    shard.handlers.resize(index + 1);
+  }
+  shard.handlers[index] =
+      EventHandler{.cb = std::move(cb), .events = {}, .registered = true};
 }
 
 void EpollImpl::Event(DescriptorType fd, EventType events) {
   AE_TELED_DEBUG("Poller event for fd:{} events: {}", fd, events);
-  auto it = event_map_.find(fd);
-  if (it == event_map_.end()) {
+  auto& shard = ShardOf(fd);
+  auto* handler = Handler(shard, fd);
+  if (handler == nullptr) {
     assert(false && "Callback should setup first");
     return;
   }
@@ -125,29 +155,30 @@ void EpollImpl::Event(DescriptorType fd, EventType events) {
   epoll_event.events |= EPOLLET;
   epoll_event.data.fd = fd;
 
-  int op = (it->second.events == EventType{}) ? EPOLL_CTL_ADD : EPOLL_CTL_MOD;
-  auto res = epoll_ctl(epoll_fd_, op, fd, &epoll_event);
+  int op = (handler->events == EventType{}) ? EPOLL_CTL_ADD : EPOLL_CTL_MOD;
+  auto res = epoll_ctl(shard.epoll_fd, op, fd, &epoll_event);
   if (res < 0) {
     AE_TELE_ERROR(kEpollAddFailed, "Failed to add to epoll {} {}", errno,
                   strerror(errno));
     assert(false);
   }
-  it->second.events = events;
+  handler->events = events;
 }
 
 void EpollImpl::Remove(DescriptorType fd) {
   AE_TELE_DEBUG(kEpollRemoveDescriptor, "Remove poller event {}", fd);
 
-  auto it = event_map_.find(fd);
-  if (it == event_map_.end()) {
+  auto& shard = ShardOf(fd);
+  auto* handler = Handler(shard, fd);
+  if (handler == nullptr) {
     // nothing to remove
     return;
   }
 
-  if (it->second.events != EventType{}) {
+  if (handler->events != EventType{}) {
     // if events not empty, remove from epol_ctl also
     struct epoll_event epoll_event{};
-    auto res = epoll_ctl(epoll_fd_, EPOLL_CTL_DEL, fd, &epoll_event);
+    auto res = epoll_ctl(shard.epoll_fd, EPOLL_CTL_DEL, fd, &epoll_event);
     if (res < 0) {
       if (errno != ENOENT) {
         AE_TELE_ERROR(kEpollRemoveFailed, "Failed to remove from epoll {} {}",
@@ -157,7 +188,23 @@ void EpollImpl::Remove(DescriptorType fd) {
     }
   }
 
-  event_map_.erase(fd);
+  *handler = EventHandler{};
+}
+
+EpollImpl::Shard& EpollImpl::ShardOf(DescriptorType fd) {
+  return *shards_[static_cast<std::size_t>(fd) % shards_.size()];
+}
+
+EpollImpl::EventHandler* EpollImpl::Handler(Shard& shard,
+                                            DescriptorType fd) const {
+  if (fd < 0) {
+    return nullptr;
+  }
+  auto index = static_cast<std::size_t>(fd) / config_.shards;
+  if ((index >= shard.handlers.size()) || !shard.handlers[index].registered) {
+    return nullptr;
+  }
+  return &shard.handlers[index];
 }
 
 int EpollImpl::MakeEventFd() {
@@ -183,12 +230,12 @@ int EpollImpl::InitEpoll() {
   return fd;
 }
 
-void EpollImpl::Loop() {
-  static constexpr std::size_t kMaxEvents = 10;
-  std::array<struct epoll_event, kMaxEvents> events;
+void EpollImpl::Loop(Shard& shard) {
+  std::vector<struct epoll_event> events(config_.max_events);
 
   while (!stop_requested_) {
-    auto res = epoll_wait(epoll_fd_, events.data(), events.size(), -1);
+    auto res = epoll_wait(shard.epoll_fd, events.data(),
+                          static_cast<int>(events.size()), -1);
     if (res < 0) {
       if (errno == EINTR) {
         continue;
@@ -199,21 +246,21 @@ void EpollImpl::Loop() {
       continue;
     }
 
-    auto lock = std::scoped_lock{poller_mutex_};
+    auto lock = std::scoped_lock{shard.mutex};
 
     for (std::size_t i = 0;
-         (i < static_cast<std::size_t>(res)) && (i < kMaxEvents); ++i) {
+         (i < static_cast<std::size_t>(res)) && (i < events.size()); ++i) {
       auto& event = events[i];
       auto fd = event.data.fd;
       if (fd == event_fd_) {
         continue;
       }
-      auto poller_event = event_map_.find(fd);
-      if (poller_event == event_map_.end()) {
+      auto* handler = Handler(shard, fd);
+      if (handler == nullptr) {
         continue;
       }
       auto ev_type = epoll_poller_internal::EpollEventToEventType(event.events);
-      poller_event->second.cb(fd, ev_type);
+      handler->cb(fd, ev_type);
     }
   }
 }
@@ -222,9 +269,12 @@ EpollPoller::EpollPoller() = default;
 
 EpollPoller::EpollPoller(ObjProp prop) : IPoller{prop} {}
 
+EpollPoller::EpollPoller(ObjProp prop, EpollImpl::Config config)
+    : IPoller{prop}, config_{config} {}
+
 std::shared_ptr<NativePoller> EpollPoller::Native() {
   if (!impl_) {
-    impl_ = std::make_shared<EpollImpl>();
+    impl_ = std::make_shared<EpollImpl>(config_);
   }
   return impl_;
 }
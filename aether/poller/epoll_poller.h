@@ -21,44 +21,73 @@
 #  define EPOLL_POLLER_ENABLED 1
 
 #  include <mutex>
+#  include <deque>
 #  include <thread>
 #  include <atomic>
 #  include <memory>
+#  include <vector>
+#  include <cstddef>
 
+#  include "aether/config.h"
 #  include "aether/poller/poller.h"
 #  include "aether/poller/unix_poller.h"
 
 namespace ae {
+/**
+ * \brief Epoll based poller.
+ * Descriptors are distributed between shards by fd value, each shard has its
+ * own epoll instance, worker thread and lock. Callbacks for descriptors from
+ * different shards may be called concurrently.
+ */
 class EpollImpl final : public UnixPollerImpl {
+ public:
+  struct Config {
+    // count of epoll worker threads
+    std::size_t shards = AE_EPOLL_POLLER_SHARDS;
+    // max count of events handled by one epoll_wait
+    std::size_t max_events = AE_EPOLL_POLLER_MAX_EVENTS;
+  };
+
+ private:
   struct EventHandler {
     EventCb cb;
     EventType events;
+    bool registered;
+  };
+
+  struct Shard {
+    int epoll_fd;
+    std::recursive_mutex mutex;
+    // handlers indexed by fd / shards count, deque keeps them in place on grow
+    std::deque<EventHandler> handlers;
+    std::thread thread;
   };
 
  public:
   EpollImpl();
+  explicit EpollImpl(Config config);
   ~EpollImpl() override;
 
  private:
-  void lock() override;
-  void unlock() override;
+  void Lock(DescriptorType fd) override;
+  void Unlock(DescriptorType fd) override;
 
   void Callback(DescriptorType fd, EventCb cb) override;
   void Event(DescriptorType fd, EventType events) override;
   void Remove(DescriptorType fd) override;
 
+  Shard& ShardOf(DescriptorType fd);
+  EventHandler* Handler(Shard& shard, DescriptorType fd) const;
+
   static int InitEpoll();
   static int MakeEventFd();
-  void EmptyWakeUpPipe(EventType event);
-  void Loop();
+  void Loop(Shard& shard);
 
-  int epoll_fd_;
+  Config config_;
   int event_fd_;
-  std::recursive_mutex poller_mutex_;
-  std::map<DescriptorType, EventHandler> event_map_;
+  std::vector<std::unique_ptr<Shard>> shards_;
 
   std::atomic_bool stop_requested_{false};
-  std::thread thread_;
 };
 
 class EpollPoller : public IPoller {
@@ -68,12 +97,18 @@ class EpollPoller : public IPoller {
 
  public:
   explicit EpollPoller(ObjProp prop);
+  /**
+   * \brief Poller with not default shards and events batch configuration.
+   * The configuration is not saved with the object.
+   */
+  EpollPoller(ObjProp prop, EpollImpl::Config config);
 
   AE_OBJECT_REFLECT()
 
   std::shared_ptr<NativePoller> Native() override;
 
  private:
+  EpollImpl::Config config_;
   std::shared_ptr<EpollImpl> impl_;
 };
 
@@ -0,0 +1,503 @@
+/*
+ * Copyright 2026 Aethernet Inc.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "aether/poller/io_uring_poller.h"
+
+#if defined IO_URING_POLLER_ENABLED
+
+#  include <poll.h>
+#  include <unistd.h>
+#  include <sys/mman.h>
+#  include <sys/eventfd.h>
+#  include <sys/syscall.h>
+#  include <linux/io_uring.h>
+
+#  include <bit>
+#  include <cerrno>
+#  include <cstring>
+#  include <utility>
+#  include <cassert>
+#  include <algorithm>
+
+#  include "aether/poller/epoll_poller.h"
+#  include "aether/poller/poller_tele.h"
+
+namespace ae {
+namespace io_uring_poller_internal {
+std::uint32_t PollerEventsToPollMask(EventType event) {
+  std::uint32_t mask = 0;
+  if ((event & EventType::kRead) != 0) {
+    mask |= POLLIN;
+  }
+  if ((event & EventType::kWrite) != 0) {
+    mask |= POLLOUT;
+  }
+  // POLLPRI is not requested, socket wake ups report it with any incoming data
+  if ((event & EventType::kError) != 0) {
+    mask |= POLLRDHUP | POLLERR | POLLHUP;
+  }
+  // kernel reads poll mask as two swapped half words on big endian
+  if constexpr (std::endian::native == std::endian::big) {
+    mask = (mask << 16) | (mask >> 16);
+  }
+  return mask;
+}
+
+EventType PollMaskToEventType(std::uint32_t mask) {
+  EventType event{};
+  if ((mask & POLLIN) != 0) {
+    event |= EventType::kRead;
+  }
+  if ((mask & POLLOUT) != 0) {
+    event |= EventType::kWrite;
+  }
+  if ((mask & (POLLRDHUP | POLLERR | POLLHUP)) != 0) {
+    event |= EventType::kError;
+  }
+  return event;
+}
+
+// user data is generation of poll request in high bits and fd in low bits
+constexpr std::uint64_t MakeUserData(std::uint32_t generation, int fd) {
+  return (static_cast<std::uint64_t>(generation) << 32) |
+         static_cast<std::uint32_t>(fd);
+}
+constexpr std::uint32_t UserDataGeneration(std::uint64_t user_data) {
+  return static_cast<std::uint32_t>(user_data >> 32);
+}
+constexpr int UserDataFd(std::uint64_t user_data) {
+  return static_cast<int>(static_cast<std::uint32_t>(user_data));
+}
+
+int Setup(std::uint32_t entries, io_uring_params& params) {
+  return static_cast<int>(syscall(__NR_io_uring_setup, entries, &params));
+}
+}  // namespace io_uring_poller_internal
+
+IoUringImpl::IoUringImpl()
+    : ring_{InitRing(kQueueDepth, kCqDepth)},
+      event_fd_{MakeEventFd()},
+      thread_(&IoUringImpl::Loop, this) {
+  AE_TELE_INFO(kIoUringWorkerCreate);
+
+  auto lock = std::scoped_lock{*this};
+  // add wake up fd to poller
+  if (event_fd_ != -1) {
+    Callback(DescriptorType{event_fd_}, [](auto fd, auto) {
+      std::uint64_t b{};
+      [[maybe_unused]] auto res = read(fd, &b, sizeof(b));
+    });
+    Event(DescriptorType{event_fd_}, EventType::kRead | EventType::kError);
+  }
+}
+
+IoUringImpl::~IoUringImpl() {
+  AE_TELED_DEBUG("Destroy IoUringImpl event fd {}, thread is joinable {}",
+                 event_fd_, thread_.joinable());
+
+  stop_requested_ = true;
+  if (event_fd_ != -1) {
+    std::uint64_t b{1};
+    auto res = write(event_fd_, &b, sizeof(b));
+    if (res != sizeof(b)) {
+      AE_TELED_ERROR("Failed to write to event fd {} {}", errno,
+                     strerror(errno));
+    }
+  }
+
+  if (thread_.joinable()) {
+    thread_.join();
+  }
+
+  CloseRing(ring_);
+  if (event_fd_ != -1) {
+    close(event_fd_);
+  }
+  AE_TELE_INFO(kIoUringWorkerDestroyed);
+}
+
+bool IoUringImpl::IsSupported() {
+  static bool const supported = []() {
+    io_uring_params params{};
+    auto fd = io_uring_poller_internal::Setup(1, params);
+    if (fd < 0) {
+      return false;
+    }
+    close(fd);
+    return (params.features & IORING_FEAT_NODROP) != 0;
+  }();
+  return supported;
+}
+
+void IoUringImpl::Lock(DescriptorType /* fd */) { lock(); }
+void IoUringImpl::Unlock(DescriptorType /* fd */) { unlock(); }
+
+void IoUringImpl::lock() {
+  poller_mutex_.lock();
+  ++lock_depth_;
+}
+
+void IoUringImpl::unlock() {
+  // flush all changes made under the lock by one syscall
+  // the worker thread submits its changes together with the wait
+  if ((--lock_depth_ == 0) &&
+      (std::this_thread::get_id() != thread_.get_id())) {
+    ArmDeferred();
+    if (pending_submit_ != 0) {
+      Submit();
+    }
+  }
+  poller_mutex_.unlock();
+}
+
+void IoUringImpl::Callback(DescriptorType fd, EventCb cb) {
+  AE_TELED_DEBUG("Poller callback for fd:{}", fd);
+  event_map_.emplace(fd, EventHandler{.cb = std::move(cb),
+                                      .events = {},
+                                      .armed = 0,
+                                      .deferred = false});
+}
+
+void IoUringImpl::Event(DescriptorType fd, EventType events) {
+  AE_TELED_DEBUG("Poller event for fd:{} events: {}", fd, events);
+  auto it = event_map_.find(fd);
+  if (it == event_map_.end()) {
+    assert(false && "Callback should setup first");
+    return;
+  }
+  auto& handler = it->second;
+  if ((handler.armed != 0) && (handler.events == events)) {
+    // already watched
+    return;
+  }
+  CancelPoll(fd, handler);
+  handler.events = events;
+  if (events != EventType{}) {
+    ArmPoll(fd, handler);
+  }
+}
+
+void IoUringImpl::Remove(DescriptorType fd) {
+  AE_TELED_DEBUG("Remove poller event {}", fd);
+  auto it = event_map_.find(fd);
+  if (it == event_map_.end()) {
+    // nothing to remove
+    return;
+  }
+  CancelPoll(fd, it->second);
+  event_map_.erase(it);
+}
+
+IoUringImpl::Ring IoUringImpl::InitRing(std::uint32_t entries,
+                                        std::uint32_t cq_entries) {
+  Ring ring{};
+  io_uring_params params{};
+  params.flags = IORING_SETUP_CQSIZE;
+  params.cq_entries = std::max(cq_entries, 2 * entries);
+  ring.fd = io_uring_poller_internal::Setup(entries, params);
+  if (ring.fd < 0) {
+    AE_TELE_ERROR(kIoUringInitFailed, "Failed to setup io_uring {} {}", errno,
+                  strerror(errno));
+    assert(false);
+    ring.fd = -1;
+    return ring;
+  }
+
+  ring.sq_entries = params.sq_entries;
+  ring.sq_map_size =
+      params.sq_off.array + params.sq_entries * sizeof(std::uint32_t);
+  ring.cq_map_size =
+      params.cq_off.cqes + params.cq_entries * sizeof(io_uring_cqe);
+  bool const single_mmap = (params.features & IORING_FEAT_SINGLE_MMAP) != 0;
+  if (single_mmap) {
+    ring.sq_map_size = ring.cq_map_size =
+        std::max(ring.sq_map_size, ring.cq_map_size);
+  }
+
+  ring.sq_map = mmap(nullptr, ring.sq_map_size, PROT_READ | PROT_WRITE,
+                     MAP_SHARED | MAP_POPULATE, ring.fd, IORING_OFF_SQ_RING);
+  if (ring.sq_map == MAP_FAILED) {
+    ring.sq_map = nullptr;
+  } else if (single_mmap) {
+    ring.cq_map = ring.sq_map;
+  } else {
+    ring.cq_map = mmap(nullptr, ring.cq_map_size, PROT_READ | PROT_WRITE,
+                       MAP_SHARED | MAP_POPULATE, ring.fd, IORING_OFF_CQ_RING);
+    if (ring.cq_map == MAP_FAILED) {
+      ring.cq_map = nullptr;
+    }
+  }
+  ring.sqes_map_size = params.sq_entries * sizeof(io_uring_sqe);
+  auto* sqes = mmap(nullptr, ring.sqes_map_size, PROT_READ | PROT_WRITE,
+                    MAP_SHARED | MAP_POPULATE, ring.fd, IORING_OFF_SQES);
+  if (sqes != MAP_FAILED) {
+    ring.sqes = static_cast<io_uring_sqe*>(sqes);
+  }
+
+  if ((ring.sq_map == nullptr) || (ring.cq_map == nullptr) ||
+      (ring.sqes == nullptr)) {
+    AE_TELE_ERROR(kIoUringInitFailed, "Failed to map io_uring {} {}", errno,
+                  strerror(errno));
+    assert(false);
+    CloseRing(ring);
+    return ring;
+  }
+
+  auto* sq = static_cast<std::uint8_t*>(ring.sq_map);
+  ring.sq_head = reinterpret_cast<std::uint32_t*>(sq + params.sq_off.head);
+  ring.sq_tail = reinterpret_cast<std::uint32_t*>(sq + params.sq_off.tail);
+  ring.sq_mask = reinterpret_cast<std::uint32_t*>(sq + params.sq_off.ring_mask);
+  ring.sq_array = reinterpret_cast<std::uint32_t*>(sq + params.sq_off.array);
+
+  auto* cq = static_cast<std::uint8_t*>(ring.cq_map);
+  ring.cq_head = reinterpret_cast<std::uint32_t*>(cq + params.cq_off.head);
+  ring.cq_tail = reinterpret_cast<std::uint32_t*>(cq + params.cq_off.tail);
+  ring.cq_mask = reinterpret_cast<std::uint32_t*>(cq + params.cq_off.ring_mask);
+  ring.cqes = reinterpret_cast<io_uring_cqe*>(cq + params.cq_off.cqes);
+  return ring;
+}
+
+void IoUringImpl::CloseRing(Ring& ring) {
+  if (ring.sqes != nullptr) {
+    munmap(ring.sqes, ring.sqes_map_size);
+  }
+  if ((ring.cq_map != nullptr) && (ring.cq_map != ring.sq_map)) {
+    munmap(ring.cq_map, ring.cq_map_size);
+  }
+  if (ring.sq_map != nullptr) {
+    munmap(ring.sq_map, ring.sq_map_size);
+  }
+  if (ring.fd != -1) {
+    close(ring.fd);
+  }
+  ring = Ring{};
+}
+
+int IoUringImpl::MakeEventFd() {
+  auto fd = eventfd(0, EFD_CLOEXEC | EFD_NONBLOCK);
+  if (fd < 0) {
+    AE_TELED_ERROR("Failed to create wake up event fd {} {}", errno,
+                   strerror(errno));
+    assert(false);
+    return -1;
+  }
+  return fd;
+}
+
+io_uring_sqe* IoUringImpl::GetSqe() {
+  if (ring_.fd == -1) {
+    return nullptr;
+  }
+  auto head = std::atomic_ref{*ring_.sq_head}.load(std::memory_order_acquire);
+  auto tail = *ring_.sq_tail;
+  if ((tail - head) >= ring_.sq_entries) {
+    // submission queue is full, flush it
+    Submit();
+    head = std::atomic_ref{*ring_.sq_head}.load(std::memory_order_acquire);
+    if ((tail - head) >= ring_.sq_entries) {
+      AE_TELED_ERROR("io_uring submission queue is full");
+      return nullptr;
+    }
+  }
+  auto index = tail & *ring_.sq_mask;
+  auto* sqe = &ring_.sqes[index];
+  std::memset(sqe, 0, sizeof(*sqe));
+  ring_.sq_array[index] = index;
+  return sqe;
+}
+
+void IoUringImpl::ArmPoll(DescriptorType fd, EventHandler& handler) {
+  auto* sqe = GetSqe();
+  if (sqe == nullptr) {
+    // retry after the next completions are reaped
+    if (!handler.deferred) {
+      AE_TELED_WARNING("io_uring is full, defer poll for fd {}", fd);
+      handler.deferred = true;
+      deferred_arms_.push_back(fd);
+    }
+    return;
+  }
+  handler.deferred = false;
+  // zero generation is reserved for requests without completion handling
+  if (++generation_ == 0) {
+    ++generation_;
+  }
+  sqe->opcode = IORING_OP_POLL_ADD;
+  sqe->fd = fd;
+  sqe->poll32_events =
+      io_uring_poller_internal::PollerEventsToPollMask(handler.events);
+  sqe->user_data = io_uring_poller_internal::MakeUserData(generation_, fd);
+
+  std::atomic_ref{*ring_.sq_tail}.fetch_add(1, std::memory_order_release);
+  ++pending_submit_;
+  handler.armed = generation_;
+}
+
+void IoUringImpl::ArmDeferred() {
+  if (deferred_arms_.empty()) {
+    return;
+  }
+  auto deferred = std::exchange(deferred_arms_, {});
+  for (auto fd : deferred) {
+    auto it = event_map_.find(fd);
+    if ((it == event_map_.end()) || !it->second.deferred) {
+      continue;
+    }
+    it->second.deferred = false;
+    if ((it->second.armed == 0) && (it->second.events != EventType{})) {
+      ArmPoll(fd, it->second);
+    }
+  }
+}
+
+void IoUringImpl::CancelPoll(DescriptorType fd, EventHandler& handler) {
+  if (handler.armed == 0) {
+    return;
+  }
+  // the canceled request's completion will be ignored
+  auto armed = std::exchange(handler.armed, 0);
+  auto* sqe = GetSqe();
+  if (sqe == nullptr) {
+    AE_TELED_WARNING("Unable to cancel poll for fd {}, wait it completes", fd);
+    return;
+  }
+  sqe->opcode = IORING_OP_POLL_REMOVE;
+  sqe->fd = -1;
+  sqe->addr = io_uring_poller_internal::MakeUserData(armed, fd);
+  sqe->user_data = io_uring_poller_internal::MakeUserData(0, fd);
+
+  std::atomic_ref{*ring_.sq_tail}.fetch_add(1, std::memory_order_release);
+  ++pending_submit_;
+}
+
+int IoUringImpl::Enter(std::uint32_t to_submit, std::uint32_t min_complete,
+                       std::uint32_t flags) {
+  return static_cast<int>(syscall(__NR_io_uring_enter, ring_.fd, to_submit,
+                                  min_complete, flags, nullptr, 0));
+}
+
+void IoUringImpl::Submit() {
+  auto to_submit = std::exchange(pending_submit_, 0);
+  while (to_submit != 0) {
+    auto res = Enter(to_submit, 0, 0);
+    if (res < 0) {
+      if (errno == EINTR) {
+        continue;
+      }
+      if ((errno == EBUSY) || (errno == EAGAIN)) {
+        // completion queue is overflowed, the worker submits after reaping
+        pending_submit_ += to_submit;
+        return;
+      }
+      AE_TELED_ERROR("Failed to submit to io_uring {} {}", errno,
+                     strerror(errno));
+      assert(false);
+      return;
+    }
+    to_submit -= std::min(to_submit, static_cast<std::uint32_t>(res));
+  }
+}
+
+void IoUringImpl::ReapCompletions() {
+  auto head = *ring_.cq_head;
+  auto tail = std::atomic_ref{*ring_.cq_tail}.load(std::memory_order_acquire);
+
+  for (; head != tail; ++head) {
+    auto const& cqe = ring_.cqes[head & *ring_.cq_mask];
+    auto user_data = cqe.user_data;
+    auto res = cqe.res;
+    // release the slot before the callback to let the kernel reuse it
+    std::atomic_ref{*ring_.cq_head}.store(head + 1, std::memory_order_release);
+
+    auto generation = io_uring_poller_internal::UserDataGeneration(user_data);
+    if (generation == 0) {
+      continue;
+    }
+    auto fd = io_uring_poller_internal::UserDataFd(user_data);
+    auto it = event_map_.find(fd);
+    if ((it == event_map_.end()) || (it->second.armed != generation)) {
+      // canceled or stale request
+      continue;
+    }
+    // one shot poll request is done
+    it->second.armed = 0;
+
+    EventType ev_type;
+    if (res < 0) {
+      AE_TELED_ERROR("Poll request for fd {} failed {} {}", fd, -res,
+                     strerror(-res));
+      ev_type = EventType::kError;
+    } else {
+      ev_type = io_uring_poller_internal::PollMaskToEventType(
+          static_cast<std::uint32_t>(res));
+    }
+    it->second.cb(fd, ev_type);
+
+    // rearm if the descriptor is still watched and was not rearmed by callback
+    it = event_map_.find(fd);
+    if ((it != event_map_.end()) && (it->second.armed == 0) &&
+        (it->second.events != EventType{})) {
+      ArmPoll(fd, it->second);
+    }
+  }
+}
+
+void IoUringImpl::Loop() {
+  if (ring_.fd == -1) {
+    return;
+  }
+
+  std::uint32_t to_submit{};
+  while (!stop_requested_) {
+    // submit rearms and wait for at least one completion by one syscall
+    auto res = Enter(to_submit, 1, IORING_ENTER_GETEVENTS);
+    if (res < 0) {
+      if ((errno != EINTR) && (errno != EBUSY) && (errno != EAGAIN)) {
+        AE_TELED_ERROR("Failed to io_uring_enter {} {}", errno,
+                       strerror(errno));
+        assert(false);
+      }
+      res = 0;
+    }
+
+    auto lock = std::scoped_lock{*this};
+    // return not submitted requests back to the queue
+    pending_submit_ += to_submit - std::min(static_cast<std::uint32_t>(res),
+                                            to_submit);
+    ReapCompletions();
+    ArmDeferred();
+    to_submit = std::exchange(pending_submit_, 0);
+  }
+}
+
+IoUringPoller::IoUringPoller() = default;
+
+IoUringPoller::IoUringPoller(ObjProp prop) : IPoller{prop} {}
+
+std::shared_ptr<NativePoller> IoUringPoller::Native() {
+  if (!impl_) {
+    if (IoUringImpl::IsSupported()) {
+      impl_ = std::make_shared<IoUringImpl>();
+    } else {
+      AE_TELED_WARNING("io_uring is not supported, fallback to epoll");
+      impl_ = std::make_shared<EpollImpl>();
+    }
+  }
+  return impl_;
+}
+
+}  // namespace ae
+#endif
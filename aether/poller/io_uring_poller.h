@@ -0,0 +1,160 @@
+/*
+ * Copyright 2026 Aethernet Inc.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef AETHER_POLLER_IO_URING_POLLER_H_
+#define AETHER_POLLER_IO_URING_POLLER_H_
+
+#if defined __linux__ && __has_include(<linux/io_uring.h>)
+#  define IO_URING_POLLER_ENABLED 1
+
+#  include <map>
+#  include <mutex>
+#  include <thread>
+#  include <atomic>
+#  include <memory>
+#  include <vector>
+#  include <cstddef>
+#  include <cstdint>
+
+#  include "aether/config.h"
+#  include "aether/poller/poller.h"
+#  include "aether/poller/unix_poller.h"
+
+struct io_uring_sqe;
+struct io_uring_cqe;
+
+namespace ae {
+/**
+ * \brief Poller implementation on top of linux io_uring.
+ * Each descriptor is watched by a one shot IORING_OP_POLL_ADD request.
+ * All the poll (re)arms and removes made while the poller is locked are queued
+ * to the submission ring and flushed by one io_uring_enter call on unlock.
+ * The worker thread reaps all the ready completions at once and submits
+ * rearms together with the wait for the next completions.
+ * Completions over the completion queue size are kept by kernel
+ * (IORING_FEAT_NODROP) and moved to the queue as it's reaped, so any count of
+ * descriptors may be watched.
+ */
+class IoUringImpl final : public UnixPollerImpl {
+  friend class std::scoped_lock<IoUringImpl>;
+
+  static constexpr std::uint32_t kQueueDepth = AE_IO_URING_QUEUE_DEPTH;
+  static constexpr std::uint32_t kCqDepth = AE_IO_URING_CQ_DEPTH;
+
+  struct EventHandler {
+    EventCb cb;
+    EventType events;
+    // generation of currently armed poll request, 0 if not armed
+    std::uint32_t armed;
+    // arm is waiting for free space in the submission queue
+    bool deferred;
+  };
+
+  struct Ring {
+    int fd = -1;
+    std::uint32_t sq_entries{};
+    std::uint32_t* sq_head{};
+    std::uint32_t* sq_tail{};
+    std::uint32_t* sq_mask{};
+    std::uint32_t* sq_array{};
+    io_uring_sqe* sqes{};
+    std::uint32_t* cq_head{};
+    std::uint32_t* cq_tail{};
+    std::uint32_t* cq_mask{};
+    io_uring_cqe* cqes{};
+
+    void* sq_map{};
+    std::size_t sq_map_size{};
+    void* cq_map{};
+    std::size_t cq_map_size{};
+    std::size_t sqes_map_size{};
+  };
+
+ public:
+  IoUringImpl();
+  ~IoUringImpl() override;
+
+  /**
+   * \brief Check if io_uring is available on the running kernel.
+   * It may be disabled by sysctl or seccomp filters in containers.
+   * Kernels before 5.5 drop completions on overflow, they are not supported.
+   */
+  static bool IsSupported();
+
+ private:
+  // the ring is shared by all descriptors
+  void Lock(DescriptorType fd) override;
+  void Unlock(DescriptorType fd) override;
+  void lock();
+  void unlock();
+
+  void Callback(DescriptorType fd, EventCb cb) override;
+  void Event(DescriptorType fd, EventType events) override;
+  void Remove(DescriptorType fd) override;
+
+  static Ring InitRing(std::uint32_t entries, std::uint32_t cq_entries);
+  static void CloseRing(Ring& ring);
+  static int MakeEventFd();
+
+  io_uring_sqe* GetSqe();
+  void ArmPoll(DescriptorType fd, EventHandler& handler);
+  void ArmDeferred();
+  void CancelPoll(DescriptorType fd, EventHandler& handler);
+  int Enter(std::uint32_t to_submit, std::uint32_t min_complete,
+            std::uint32_t flags);
+  void Submit();
+  void ReapCompletions();
+  void Loop();
+
+  Ring ring_;
+  int event_fd_;
+  std::recursive_mutex poller_mutex_;
+  std::size_t lock_depth_{};
+  // count of queued but not submitted sqes
+  std::uint32_t pending_submit_{};
+  // arms waiting for free space in the submission queue
+  std::vector<DescriptorType> deferred_arms_;
+  std::uint32_t generation_{};
+  std::map<DescriptorType, EventHandler> event_map_;
+
+  std::atomic_bool stop_requested_{false};
+  std::thread thread_;
+};
+
+class IoUringPoller : public IPoller {
+  AE_OBJECT(IoUringPoller, IPoller, 0)
+
+  IoUringPoller();
+
+ public:
+  explicit IoUringPoller(ObjProp prop);
+
+  AE_OBJECT_REFLECT()
+
+  /**
+   * \brief Returns io_uring poller or falls back to epoll if io_uring is not
+   * supported by the kernel.
+   */
+  std::shared_ptr<NativePoller> Native() override;
+
+ private:
+  std::shared_ptr<UnixPollerImpl> impl_;
+};
+
+}  // namespace ae
+
+#endif
+#endif  // AETHER_POLLER_IO_URING_POLLER_H_
@@ -119,9 +119,11 @@ KqueuePollerImpl::~KqueuePollerImpl() {
   AE_TELE_DEBUG(kKqueueWorkerDestroyed);
 }
 
-void KqueuePollerImpl::lock() { poller_mutex_.lock(); }
+void KqueuePollerImpl::Lock(DescriptorType /* fd */) { poller_mutex_.lock(); }
 
-void KqueuePollerImpl::unlock() { poller_mutex_.unlock(); }
+void KqueuePollerImpl::Unlock(DescriptorType /* fd */) {
+  poller_mutex_.unlock();
+}
 
 void KqueuePollerImpl::Callback(DescriptorType fd, EventCb cb) {
   AE_TELE_DEBUG(kKqueueAddDescriptor, "Add descriptor {}", fd);
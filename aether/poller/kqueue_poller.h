@@ -40,8 +40,8 @@ class KqueuePollerImpl : public UnixPollerImpl {
   ~KqueuePollerImpl() override;
 
  private:
-  void lock() override;
-  void unlock() override;
+  void Lock(DescriptorType fd) override;
+  void Unlock(DescriptorType fd) override;
 
   void Callback(DescriptorType fd, EventCb cb) override;
   void Event(DescriptorType fd, EventType events) override;
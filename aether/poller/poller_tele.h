@@ -57,4 +57,8 @@ AE_TAG(kWinpollAddFailed, kPoller)
 AE_TAG(kWinpollInitFailed, kPoller)
 AE_TAG(kWinpollWaitFailed, kPoller)
 
+AE_TAG(kIoUringWorkerCreate, kPoller)
+AE_TAG(kIoUringWorkerDestroyed, kPoller)
+AE_TAG(kIoUringInitFailed, kPoller)
+
 #endif  // AETHER_POLLER_POLLER_TELE_H_
@@ -37,11 +37,14 @@ class UnixPollerImpl : public NativePoller {
 
  private:
   friend class UnixPolledFd;
-  friend class std::scoped_lock<UnixPollerImpl>;
-  friend class std::unique_lock<UnixPollerImpl>;
 
-  virtual void lock() = 0;
-  virtual void unlock() = 0;
+  /**
+   * \brief Lock the part of the poller serving the file descriptor.
+   * Callback, Event and Remove are called under this lock and the poller holds
+   * it while the fd's event callback is called.
+   */
+  virtual void Lock(DescriptorType fd) = 0;
+  virtual void Unlock(DescriptorType fd) = 0;
 
   /**
    * \brief Add file descriptor to the poller with event callback.
@@ -60,45 +63,63 @@ class UnixPollerImpl : public NativePoller {
 };
 
 class UnixPolledFd {
+  /**
+   * \brief BasicLockable for the fd's part of the poller.
+   */
+  class FdLock {
+   public:
+    FdLock(UnixPollerImpl& poller, DescriptorType fd) noexcept
+        : poller_{&poller}, fd_{fd} {}
+
+    void lock() { poller_->Lock(fd_); }
+    void unlock() { poller_->Unlock(fd_); }
+
+   private:
+    UnixPollerImpl* poller_;
+    DescriptorType fd_;
+  };
+
  public:
   class Fd {
    public:
-    Fd(std::unique_lock<UnixPollerImpl>&& lock, DescriptorType fd) noexcept
+    Fd(std::unique_lock<FdLock>&& lock, DescriptorType fd) noexcept
         : lock_{std::move(lock)}, fd_{fd} {}
 
     DescriptorType operator*() const noexcept { return fd_; }
 
    private:
-    std::unique_lock<UnixPollerImpl> lock_;
+    std::unique_lock<FdLock> lock_;
     DescriptorType fd_;
   };
 
   UnixPolledFd(DescriptorType fd, std::shared_ptr<NativePoller> const& poller,
                UnixPollerImpl::EventCb cb)
-      : fd_{fd}, poller_{std::static_pointer_cast<UnixPollerImpl>(poller)} {
-    auto lock = std::scoped_lock{*poller_};
+      : fd_{fd},
+        poller_{std::static_pointer_cast<UnixPollerImpl>(poller)},
+        lock_{*poller_, fd} {
+    auto lock = std::scoped_lock{lock_};
     poller_->Callback(fd_, std::move(cb));
   }
 
   ~UnixPolledFd() {
-    auto lock = std::scoped_lock{*poller_};
+    auto lock = std::scoped_lock{lock_};
     if (fd_ != kInvalidDescriptor) {
       poller_->Remove(fd_);
     }
   }
 
   void Events(EventType events) {
-    auto lock = std::scoped_lock{*poller_};
+    auto lock = std::scoped_lock{lock_};
     poller_->Event(fd_, events);
   }
 
-  auto fd() const noexcept { return Fd{std::unique_lock{*poller_}, fd_}; }
+  auto fd() const noexcept { return Fd{std::unique_lock{lock_}, fd_}; }
 
   /**
    * \brief Use Remove to remove fd from the poller and return the descriptor
    */
   auto Remove() noexcept {
-    auto fd = Fd{std::unique_lock{*poller_}, fd_};
+    auto fd = Fd{std::unique_lock{lock_}, fd_};
     if (fd_ != kInvalidDescriptor) {
       poller_->Remove(fd_);
       fd_ = kInvalidDescriptor;
@@ -108,7 +129,9 @@ class UnixPolledFd {
 
  private:
   DescriptorType fd_;
-  mutable std::shared_ptr<UnixPollerImpl> poller_;
+  std::shared_ptr<UnixPollerImpl> poller_;
+  // locks by the initial fd, it is kept even after Remove
+  mutable FdLock lock_;
 };
 
 }  // namespace ae
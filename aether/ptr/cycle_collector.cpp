@@ -0,0 +1,407 @@
+/*
+ * Copyright 2026 Aethernet Inc.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "aether/ptr/cycle_collector.h"
+
+#include <cassert>
+#include <utility>
+
+#include "aether/config.h"
+#include "aether/ptr/ptr.h"
+
+namespace ae {
+namespace {
+// trivially destructible, so it's safe to check on thread exit
+thread_local bool collector_destroyed = false;
+}  // namespace
+
+std::uint32_t CycleCollector::NodeIndex::Find(
+    PtrStorageBase const* storage) const {
+  if (buckets_.empty()) {
+    return kEmpty;
+  }
+  auto mask = buckets_.size() - 1;
+  for (auto i = Home(storage);; i = (i + 1) & mask) {
+    if (buckets_[i].storage == storage) {
+      return buckets_[i].node;
+    }
+    if (buckets_[i].storage == nullptr) {
+      return kEmpty;
+    }
+  }
+}
+
+void CycleCollector::NodeIndex::Insert(PtrStorageBase const* storage,
+                                       std::uint32_t node) {
+  if (((size_ + 1) * 2) > buckets_.size()) {
+    Grow();
+  }
+  auto mask = buckets_.size() - 1;
+  auto i = Home(storage);
+  while (buckets_[i].storage != nullptr) {
+    i = (i + 1) & mask;
+  }
+  buckets_[i] = Bucket{storage, node};
+  ++size_;
+}
+
+void CycleCollector::NodeIndex::Remove(PtrStorageBase const* storage) {
+  if (buckets_.empty()) {
+    return;
+  }
+  auto mask = buckets_.size() - 1;
+  auto i = Home(storage);
+  while (buckets_[i].storage != storage) {
+    if (buckets_[i].storage == nullptr) {
+      return;
+    }
+    i = (i + 1) & mask;
+  }
+  // backward shift the following buckets to keep probe chains without gaps
+  for (auto j = (i + 1) & mask; buckets_[j].storage != nullptr;
+       j = (j + 1) & mask) {
+    auto home = Home(buckets_[j].storage);
+    if (((j - home) & mask) >= ((j - i) & mask)) {
+      buckets_[i] = buckets_[j];
+      i = j;
+    }
+  }
+  buckets_[i] = Bucket{};
+  --size_;
+}
+
+std::size_t CycleCollector::NodeIndex::Home(
+    PtrStorageBase const* storage) const {
+  // fibonacci hashing, the high bits of product are the best mixed
+  auto value =
+      static_cast<std::uint64_t>(reinterpret_cast<std::uintptr_t>(storage));
+  return static_cast<std::size_t>((value * 0x9E3779B97F4A7C15ULL) >> shift_);
+}
+
+void CycleCollector::NodeIndex::Grow() {
+  auto old = std::exchange(buckets_, {});
+  buckets_.resize(old.empty() ? 16 : old.size() * 2);
+  shift_ = 64;
+  for (auto s = buckets_.size(); s > 1; s >>= 1) {
+    --shift_;
+  }
+  size_ = 0;
+  for (auto const& bucket : old) {
+    if (bucket.storage != nullptr) {
+      Insert(bucket.storage, bucket.node);
+    }
+  }
+}
+
+void CycleCollector::AddRoot(PtrStorageBase* storage) {
+  auto* collector = Instance();
+  if (collector == nullptr) {
+    // thread is exiting, cycles dropped after that are leaked
+    return;
+  }
+  collector->Buffer(storage);
+  if (!collector->deferred_ && !collector->collecting_) {
+    collector->CollectAll();
+  }
+}
+
+bool CycleCollector::Collect(std::size_t budget) {
+  auto* collector = Instance();
+  if (collector == nullptr) {
+    return true;
+  }
+  if (collector->collecting_) {
+    // called from the destructor of garbage object
+    return collector->roots_.empty();
+  }
+  if (budget == kUnbounded) {
+    collector->CollectAll();
+    return true;
+  }
+  return collector->CollectBatch(budget);
+}
+
+void CycleCollector::SetDeferred(bool deferred) {
+  auto* collector = Instance();
+  if (collector == nullptr) {
+    return;
+  }
+  collector->deferred_ = deferred;
+  if (!deferred && !collector->collecting_) {
+    collector->CollectAll();
+  }
+}
+
+bool CycleCollector::IsDeferred() {
+  auto* collector = Instance();
+  return (collector != nullptr) && collector->deferred_;
+}
+
+std::size_t CycleCollector::RootsCount() {
+  auto* collector = Instance();
+  return (collector != nullptr) ? collector->roots_.size() : 0;
+}
+
+CycleCollector::CycleCollector()
+    : deferred_{AE_PTR_DEFERRED_CYCLE_COLLECTION != 0} {}
+
+CycleCollector::~CycleCollector() {
+  // garbage left by the thread
+  CollectAll();
+  collector_destroyed = true;
+}
+
+CycleCollector* CycleCollector::Instance() {
+  if (collector_destroyed) {
+    return nullptr;
+  }
+  thread_local CycleCollector collector;
+  return &collector;
+}
+
+void CycleCollector::Buffer(PtrStorageBase* storage) {
+  if (root_index_.Find(storage) != NodeIndex::kEmpty) {
+    return;
+  }
+  // keep the storage until the root is collected
+  storage->ref_counters.weak_refs += 1;
+  root_index_.Insert(storage, 0);
+  roots_.push_back(storage);
+}
+
+void CycleCollector::CollectAll() {
+  // garbage destructors may drop new roots
+  while (!CollectBatch(kUnbounded)) {
+  }
+}
+
+bool CycleCollector::CollectBatch(std::size_t budget) {
+  if (roots_.empty()) {
+    return true;
+  }
+  collecting_ = true;
+
+  std::size_t work = 0;
+  if (!marking_) {
+    if (!Visit(work, budget)) {
+      resumed_ = true;
+      collecting_ = false;
+      return false;
+    }
+    marking_ = true;
+    mark_next_ = 0;
+  }
+  if (!MarkAlive(work, budget)) {
+    resumed_ = true;
+    collecting_ = false;
+    return false;
+  }
+
+  if (resumed_) {
+    RecountGarbage();
+  }
+  // the roots dropped by garbage destructors are buffered again
+  DestroyGarbage();
+
+  ReleaseNodes();
+  ReleaseRoots(std::exchange(taken_, 0));
+  marking_ = false;
+  resumed_ = false;
+
+  collecting_ = false;
+  return roots_.empty();
+}
+
+bool CycleCollector::Visit(std::size_t& work, std::size_t budget) {
+  for (;;) {
+    if (stack_.empty()) {
+      // the next root is not started if the budget is exhausted
+      if ((taken_ == roots_.size()) || (work >= budget)) {
+        return true;
+      }
+      auto* root = roots_[taken_++];
+      root_index_.Remove(root);
+      // already destroyed by the last reference or visited with the previous
+      // root
+      if ((root->ref_counters.main_refs != 0) &&
+          (node_index_.Find(root) == NodeIndex::kEmpty)) {
+        AddNode(root);
+      }
+      continue;
+    }
+    if (work >= budget) {
+      return false;
+    }
+    ++work;
+
+    auto n = stack_.back();
+    stack_.pop_back();
+
+    auto* storage = nodes_[n].storage;
+    nodes_[n].edges_begin = static_cast<std::uint32_t>(edges_.size());
+    nodes_[n].edges_end = nodes_[n].edges_begin;
+    // destroyed between the batches
+    if (storage->ref_counters.main_refs == 0) {
+      continue;
+    }
+    children_.clear();
+    storage->manage_table->child_ptrs(storage, children_);
+
+    for (auto* child : children_) {
+      auto c = node_index_.Find(child);
+      if (c == NodeIndex::kEmpty) {
+        c = AddNode(child);
+      }
+      // trial deletion of the reference
+      nodes_[c].external_refs -= 1;
+      edges_.push_back(c);
+    }
+    nodes_[n].edges_end = static_cast<std::uint32_t>(edges_.size());
+  }
+}
+
+std::uint32_t CycleCollector::AddNode(PtrStorageBase* storage) {
+  auto n = static_cast<std::uint32_t>(nodes_.size());
+  nodes_.push_back(Node{storage, 0, 0,
+                        static_cast<std::int32_t>(
+                            storage->ref_counters.main_refs),
+                        false});
+  node_index_.Insert(storage, n);
+  stack_.push_back(n);
+  // keep the storage until the graph is collected
+  storage->ref_counters.weak_refs += 1;
+  return n;
+}
+
+bool CycleCollector::MarkAlive(std::size_t& work, std::size_t budget) {
+  for (;;) {
+    if (stack_.empty()) {
+      // objects referenced from outside the graph and all reachable from them
+      while ((mark_next_ < nodes_.size()) &&
+             (nodes_[mark_next_].alive ||
+              (nodes_[mark_next_].external_refs <= 0))) {
+        ++mark_next_;
+      }
+      if (mark_next_ == nodes_.size()) {
+        return true;
+      }
+      nodes_[mark_next_].alive = true;
+      stack_.push_back(mark_next_++);
+      continue;
+    }
+    if (work >= budget) {
+      return false;
+    }
+    ++work;
+
+    auto const& node = nodes_[stack_.back()];
+    stack_.pop_back();
+    for (auto e = node.edges_begin; e < node.edges_end; ++e) {
+      auto& child = nodes_[edges_[e]];
+      if (!child.alive) {
+        child.alive = true;
+        stack_.push_back(edges_[e]);
+      }
+    }
+  }
+}
+
+void CycleCollector::RecountGarbage() {
+  // the objects might be changed between the batches, so trial deletion is
+  // repeated for the garbage with the current references and edges
+  for (auto& node : nodes_) {
+    if (node.alive) {
+      continue;
+    }
+    auto const& refs = node.storage->ref_counters;
+    // destroyed between the batches
+    node.alive = (refs.main_refs == 0);
+    node.external_refs = static_cast<std::int32_t>(refs.main_refs);
+  }
+  for (auto& node : nodes_) {
+    node.edges_begin = node.edges_end =
+        static_cast<std::uint32_t>(edges_.size());
+    if (node.alive) {
+      continue;
+    }
+    children_.clear();
+    node.storage->manage_table->child_ptrs(node.storage, children_);
+    for (auto* child : children_) {
+      auto c = node_index_.Find(child);
+      if ((c == NodeIndex::kEmpty) || nodes_[c].alive) {
+        continue;
+      }
+      nodes_[c].external_refs -= 1;
+      edges_.push_back(c);
+    }
+    node.edges_end = static_cast<std::uint32_t>(edges_.size());
+  }
+
+  std::size_t work = 0;
+  mark_next_ = 0;
+  MarkAlive(work, kUnbounded);
+}
+
+void CycleCollector::DestroyGarbage() {
+  garbage_.clear();
+  for (auto const& node : nodes_) {
+    if (!node.alive) {
+      garbage_.push_back(node.storage);
+    }
+  }
+  if (garbage_.empty()) {
+    return;
+  }
+
+  // all the references to garbage are from the garbage, drop them at once, so
+  // destructors do not touch the other garbage objects, the storage is kept by
+  // the graph until all of them are destroyed
+  for (auto* storage : garbage_) {
+    auto& refs = storage->ref_counters;
+    refs.weak_refs -= refs.main_refs;
+    refs.main_refs = 0;
+  }
+  for (auto* storage : garbage_) {
+    PtrBase::Destroy(storage);
+  }
+  garbage_.clear();
+}
+
+void CycleCollector::ReleaseNodes() {
+  for (auto const& node : nodes_) {
+    node_index_.Remove(node.storage);
+    auto& refs = node.storage->ref_counters;
+    refs.weak_refs -= 1;
+    if ((refs.main_refs == 0) && (refs.weak_refs == 0)) {
+      PtrBase::Free(node.storage);
+    }
+  }
+  nodes_.clear();
+  edges_.clear();
+}
+
+void CycleCollector::ReleaseRoots(std::size_t count) {
+  for (std::size_t i = 0; i < count; ++i) {
+    auto& refs = roots_[i]->ref_counters;
+    refs.weak_refs -= 1;
+    if ((refs.main_refs == 0) && (refs.weak_refs == 0)) {
+      PtrBase::Free(roots_[i]);
+    }
+  }
+  roots_.erase(roots_.begin(),
+               roots_.begin() + static_cast<std::ptrdiff_t>(count));
+}
+}  // namespace ae
@@ -0,0 +1,148 @@
+/*
+ * Copyright 2026 Aethernet Inc.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef AETHER_PTR_CYCLE_COLLECTOR_H_
+#define AETHER_PTR_CYCLE_COLLECTOR_H_
+
+#include <limits>
+#include <vector>
+#include <cstddef>
+#include <cstdint>
+
+#include "aether/common.h"
+#include "aether/ptr/ptr_management.h"
+
+namespace ae {
+/**
+ * \brief Collector of Ptr reference cycles.
+ * Each time Ptr drops a reference but the object is still referenced, the
+ * object is buffered as a possible root of a garbage cycle. Buffered roots are
+ * checked by trial deletion: the graph reachable from the roots is visited,
+ * references from inside the graph are subtracted from the reference counts,
+ * objects with references left and all reachable from them are alive, the
+ * rest are garbage.
+ * In synchronous mode roots are collected immediately, in deferred mode they
+ * are collected by batches from the application update \see Collect.
+ * Each thread has its own collector, Ptr graph must not be shared between
+ * threads.
+ */
+class CycleCollector {
+  struct Node {
+    PtrStorageBase* storage;
+    // children are edges_[edges_begin, edges_end)
+    std::uint32_t edges_begin;
+    std::uint32_t edges_end;
+    // references count not explained by edges from the visited graph
+    std::int32_t external_refs;
+    bool alive;
+  };
+
+  // open addressed storage to node index map
+  class NodeIndex {
+   public:
+    static constexpr auto kEmpty = std::numeric_limits<std::uint32_t>::max();
+
+    std::uint32_t Find(PtrStorageBase const* storage) const;
+    // storage must not be in the index
+    void Insert(PtrStorageBase const* storage, std::uint32_t node);
+    void Remove(PtrStorageBase const* storage);
+
+   private:
+    struct Bucket {
+      PtrStorageBase const* storage;
+      std::uint32_t node;
+    };
+
+    std::size_t Home(PtrStorageBase const* storage) const;
+    void Grow();
+
+    std::vector<Bucket> buckets_;
+    std::size_t size_{};
+    std::size_t shift_{};
+  };
+
+ public:
+  static constexpr auto kUnbounded = std::numeric_limits<std::size_t>::max();
+
+  AE_CLASS_NO_COPY_MOVE(CycleCollector)
+
+  /**
+   * \brief Add possible root of a garbage cycle.
+   * storage has just lost a reference but still has the others.
+   */
+  static void AddRoot(PtrStorageBase* storage);
+
+  /**
+   * \brief Collect garbage cycles of the buffered roots.
+   * At most budget objects are visited and marked per call, the graph of the
+   * taken roots is kept and continued by the next calls. The objects may be
+   * changed between the calls, so the garbage of such a graph is recounted
+   * by the current references before it's destroyed.
+   * kUnbounded collects until no roots left, including the roots dropped by
+   * the garbage destructors.
+   * \return true if there are no more buffered roots.
+   */
+  static bool Collect(std::size_t budget = kUnbounded);
+
+  /**
+   * \brief Switch between deferred and synchronous mode.
+   * Switching to synchronous collects all the buffered roots.
+   */
+  static void SetDeferred(bool deferred);
+  static bool IsDeferred();
+
+  static std::size_t RootsCount();
+
+ private:
+  CycleCollector();
+  ~CycleCollector();
+
+  // nullptr if thread's collector is already destroyed
+  static CycleCollector* Instance();
+
+  void Buffer(PtrStorageBase* storage);
+  void CollectAll();
+  bool CollectBatch(std::size_t budget);
+  // return false if the budget is exhausted before the work is done
+  bool Visit(std::size_t& work, std::size_t budget);
+  bool MarkAlive(std::size_t& work, std::size_t budget);
+  std::uint32_t AddNode(PtrStorageBase* storage);
+  void RecountGarbage();
+  void DestroyGarbage();
+  void ReleaseNodes();
+  void ReleaseRoots(std::size_t count);
+
+  bool deferred_;
+  bool collecting_{};
+  std::vector<PtrStorageBase*> roots_;
+  NodeIndex root_index_;
+
+  // the graph of the taken roots, kept until it's collected, the memory is
+  // reused by the next graphs
+  bool marking_{};
+  bool resumed_{};
+  std::size_t taken_{};
+  std::uint32_t mark_next_{};
+  std::vector<Node> nodes_;
+  std::vector<std::uint32_t> edges_;
+  std::vector<std::uint32_t> stack_;
+  std::vector<PtrStorageBase*> children_;
+  std::vector<PtrStorageBase*> garbage_;
+  NodeIndex node_index_;
+};
+}  // namespace ae
+
+#endif  // AETHER_PTR_CYCLE_COLLECTOR_H_
@@ -16,6 +16,9 @@
 
 #include "aether/ptr/ptr.h"
 
+#include <memory>
+#include <utility>
+
 namespace ae {
 PtrBase::PtrBase() : ptr_storage_{nullptr} {}
 
@@ -61,15 +64,8 @@ void PtrBase::Reset() {
   if (!operator bool()) {
     return;
   }
-  Decrement();
-  if (ptr_storage_->ref_counters.main_refs == 0) {
-    Destroy();
-    if (ptr_storage_->ref_counters.weak_refs == 0) {
-      Free();
-    }
-  }
-
-  ptr_storage_ = nullptr;
+  // the Ptr must not be seen by the destructors and the cycle collector
+  Release(std::exchange(ptr_storage_, nullptr));
 }
 
 void PtrBase::Increment() {
@@ -80,114 +76,37 @@ void PtrBase::Increment() {
   ptr_storage_->ref_counters.weak_refs += 1;
 }
 
-void PtrBase::Decrement() {
-  if (ptr_storage_ == nullptr) {
+void PtrBase::Release(PtrStorageBase* ptr_storage) {
+  auto& refs = ptr_storage->ref_counters;
+  refs.weak_refs -= 1;
+  if (refs.main_refs > 1) {
+    refs.main_refs -= 1;
+    // the other references may be only from the objects reachable from this
+    CycleCollector::AddRoot(ptr_storage);
     return;
   }
-  if (ptr_storage_->ref_counters.main_refs > 1) {
-    auto count = DecrementGraphCount();
-    DecrementRef(count);
-  } else {
-    DecrementRef();
+  refs.main_refs = 0;
+  Destroy(ptr_storage);
+  if (refs.weak_refs == 0) {
+    Free(ptr_storage);
   }
 }
 
-void PtrBase::DecrementRef(std::uint8_t count) {
-  ptr_storage_->ref_counters.main_refs -= count;
-  ptr_storage_->ref_counters.weak_refs -= count;
-}
-
-std::uint8_t PtrBase::DecrementGraphCount() {
-  assert((ptr_storage_ != nullptr) &&
-         "DecrementGraphCount but ptr_storage_ is nullptr");
-
-  auto ref_tree = BuildDecrementGraph();
-
-  // Check if current obj has no external references
-  // External references may be direct or by children objects
-
-  auto& self_node = ref_tree.get(0);
-  // there is direct external references
-  if (self_node.value.ref_count != self_node.value.reachable_ref_count) {
-    // is not safe to delete completely
-    return 1;
-  }
-
-  bool safe_to_delete = true;
-  self_node.ForEach([&safe_to_delete](RefTree::Node& node) {
-    // that node has external references
-    // check if head not is reachable
-    if (node.value.ref_count != node.value.reachable_ref_count) {
-      if (node.IsReachable(0)) {
-        safe_to_delete = false;
-        return false;
-      }
-    }
-    return true;
-  });
-
-  if (safe_to_delete) {
-    return ptr_storage_->ref_counters.main_refs;
-  }
-  return 1;
-}
-
-RefTree PtrBase::BuildDecrementGraph() {
-  RefTree tree;
-  auto& node = tree.Emplace(reinterpret_cast<std::uintptr_t>(ptr_storage_),
-                            ptr_storage_->ref_counters.main_refs);
-  node.value.reachable_ref_count++;
-  std::set<std::uintptr_t> visited;
-  visited.insert(reinterpret_cast<std::uintptr_t>(ptr_storage_));
-  BuildDecrementGraphImpl(tree, node.index, Children(), visited);
-  return tree;
-}
-
-void PtrBase::BuildDecrementGraphImpl(
-    RefTree& tree, RefTree::Index head_index,
-    std::vector<PtrBase const*> const& children,
-    std::set<std::uintptr_t>& visited) {
-  for (auto const* child : children) {
-    auto& node =
-        tree.Emplace(reinterpret_cast<std::uintptr_t>(child->ptr_storage_),
-                     child->ptr_storage_->ref_counters.main_refs);
-    node.value.reachable_ref_count++;
-    tree.get(head_index).children_indices.push_back(node.index);
-
-    // cycle detection
-    auto [_, not_visited] =
-        visited.emplace(reinterpret_cast<std::uintptr_t>(child->ptr_storage_));
-    if (not_visited) {
-      BuildDecrementGraphImpl(tree, node.index, child->Children(), visited);
-    }
-  }
-}
-
-std::vector<PtrBase const*> PtrBase::Children() const {
-  if (ptr_storage_ == nullptr) {
-    return {};
-  }
-  if (ptr_storage_->ref_counters.main_refs == 0) {
-    return {};
-  }
-  return ptr_storage_->manage_table->child_ptrs(this);
-}
-
-void PtrBase::Destroy() {
-  assert((ptr_storage_ != nullptr) && "Destroy but ptr_storage_ is nullptr");
+void PtrBase::Destroy(PtrStorageBase* ptr_storage) {
+  assert((ptr_storage != nullptr) && "Destroy but ptr_storage is nullptr");
   // prevent cycled ptrviews delete ptr_storage
-  ptr_storage_->ref_counters.weak_refs += 1;
+  ptr_storage->ref_counters.weak_refs += 1;
   // call the destructor on pointer
   // Note if T is derived from Base, Base must have virtual ~Base to prevent
   // memory leaks
-  ptr_storage_->manage_table->destroy(this);
-  ptr_storage_->ref_counters.weak_refs -= 1;
+  ptr_storage->manage_table->destroy(ptr_storage);
+  ptr_storage->ref_counters.weak_refs -= 1;
 }
 
-void PtrBase::Free() {
+void PtrBase::Free(PtrStorageBase* ptr_storage) {
   auto alloc = std::allocator<std::uint8_t>{};
-  alloc.deallocate(reinterpret_cast<std::uint8_t*>(ptr_storage_),
-                   static_cast<std::size_t>(ptr_storage_->alloc_size));
+  alloc.deallocate(reinterpret_cast<std::uint8_t*>(ptr_storage),
+                   static_cast<std::size_t>(ptr_storage->alloc_size));
 }
 
 bool operator==(PtrBase const& left, PtrBase const& right) {
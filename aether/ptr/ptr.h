@@ -25,7 +25,7 @@
 #include "aether/type_traits.h"
 
 #include "aether/ptr/rc_ptr.h"
-#include "aether/ptr/ref_tree.h"
+#include "aether/ptr/cycle_collector.h"
 #include "aether/ptr/ptr_management.h"
 #include "aether-miscpp/reflect/domain_visitor.h"
 // IWYU pragma: end_keeps
@@ -33,6 +33,7 @@
 namespace ae {
 class PtrBase {
   friend class PtrViewBase;
+  friend class CycleCollector;
   friend struct RefVisitor;
 
   friend bool operator==(PtrBase const& left, PtrBase const& right);
@@ -56,16 +57,10 @@ class PtrBase {
   void Reset();
 
   void Increment();
-  void Decrement();
-  void DecrementRef(std::uint8_t count = 1);
-  std::uint8_t DecrementGraphCount();
-  RefTree BuildDecrementGraph();
-  void BuildDecrementGraphImpl(RefTree& tree, RefTree::Index head_index,
-                               std::vector<PtrBase const*> const& children,
-                               std::set<std::uintptr_t>& visited);
-  std::vector<PtrBase const*> Children() const;
-  void Destroy();
-  void Free();
+  // drop one reference, the last one destroys the object
+  static void Release(PtrStorageBase* ptr_storage);
+  static void Destroy(PtrStorageBase* ptr_storage);
+  static void Free(PtrStorageBase* ptr_storage);
 
   PtrStorageBase* ptr_storage_;
 };
@@ -73,11 +68,6 @@ class PtrBase {
 bool operator==(PtrBase const& left, PtrBase const& right);
 bool operator!=(PtrBase const& left, PtrBase const& right);
 
-template <typename T>
-static void PtrDestroy(PtrBase*);
-template <typename T>
-std::vector<PtrBase const*> PtrChildren(PtrBase*);
-
 /**
  * \brief Pointer - like shared pointer but with ability to create object
  * reference graph and avoid cycle references.
@@ -91,9 +81,6 @@ class Ptr : public PtrBase {
   template <typename U>
   friend class ObjPtr;
 
-  friend void PtrDestroy<T>(PtrBase*);
-  friend std::vector<PtrBase const*> PtrChildren<T>(PtrBase*);
-
  public:
   Ptr() noexcept : PtrBase() {}
   explicit Ptr(std::nullptr_t) noexcept : Ptr() {}
@@ -202,21 +189,19 @@ class Ptr : public PtrBase {
 };
 
 template <typename T>
-static void PtrDestroy(PtrBase* self) {
-  auto* _this = reinterpret_cast<Ptr<T>*>(self);
-  auto* obj = _this->get();
+void PtrDestroy(PtrStorageBase* storage) {
+  auto* obj = reinterpret_cast<PtrStorage<T>*>(storage)->ptr();
   obj->~T();
 }
 
 template <typename T>
-std::vector<PtrBase const*> PtrChildren(PtrBase const* self) {
-  auto const* _this = reinterpret_cast<Ptr<T> const*>(self);
-  auto const* obj = _this->get();
+void PtrChildren(PtrStorageBase const* storage,
+                 std::vector<PtrStorageBase*>& children) {
+  auto const* obj = reinterpret_cast<PtrStorage<T> const*>(storage)->ptr();
   assert(obj != nullptr && "Ptr is not initialized");
 
-  auto ref_visitor = RefVisitor{};
+  auto ref_visitor = RefVisitor{children};
   reflect::DomainVisit(*obj, PtrRefDnv{ref_visitor});
-  return ref_visitor.children;
 }
 
 template <typename T>
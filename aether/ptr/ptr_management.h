@@ -17,6 +17,7 @@
 #ifndef AETHER_PTR_PTR_MANAGEMENT_H_
 #define AETHER_PTR_PTR_MANAGEMENT_H_
 
+#include <vector>
 #include <cstdint>
 #include <cassert>
 #include <type_traits>
@@ -30,12 +31,14 @@ struct PtrRefcounters {
   std::uint8_t weak_refs = 0;
 };
 
-class PtrBase;
+struct PtrStorageBase;
 
-// function table for managing Ptr<T> from PtrBase
+// function table for managing PtrStorage<T> from PtrStorageBase
 struct ManageTable {
-  void (*destroy)(PtrBase* self);
-  std::vector<PtrBase const*> (*child_ptrs)(PtrBase const* self);
+  void (*destroy)(PtrStorageBase* storage);
+  // append storages referenced by the object's Ptrs
+  void (*child_ptrs)(PtrStorageBase const* storage,
+                     std::vector<PtrStorageBase*>& children);
 };
 
 // PtrStorageBase* is used in general case, but PtrStorage<T>* in case there T
@@ -83,7 +86,7 @@ struct RefVisitor {
       return false;
     }
 
-    children.push_back(&obj);
+    children.push_back(obj.ptr_storage_);
     return false;
   }
 
@@ -91,7 +94,7 @@ struct RefVisitor {
   std::enable_if_t<!ptr_management_internal::IsPtr<U>::value> operator()(
       U const& /* obj */) {}
 
-  std::vector<PtrBase const*> children;
+  std::vector<PtrStorageBase*>& children;
 };
 
 using PtrRefDnv =
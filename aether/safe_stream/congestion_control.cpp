@@ -0,0 +1,214 @@
+/*
+ * Copyright 2026 Aethernet Inc.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "aether/safe_stream/congestion_control.h"
+
+#include <algorithm>
+
+namespace ae {
+namespace congestion_control_internal {
+using Seconds = std::chrono::duration<double>;
+
+std::size_t InitialWindow(std::size_t max_window, std::size_t max_payload,
+                          std::size_t payloads) {
+  if (max_payload == 0) {
+    return max_window;
+  }
+  return std::min(max_window, payloads * max_payload);
+}
+
+std::size_t MinWindow(std::size_t max_window, std::size_t max_payload,
+                      std::size_t payloads) {
+  return std::min(max_window, payloads * max_payload);
+}
+}  // namespace congestion_control_internal
+
+FixedWindowControl::FixedWindowControl(std::size_t window_size)
+    : window_size_{window_size} {}
+
+std::size_t FixedWindowControl::window() const { return window_size_; }
+
+void FixedWindowControl::OnAcked(std::size_t /* size */, Duration /* rtt */,
+                                 TimePoint /* current_time */) {}
+
+void FixedWindowControl::OnLost(TimePoint /* current_time */) {}
+
+AimdControl::AimdControl(std::size_t max_window)
+    : max_window_{max_window},
+      window_{max_window},
+      slow_start_threshold_{max_window} {}
+
+std::size_t AimdControl::window() const { return window_; }
+
+void AimdControl::SetMaxPayload(std::size_t max_payload_size) {
+  if (max_payload_ == 0) {
+    window_ = congestion_control_internal::InitialWindow(
+        max_window_, max_payload_size, kInitialPayloads);
+  }
+  max_payload_ = max_payload_size;
+  window_ = std::max(window_, congestion_control_internal::MinWindow(
+                                  max_window_, max_payload_, kMinPayloads));
+}
+
+void AimdControl::OnAcked(std::size_t size, Duration rtt,
+                          TimePoint /* current_time */) {
+  smoothed_rtt_ = (smoothed_rtt_.count() == 0)
+                      ? rtt
+                      : ((smoothed_rtt_ * 7) + rtt) / 8;
+  if (window_ < slow_start_threshold_) {
+    // slow start
+    window_ += size;
+  } else {
+    // congestion avoidance, one payload per acknowledged window
+    acked_size_ += size;
+    if (acked_size_ >= window_) {
+      acked_size_ -= window_;
+      window_ += max_payload_;
+    }
+  }
+  window_ = std::min(window_, max_window_);
+}
+
+void AimdControl::OnLost(TimePoint current_time) {
+  // all the losses during one round trip are the same congestion event
+  if (current_time < recovery_end_) {
+    return;
+  }
+  slow_start_threshold_ =
+      std::max(window_ / 2, congestion_control_internal::MinWindow(
+                                max_window_, max_payload_, kMinPayloads));
+  window_ = slow_start_threshold_;
+  acked_size_ = 0;
+  recovery_end_ = current_time + smoothed_rtt_;
+}
+
+std::size_t AimdControl::slow_start_threshold() const {
+  return slow_start_threshold_;
+}
+
+PacingControl::PacingControl(std::size_t max_window)
+    : max_window_{max_window} {}
+
+std::size_t PacingControl::window() const {
+  auto bw = bandwidth();
+  if ((bw == 0.0) || (min_rtt_.count() == 0)) {
+    return congestion_control_internal::InitialWindow(max_window_, max_payload_,
+                                                      kInitialPayloads);
+  }
+  auto bdp =
+      bw * std::chrono::duration_cast<congestion_control_internal::Seconds>(
+               min_rtt_)
+               .count();
+  auto gain = startup_ ? kStartupGain : kWindowGain;
+  auto window = static_cast<std::size_t>(gain * bdp);
+  return std::clamp(window,
+                    congestion_control_internal::MinWindow(
+                        max_window_, max_payload_, kMinPayloads),
+                    max_window_);
+}
+
+TimePoint PacingControl::SendTime(TimePoint current_time) const {
+  if (bandwidth() == 0.0) {
+    return current_time;
+  }
+  return std::max(current_time, next_send_time_);
+}
+
+void PacingControl::SetMaxPayload(std::size_t max_payload_size) {
+  max_payload_ = max_payload_size;
+}
+
+void PacingControl::OnSent(std::size_t size, TimePoint current_time) {
+  auto bw = bandwidth();
+  if (bw == 0.0) {
+    return;
+  }
+  auto interval = congestion_control_internal::Seconds{
+      static_cast<double>(size) / (bw * PacingGain())};
+  next_send_time_ = std::max(current_time, next_send_time_) +
+                    std::chrono::duration_cast<Duration>(interval);
+}
+
+void PacingControl::OnAcked(std::size_t size, Duration rtt,
+                            TimePoint current_time) {
+  if ((min_rtt_.count() == 0) || (rtt < min_rtt_)) {
+    min_rtt_ = rtt;
+  }
+  if (sample_start_ == TimePoint{}) {
+    sample_start_ = current_time;
+    return;
+  }
+  delivered_ += size;
+  auto elapsed = current_time - sample_start_;
+  if ((elapsed.count() <= 0) || (elapsed < min_rtt_)) {
+    return;
+  }
+
+  // one delivery rate sample per round trip
+  AddBandwidthSample(
+      static_cast<double>(delivered_) /
+      std::chrono::duration_cast<congestion_control_internal::Seconds>(elapsed)
+          .count());
+  delivered_ = 0;
+  sample_start_ = current_time;
+
+  if (!startup_) {
+    ++cycle_index_;
+    return;
+  }
+  // startup is finished if bandwidth stops to grow
+  auto bw = bandwidth();
+  if (bw >= (full_bandwidth_ * 1.25)) {
+    full_bandwidth_ = bw;
+    rounds_without_growth_ = 0;
+  } else if (++rounds_without_growth_ >= 3) {
+    startup_ = false;
+  }
+}
+
+void PacingControl::OnLost(TimePoint /* current_time */) {
+  // loss is not a congestion signal, but the startup overshot the bottleneck
+  startup_ = false;
+}
+
+double PacingControl::bandwidth() const {
+  return *std::max_element(std::begin(bandwidth_samples_),
+                           std::end(bandwidth_samples_));
+}
+
+double PacingControl::PacingGain() const {
+  if (startup_) {
+    return kStartupGain;
+  }
+  return kPacingGains[cycle_index_ % kPacingGains.size()];
+}
+
+void PacingControl::AddBandwidthSample(double sample) {
+  bandwidth_samples_[sample_index_] = sample;
+  sample_index_ = (sample_index_ + 1) % kBandwidthSamples;
+}
+
+std::unique_ptr<ICongestionControl> MakeCongestionControl(
+    SafeStreamConfig const& config) {
+#if AE_SAFE_STREAM_CONGESTION_CONTROL == AE_CONGESTION_AIMD
+  return std::make_unique<AimdControl>(config.window_size);
+#elif AE_SAFE_STREAM_CONGESTION_CONTROL == AE_CONGESTION_PACING
+  return std::make_unique<PacingControl>(config.window_size);
+#else
+  return std::make_unique<FixedWindowControl>(config.window_size);
+#endif
+}
+}  // namespace ae
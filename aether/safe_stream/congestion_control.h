@@ -0,0 +1,160 @@
+/*
+ * Copyright 2026 Aethernet Inc.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef AETHER_SAFE_STREAM_CONGESTION_CONTROL_H_
+#define AETHER_SAFE_STREAM_CONGESTION_CONTROL_H_
+
+#include <array>
+#include <memory>
+#include <cstddef>
+#include <cstdint>
+
+#include "aether/clock.h"
+#include "aether/config.h"
+#include "aether/safe_stream/safe_stream_config.h"
+
+namespace ae {
+/**
+ * \brief Congestion control for safe stream sender.
+ * Sender asks for the window of data allowed to be on the go and the time the
+ * next chunk may be sent, and reports sent, acknowledged and lost data.
+ */
+class ICongestionControl {
+ public:
+  virtual ~ICongestionControl() = default;
+
+  /**
+   * \brief Max size of data on the go.
+   */
+  virtual std::size_t window() const = 0;
+  /**
+   * \brief The time next chunk is allowed to be sent.
+   */
+  virtual TimePoint SendTime(TimePoint current_time) const {
+    return current_time;
+  }
+
+  virtual void SetMaxPayload(std::size_t /* max_payload_size */) {}
+  virtual void OnSent(std::size_t /* size */, TimePoint /* current_time */) {}
+  virtual void OnAcked(std::size_t size, Duration rtt,
+                       TimePoint current_time) = 0;
+  virtual void OnLost(TimePoint current_time) = 0;
+};
+
+/**
+ * \brief Window is fixed to the config's window_size.
+ */
+class FixedWindowControl final : public ICongestionControl {
+ public:
+  explicit FixedWindowControl(std::size_t window_size);
+
+  std::size_t window() const override;
+  void OnAcked(std::size_t size, Duration rtt,
+               TimePoint current_time) override;
+  void OnLost(TimePoint current_time) override;
+
+ private:
+  std::size_t window_size_;
+};
+
+/**
+ * \brief Additive increase multiplicative decrease in NewReno manner.
+ * Window grows by acknowledged size in slow start and by one payload per
+ * window after, and halves once per round trip on loss.
+ */
+class AimdControl final : public ICongestionControl {
+ public:
+  static constexpr std::size_t kInitialPayloads = 4;
+  static constexpr std::size_t kMinPayloads = 2;
+
+  explicit AimdControl(std::size_t max_window);
+
+  std::size_t window() const override;
+  void SetMaxPayload(std::size_t max_payload_size) override;
+  void OnAcked(std::size_t size, Duration rtt,
+               TimePoint current_time) override;
+  void OnLost(TimePoint current_time) override;
+
+  std::size_t slow_start_threshold() const;
+
+ private:
+  std::size_t max_window_;
+  std::size_t max_payload_{};
+  std::size_t window_;
+  std::size_t slow_start_threshold_;
+  std::size_t acked_size_{};
+  Duration smoothed_rtt_{};
+  TimePoint recovery_end_{};
+};
+
+/**
+ * \brief Pacing by the estimated bottleneck bandwidth in BBR manner.
+ * Bandwidth is the max of delivery rate samples taken once per min round trip
+ * time, window is the bandwidth delay product scaled by gain and sending is
+ * spread over time by the bandwidth.
+ */
+class PacingControl final : public ICongestionControl {
+ public:
+  static constexpr std::size_t kInitialPayloads = 4;
+  static constexpr std::size_t kMinPayloads = 4;
+  static constexpr std::size_t kBandwidthSamples = 10;
+  static constexpr double kStartupGain = 2.0;
+  static constexpr double kWindowGain = 2.0;
+  static constexpr std::array kPacingGains{1.25, 0.75, 1.0, 1.0,
+                                           1.0,  1.0,  1.0, 1.0};
+
+  explicit PacingControl(std::size_t max_window);
+
+  std::size_t window() const override;
+  TimePoint SendTime(TimePoint current_time) const override;
+  void SetMaxPayload(std::size_t max_payload_size) override;
+  void OnSent(std::size_t size, TimePoint current_time) override;
+  void OnAcked(std::size_t size, Duration rtt,
+               TimePoint current_time) override;
+  void OnLost(TimePoint current_time) override;
+
+  /**
+   * \brief Estimated bandwidth in bytes per second.
+   */
+  double bandwidth() const;
+
+ private:
+  double PacingGain() const;
+  void AddBandwidthSample(double sample);
+
+  std::size_t max_window_;
+  std::size_t max_payload_{};
+  bool startup_{true};
+  std::uint8_t rounds_without_growth_{};
+  double full_bandwidth_{};
+  std::array<double, kBandwidthSamples> bandwidth_samples_{};
+  std::size_t sample_index_{};
+  std::size_t cycle_index_{};
+  Duration min_rtt_{};
+  std::size_t delivered_{};
+  TimePoint sample_start_{};
+  TimePoint next_send_time_{};
+};
+
+/**
+ * \brief Make congestion control selected by
+ * AE_SAFE_STREAM_CONGESTION_CONTROL.
+ */
+std::unique_ptr<ICongestionControl> MakeCongestionControl(
+    SafeStreamConfig const& config);
+}  // namespace ae
+
+#endif  // AETHER_SAFE_STREAM_CONGESTION_CONTROL_H_
@@ -125,6 +125,23 @@ class CircularBuffer {
     }
     return Ok{res};
   }
+  /**
+   * \brief Read the data with size from start even out of begin_..end_.
+   * Erased data is kept in the buffer until it's overwritten by new data.
+   * \param start - the position to read from
+   */
+  constexpr DSpan ReadRaw(index_type start, std::size_t size) const noexcept {
+    size = std::min(size, kCapacity);
+    std::size_t first_max_size =
+        buffer_.size() - static_cast<std::size_t>(start);
+    std::size_t first_size = std::min(size, first_max_size);
+    DSpan res;
+    res.first = std::span<value_type const>(
+        buffer_.data() + static_cast<std::size_t>(start), first_size);
+    res.second = std::span<value_type const>(buffer_.data(), size - first_size);
+    return res;
+  }
+
   /**
    * \brief Erase data range
    * \param to - the position to erase to must be in range begin_..end_
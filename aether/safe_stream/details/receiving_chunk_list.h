@@ -17,12 +17,17 @@
 #ifndef AETHER_SAFE_STREAM_DETAILS_RECEIVING_CHUNK_LIST_H_
 #define AETHER_SAFE_STREAM_DETAILS_RECEIVING_CHUNK_LIST_H_
 
-#include <map>
-#include <vector>
+#include <span>
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <cassert>
 #include <optional>
 #include <algorithm>
 
+#include "aether/config.h"
 #include "aether/types/ring_index.h"
+#include "aether/safe_stream/details/ring_bitmap.h"
 
 namespace ae {
 enum class ChunkAddResult : std::uint8_t {
@@ -32,111 +37,208 @@ enum class ChunkAddResult : std::uint8_t {
   kAddRepeated,
 };
 
-template <typename Index>
+/**
+ * \brief Received data ranges.
+ * Received bytes are marked in a bitmap over the receiving window, so no
+ * allocations are made after construction and the gaps are found by whole
+ * words.
+ * Repeat counts are kept for at most MaxRepeated repeated chunks, the sender
+ * has no more chunks in flight.
+ */
+template <typename Index,
+          std::size_t MaxRepeated = AE_SAFE_STREAM_MAX_SENDING_CHUNKS>
 class ReceiveChunkList {
  public:
   using IndexType = Index;
   using IndexRangeType = RingIndexRange<Index>;
 
-  struct Chunk {
-    IndexRangeType range;
-    std::uint8_t repeat_count;
-  };
-
-  struct Comparator {
-    using is_transparent = std::true_type;
-
-    bool operator()(IndexType a, IndexType b) const {
-      return IndexComparable{a, self->buffer_begin_} < b;
-    }
-
-    ReceiveChunkList* self;
-  };
-
-  explicit ReceiveChunkList(IndexType buffer_begin) noexcept
-      : buffer_begin_{buffer_begin}, chunks_{Comparator{.self = this}} {}
+  /**
+   * \param window_size data up to window_size after the buffer begin is
+   * accepted.
+   */
+  ReceiveChunkList(IndexType buffer_begin, std::size_t window_size)
+      : buffer_begin_{buffer_begin},
+        received_end_{buffer_begin},
+        received_{window_size + 1} {}
 
   void set_buffer_begin(IndexType buffer_begin) {
+    received_count_ -= received_.Advance(Distance(buffer_begin_, buffer_begin));
     buffer_begin_ = buffer_begin;
   }
 
   ChunkAddResult AddChunk(IndexRangeType range, std::uint8_t repeat_count) {
-    auto [it, inserted] =
-        chunks_.emplace(range.left, Chunk{range, repeat_count});
-    if (!inserted && (it->second.range == range)) {
-      if (it->second.repeat_count >= repeat_count) {
+    auto offset = Offset(range.left);
+    auto size = range.distance() + 1;
+    if ((offset + size) > received_.size()) {
+      return ChunkAddResult::kInvalid;
+    }
+    // repeat count is saved by the chunk begin
+    auto saved_repeat_count = RepeatCount(range.left);
+    if (received_.Find(false, offset, size) == size) {
+      // all the data is already received
+      if (saved_repeat_count >= repeat_count) {
         return ChunkAddResult::kDuplicate;
       }
-      it->second.repeat_count = repeat_count;
+      SaveRepeatCount(range.left, repeat_count);
       return ChunkAddResult::kAddRepeated;
     }
-    // add range in sorted order
-    auto pos = std::lower_bound(std::begin(ranges_), std::end(ranges_), range,
-                                [&](auto const& a, auto const& b) {
-                                  return IndexComparable{
-                                             a.left, buffer_begin_} < b.left;
-                                });
-    ranges_.insert(pos, range);
+    if (saved_repeat_count < repeat_count) {
+      SaveRepeatCount(range.left, repeat_count);
+    }
+    received_count_ += received_.Set(offset, size);
+    if (Distance(buffer_begin_, range.right) >= ReceivedSize()) {
+      received_end_ = range.right + 1;
+    }
     return ChunkAddResult::kAdded;
   }
 
   IndexRangeType ReceiveChunk() const {
+    auto size = received_.Find(false, 0, ReceivedSize());
     IndexRangeType range;
     range.left = buffer_begin_;
-    range.right = buffer_begin_;
-    auto expected_index = range.left;
+    range.right = (size == 0) ? buffer_begin_ : buffer_begin_ + size - 1;
+    return range;
+  }
 
-    for (auto const& r : ranges_) {
-      // if there is a gap, break
-      if (IndexComparable{r.left, buffer_begin_} > expected_index) {
-        break;
+  void Acknowledge(IndexType to) {
+    auto size = Distance(buffer_begin_, to) + 1;
+    received_count_ -= received_.Reset(0, std::min(size, received_.size()));
+    if (size >= ReceivedSize()) {
+      received_end_ = to + 1;
+    }
+    // clear repeat counts in the same range
+    for (std::size_t i = 0; i < repeated_count_;) {
+      if (Distance(buffer_begin_, repeated_[i].begin) < size) {
+        repeated_[i] = repeated_[--repeated_count_];
+      } else {
+        ++i;
       }
-      // if c.right is after range.right, update range.right
-      if (IndexComparable{r.right, buffer_begin_} > range.right) {
-        range.right = r.right;
+    }
+  }
+
+  std::optional<IndexRangeType> FindMissedChunk() const {
+    auto received_size = ReceivedSize();
+    auto missed = received_.Find(false, 0, received_size);
+    if (missed == received_size) {
+      return std::nullopt;
+    }
+    auto missed_begin = buffer_begin_ + missed;
+    auto missed_size = received_.Find(true, missed, received_size - missed);
+    return IndexRangeType{.left = missed_begin,
+                          .right = missed_begin + missed_size - 1};
+  }
+
+  /**
+   * \brief Get received ranges merged into continuous ones.
+   * \param received is filled by the first received.size() ranges.
+   * \return count of the filled ranges.
+   */
+  std::size_t ReceivedRanges(std::span<IndexRangeType> received) const {
+    std::size_t count = 0;
+    auto received_size = ReceivedSize();
+    std::size_t offset = 0;
+    while ((offset < received_size) && (count < received.size())) {
+      offset += received_.Find(true, offset, received_size - offset);
+      if (offset == received_size) {
+        break;
       }
-      expected_index = range.right + 1;
+      auto begin = buffer_begin_ + offset;
+      auto size = received_.Find(false, offset, received_size - offset);
+      received[count++] = IndexRangeType{begin, begin + size - 1};
+      offset += size;
     }
-    return range;
+    return count;
   }
 
-  void Acknowledge(IndexType to) {
-    // remove chunks that are before or equal to `to`
-    std::erase_if(chunks_, [&](auto const& c) {
-      return IndexComparable{c.first, buffer_begin_} <= to;
-    });
-    // remove ranges that are before or equal to `to`
-    std::erase_if(ranges_, [&](auto& r) {
-      if (IndexComparable{r.right, buffer_begin_} <= to) {
-        return true;
+  /**
+   * \brief Get not received ranges inside range.
+   * \param range must start not before the buffer begin.
+   * \param missed is filled by the first missed.size() ranges.
+   * \return count of all the missed ranges, it may be more than filled.
+   */
+  std::size_t MissedRanges(IndexRangeType range,
+                           std::span<IndexRangeType> missed) const {
+    std::size_t count = 0;
+    auto range_offset = Offset(range.left);
+    auto size = range.distance() + 1;
+    assert((range_offset + size) <= received_.size());
+    std::size_t offset = 0;
+    while (offset < size) {
+      offset += received_.Find(false, range_offset + offset, size - offset);
+      if (offset == size) {
+        break;
       }
-      // if range overlaps with `to`, shift left boundary
-      if (IndexComparable{r.left, buffer_begin_} <= to) {
-        r.left = to + 1;
-        return false;
+      auto begin = range.left + offset;
+      auto missed_size =
+          received_.Find(true, range_offset + offset, size - offset);
+      if (count < missed.size()) {
+        missed[count] = IndexRangeType{begin, begin + missed_size - 1};
       }
-      return false;
-    });
+      ++count;
+      offset += missed_size;
+    }
+    return count;
   }
 
-  std::optional<IndexRangeType> FindMissedChunk() const {
-    auto expected = buffer_begin_;
-    for (auto const& r : ranges_) {
-      if (IndexComparable{r.left, buffer_begin_} > expected) {
-        IndexRangeType missed{.left = expected, .right = r.left - 1};
-        return missed;
+  bool empty() const { return received_count_ == 0; }
+
+ private:
+  struct Repeated {
+    IndexType begin;
+    std::uint8_t repeat_count;
+  };
+
+  // size from buffer begin to the end of the last received data
+  std::size_t ReceivedSize() const {
+    return Distance(buffer_begin_, received_end_);
+  }
+
+  // offset of the index in the received bitmap
+  std::size_t Offset(IndexType index) const {
+    return Distance(buffer_begin_, index);
+  }
+
+  // saved repeat count of the chunk, 0 if it was not repeated
+  std::uint8_t RepeatCount(IndexType begin) const {
+    for (std::size_t i = 0; i < repeated_count_; ++i) {
+      if (repeated_[i].begin == begin) {
+        return repeated_[i].repeat_count;
       }
-      expected = r.right + 1;
     }
-    return std::nullopt;
+    return 0;
   }
 
-  bool empty() const { return chunks_.empty(); }
+  void SaveRepeatCount(IndexType begin, std::uint8_t repeat_count) {
+    Repeated* slot = nullptr;
+    for (std::size_t i = 0; i < repeated_count_; ++i) {
+      if (repeated_[i].begin == begin) {
+        slot = &repeated_[i];
+        break;
+      }
+    }
+    if ((slot == nullptr) && (repeated_count_ < MaxRepeated)) {
+      slot = &repeated_[repeated_count_++];
+    }
+    if (slot == nullptr) {
+      // dropped count is read as 0, so drop the least one
+      slot = &*std::min_element(
+          std::begin(repeated_), std::end(repeated_),
+          [](auto const& l, auto const& r) {
+            return l.repeat_count < r.repeat_count;
+          });
+      if (slot->repeat_count >= repeat_count) {
+        return;
+      }
+    }
+    *slot = Repeated{begin, repeat_count};
+  }
 
- private:
   IndexType buffer_begin_{};
-  std::map<Index, Chunk, Comparator> chunks_;
-  std::vector<IndexRangeType> ranges_;
+  IndexType received_end_{};
+  RingBitmap received_;
+  std::size_t received_count_{};
+  std::array<Repeated, MaxRepeated> repeated_{};
+  std::size_t repeated_count_{};
 };
 }  // namespace ae
 
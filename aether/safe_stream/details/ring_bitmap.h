@@ -0,0 +1,168 @@
+/*
+ * Copyright 2026 Aethernet Inc.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef AETHER_SAFE_STREAM_DETAILS_RING_BITMAP_H_
+#define AETHER_SAFE_STREAM_DETAILS_RING_BITMAP_H_
+
+#include <bit>
+#include <vector>
+#include <cstddef>
+#include <cstdint>
+#include <cassert>
+#include <algorithm>
+
+namespace ae {
+/**
+ * \brief Bitmap over a sliding range of the ring buffer.
+ * Bits are addressed by the offset from the range begin, the range slides
+ * forward by Advance. Storage is allocated once by the range size and bits
+ * wrap around its end. All the operations process the whole words.
+ */
+class RingBitmap {
+  using Word = std::uint64_t;
+  static constexpr std::size_t kWordBits = sizeof(Word) * 8;
+
+ public:
+  explicit RingBitmap(std::size_t size)
+      : size_{size}, words_((size + kWordBits - 1) / kWordBits) {
+    assert(size_ != 0);
+  }
+
+  std::size_t size() const { return size_; }
+
+  /**
+   * \brief Set bits in range [offset, offset + count).
+   * \return the count of bits changed.
+   */
+  std::size_t Set(std::size_t offset, std::size_t count) {
+    std::size_t changed = 0;
+    ForEachWord(offset, count, [&](std::size_t w, Word mask) {
+      if (auto bits = mask & ~words_[w]; bits != 0) {
+        changed += static_cast<std::size_t>(std::popcount(bits));
+        words_[w] |= bits;
+      }
+    });
+    return changed;
+  }
+
+  /**
+   * \brief Reset bits in range [offset, offset + count).
+   * \return the count of bits changed.
+   */
+  std::size_t Reset(std::size_t offset, std::size_t count) {
+    std::size_t changed = 0;
+    ForEachWord(offset, count, [&](std::size_t w, Word mask) {
+      // already reset words are common, skip them cheap
+      if (auto bits = mask & words_[w]; bits != 0) {
+        changed += static_cast<std::size_t>(std::popcount(bits));
+        words_[w] &= ~bits;
+      }
+    });
+    return changed;
+  }
+
+  /**
+   * \brief Find the first bit equal to value in range [offset, offset +
+   * count).
+   * \return offset of the bit from offset or count if there is no such bit.
+   */
+  std::size_t Find(bool value, std::size_t offset, std::size_t count) const {
+    if (count == 0) {
+      return 0;
+    }
+    assert((offset + count) <= size_);
+    auto pos = Pos(offset);
+    auto first = std::min(count, size_ - pos);
+    auto found = FindLinear(value, pos, pos + first);
+    if (found != (pos + first)) {
+      return found - pos;
+    }
+    return first + FindLinear(value, 0, count - first);
+  }
+
+  /**
+   * \brief Move the range begin forward by count.
+   * Bits left behind are reset to be reused at the range end.
+   * \return the count of bits reset.
+   */
+  std::size_t Advance(std::size_t count) {
+    auto changed = Reset(0, std::min(count, size_));
+    begin_ = Pos(count % size_);
+    return changed;
+  }
+
+ private:
+  // offset must be less than size
+  std::size_t Pos(std::size_t offset) const {
+    auto pos = begin_ + offset;
+    return (pos >= size_) ? (pos - size_) : pos;
+  }
+
+  /**
+   * \brief Call f(word_index, mask) for each word in range.
+   */
+  template <typename F>
+  void ForEachWord(std::size_t offset, std::size_t count, F&& f) const {
+    if (count == 0) {
+      return;
+    }
+    assert((offset + count) <= size_);
+    auto pos = Pos(offset);
+    auto first = std::min(count, size_ - pos);
+    ForEachWordLinear(pos, pos + first, f);
+    ForEachWordLinear(0, count - first, f);
+  }
+
+  template <typename F>
+  static void ForEachWordLinear(std::size_t begin, std::size_t end, F& f) {
+    while (begin < end) {
+      auto bits = std::min(kWordBits - (begin % kWordBits), end - begin);
+      auto mask = (bits == kWordBits)
+                      ? ~Word{0}
+                      : (((Word{1} << bits) - 1) << (begin % kWordBits));
+      f(begin / kWordBits, mask);
+      begin += bits;
+    }
+  }
+
+  // position of the first bit equal to value in [begin, end) or end
+  std::size_t FindLinear(bool value, std::size_t begin, std::size_t end) const {
+    if (begin >= end) {
+      return end;
+    }
+    // search for set bits in inverted words if value is false
+    auto invert = value ? Word{0} : ~Word{0};
+    auto w = begin / kWordBits;
+    auto last = (end - 1) / kWordBits;
+    auto bits = (words_[w] ^ invert) & (~Word{0} << (begin % kWordBits));
+    while (bits == 0) {
+      if (++w > last) {
+        return end;
+      }
+      bits = words_[w] ^ invert;
+    }
+    auto found =
+        (w * kWordBits) + static_cast<std::size_t>(std::countr_zero(bits));
+    return std::min(found, end);
+  }
+
+  std::size_t size_;
+  std::size_t begin_{};
+  std::vector<Word> words_;
+};
+}  // namespace ae
+
+#endif  // AETHER_SAFE_STREAM_DETAILS_RING_BITMAP_H_
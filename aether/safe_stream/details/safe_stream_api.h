@@ -17,10 +17,12 @@
 #ifndef AETHER_SAFE_STREAM_DETAILS_SAFE_STREAM_API_H_
 #define AETHER_SAFE_STREAM_DETAILS_SAFE_STREAM_API_H_
 
+#include <vector>
 #include <cstdint>
 
 #include "aether/types/data_buffer.h"
 #include "aether/api_protocol/api_protocol.h"
+#include "aether/safe_stream/details/safe_stream_data_message.h"
 
 namespace ae {
 class SafeStreamApi : public ApiClassImpl<SafeStreamApi> {
@@ -30,7 +32,12 @@ class SafeStreamApi : public ApiClassImpl<SafeStreamApi> {
         ack{protocol_context},
         request_repeat{protocol_context},
         send_reset{protocol_context},
-        send{protocol_context} {}
+        send{protocol_context},
+        selective_ack{protocol_context},
+        send_reset_spans{protocol_context},
+        send_spans{protocol_context},
+        fec_parity{protocol_context},
+        selective_ack_span{protocol_context} {}
 
   virtual ~SafeStreamApi() = default;
 
@@ -42,6 +49,18 @@ class SafeStreamApi : public ApiClassImpl<SafeStreamApi> {
   Method<6, void(std::uint16_t index, std::uint16_t delta_offset,
                  std::uint8_t repeat_count, DataBuffer data)>
       send;
+  Method<7, void(std::vector<SelectiveAckRange> ranges)> selective_ack;
+  // send_reset and send writing data directly from the sender's buffer
+  Method<5, void(std::uint16_t index, std::uint16_t delta_offset,
+                 std::uint8_t repeat_count, DataSpans data)>
+      send_reset_spans;
+  Method<6, void(std::uint16_t index, std::uint16_t delta_offset,
+                 std::uint8_t repeat_count, DataSpans data)>
+      send_spans;
+  Method<8, void(std::uint16_t index, std::uint16_t size, DataBuffer parity)>
+      fec_parity;
+  // selective_ack writing ranges directly from the receiver's array
+  Method<7, void(SelectiveAckSpan ranges)> selective_ack_span;
 
   /**
    * \brief Acknowledgment for data buffer up to index
@@ -56,11 +75,23 @@ class SafeStreamApi : public ApiClassImpl<SafeStreamApi> {
                              std::uint8_t repeat_count, DataBuffer data) = 0;
   virtual void SendImpl(std::uint16_t begin_offset, std::uint16_t delta_offset,
                         std::uint8_t repeat_count, DataBuffer data) = 0;
+  /**
+   * \brief Ranges of data the other side already received after a missed
+   * one, they are skipped on repeat.
+   */
+  virtual void SelectiveAckImpl(std::vector<SelectiveAckRange> ranges) = 0;
+  /**
+   * \brief XOR parity for size bytes of data from index.
+   */
+  virtual void FecParityImpl(std::uint16_t index, std::uint16_t size,
+                             DataBuffer parity) = 0;
 
   AE_METHODS(RegMethod<3, &SafeStreamApi::AckImpl>,
              RegMethod<4, &SafeStreamApi::RequestRepeatImpl>,
              RegMethod<5, &SafeStreamApi::SendResetImpl>,
-             RegMethod<6, &SafeStreamApi::SendImpl>);
+             RegMethod<6, &SafeStreamApi::SendImpl>,
+             RegMethod<7, &SafeStreamApi::SelectiveAckImpl>,
+             RegMethod<8, &SafeStreamApi::FecParityImpl>);
 };
 
 }  // namespace ae
@@ -17,8 +17,11 @@
 #ifndef AETHER_SAFE_STREAM_DETAILS_SAFE_STREAM_DATA_MESSAGE_H_
 #define AETHER_SAFE_STREAM_DETAILS_SAFE_STREAM_DATA_MESSAGE_H_
 
+#include <span>
 #include <cstdint>
 
+#include "aether-miscpp/reflect/reflect.h"
+#include "aether/mstream.h"
 #include "aether/types/data_buffer.h"
 
 namespace ae {
@@ -31,6 +34,75 @@ struct DataMessage {
   std::uint16_t delta_offset;  // data offset form sender's buffer begin
   DataBuffer data;
 };
+
+/**
+ * \brief Data which is placed in two parts, e.g. wrapped around the sending
+ * ring buffer.
+ * Serialized exactly as DataBuffer, but without gathering it to one buffer.
+ */
+struct DataSpans {
+  std::size_t size() const noexcept { return first.size() + second.size(); }
+
+  template <typename Ob>
+  friend omstream<Ob>& operator<<(omstream<Ob>& s, DataSpans const& data) {
+    s << static_cast<typename Ob::size_type>(data.size());
+    s.write(data.first.data(), data.first.size());
+    s.write(data.second.data(), data.second.size());
+    return s;
+  }
+
+  std::span<std::uint8_t const> first;
+  std::span<std::uint8_t const> second;
+};
+
+/**
+ * \brief The data message referencing the data in the sender's buffer.
+ * The same as DataMessage but the data is not owned.
+ */
+struct DataSpansMessage {
+  bool reset;
+  std::uint8_t repeat_count;
+  std::uint16_t delta_offset;  // data offset form sender's buffer begin
+  DataSpans data;
+};
+
+/**
+ * \brief XOR parity of the group of data chunks.
+ * The group is size bytes of data from the group index, the byte with offset i
+ * is added to the parity byte i % parity.size().
+ */
+struct FecParityMessage {
+  std::uint16_t size;
+  DataBuffer parity;
+};
+
+/**
+ * \brief The range of data [left:right] the receiver already has.
+ */
+struct SelectiveAckRange {
+  AE_REFLECT_MEMBERS(left, right)
+
+  std::uint16_t left;
+  std::uint16_t right;
+};
+
+/**
+ * \brief Selective ack ranges not owned by the message.
+ * Serialized exactly as std::vector<SelectiveAckRange>.
+ */
+struct SelectiveAckSpan {
+  template <typename Ob>
+  friend omstream<Ob>& operator<<(omstream<Ob>& s,
+                                  SelectiveAckSpan const& span) {
+    s << static_cast<typename Ob::size_type>(span.ranges.size());
+    for (auto const& range : span.ranges) {
+      s << range;
+    }
+    return s;
+  }
+
+  std::span<SelectiveAckRange const> ranges;
+};
 }  // namespace ae
 
 #endif  // AETHER_SAFE_STREAM_DETAILS_SAFE_STREAM_DATA_MESSAGE_H_
@@ -17,11 +17,15 @@
 #ifndef AETHER_SAFE_STREAM_DETAILS_SAFE_STREAM_RECV_ACTION_H_
 #define AETHER_SAFE_STREAM_DETAILS_SAFE_STREAM_RECV_ACTION_H_
 
+#include <span>
+#include <array>
+#include <vector>
 #include <optional>
 
 #include "aether/ae_context.h"
 #include "aether/common.h"
 #include "aether/events/events.h"
+#include "aether/types/data_buffer_pool.h"
 #include "aether/safe_stream/details/circular_buffer.h"
 #include "aether/safe_stream/details/receiving_chunk_list.h"
 #include "aether/safe_stream/details/safe_stream_data_message.h"
@@ -35,7 +39,11 @@ class ISendAckRepeat {
   virtual ~ISendAckRepeat() = default;
 
   virtual void SendAck(std::uint16_t index) = 0;
-  virtual void SendRepeatRequest(std::uint16_t index) = 0;
+  /**
+   * \brief Request repeat from index, received ranges after it are skipped.
+   */
+  virtual void SendRepeatRequest(
+      std::uint16_t index, std::span<SelectiveAckRange const> received) = 0;
 };
 
 template <std::size_t Capacity>
@@ -49,6 +57,13 @@ class SafeStreamRecvAction {
 
   using ReceiveEvent = Event<void(DataBuffer&& data)>;
 
+  // max ranges reported with repeat request
+  static constexpr std::size_t kMaxSelectiveAckRanges = 8;
+  // max lost ranges of one group restored by parity
+  static constexpr std::size_t kMaxRestoredRanges = 8;
+  // max parity groups waiting for the data to restore
+  static constexpr std::size_t kMaxPendingParity = 4;
+
   SafeStreamRecvAction(AeContext const& ae_context,
                        ISendAckRepeat& send_ack_repeat,
                        SafeStreamConfig const& config)
@@ -84,7 +99,8 @@ class SafeStreamRecvAction {
     if (reset) {
       session_offset = index;
       buffer_.Reset(static_cast<std::size_t>(index));
-      chunks_.emplace(buffer_.begin());
+      chunks_.emplace(buffer_.begin(), window_size_);
+      pending_parity_.clear();
     }
 
     auto received_index =
@@ -92,11 +108,35 @@ class SafeStreamRecvAction {
     HandleData(received_index, data_message.repeat_count, data_message.data);
   }
 
+  /**
+   * \brief Parity for the group of data, used to restore one lost chunk of
+   * the group without waiting for repeat.
+   */
+  void PushParity(std::uint16_t index, FecParityMessage message) {
+    if (!chunks_ || (message.size == 0) || message.parity.empty()) {
+      return;
+    }
+    auto group_begin = IndexType{static_cast<std::size_t>(index)};
+    auto group = IndexRangeType{group_begin, group_begin + message.size - 1};
+    AE_TELED_DEBUG("Parity received for range {}-{}", group.left, group.right);
+    if (pending_parity_.size() >= kMaxPendingParity) {
+      pending_parity_.erase(std::begin(pending_parity_));
+    }
+    pending_parity_.emplace_back(
+        PendingParity{group, std::move(message.parity)});
+    EnqueueRecv();
+  }
+
   ReceiveEvent::Subscriber receive_event() {
     return EventSubscriber{receive_event_};
   }
 
  private:
+  struct PendingParity {
+    IndexRangeType range;
+    DataBuffer parity;
+  };
+
   void HandleData(IndexType received_index, std::uint8_t repeat_count,
                   DataBuffer const& data) {
     auto received_range =
@@ -124,6 +164,10 @@ class SafeStreamRecvAction {
     // TODO: add handle old acknowledged chunks
     auto add_res = chunks_->AddChunk(received_range, repeat_count);
     switch (add_res) {
+      case ChunkAddResult::kInvalid: {
+        AE_TELED_DEBUG("Received chunk is out of the window, ignore!");
+        break;
+      }
       case ChunkAddResult::kDuplicate: {
         AE_TELED_DEBUG("Received duplicate, ignore!");
         break;
@@ -178,6 +222,7 @@ class SafeStreamRecvAction {
     if (!chunks_) {
       return;
     }
+    RestoreFromParity();
     if (chunks_->empty()) {
       return;
     }
@@ -190,14 +235,11 @@ class SafeStreamRecvAction {
     auto res = buffer_.Read(recv_range.left, recv_range.distance() + 1);
     if (res) {
       auto const& dspan = res.value();
-      DataBuffer data_buffer(dspan.size());
-      std::copy(dspan.first.begin(), dspan.first.end(), data_buffer.begin());
-      if (dspan.second.size() != 0) {
-        std::copy(
-            dspan.second.begin(), dspan.second.end(),
-            data_buffer.begin() +
-                static_cast<DataBuffer::difference_type>(dspan.first.size()));
-      }
+      auto data_buffer = DataBufferPool::Acquire(dspan.size());
+      data_buffer.insert(data_buffer.end(), dspan.first.begin(),
+                         dspan.first.end());
+      data_buffer.insert(data_buffer.end(), dspan.second.begin(),
+                         dspan.second.end());
       last_emitted_ = recv_range.right;
       AE_TELED_DEBUG(
           "Emitted received data range: {}-{} size: {}, last_emitted_: {}",
@@ -215,6 +257,82 @@ class SafeStreamRecvAction {
     }
   }
 
+  void RestoreFromParity() {
+    for (auto it = std::begin(pending_parity_);
+         it != std::end(pending_parity_);) {
+      if (RestoreGroup(*it)) {
+        it = pending_parity_.erase(it);
+      } else {
+        ++it;
+      }
+    }
+  }
+
+  /**
+   * \brief Restore the lost data of the group if possible.
+   * The lost bytes are restored by XOR of the parity with all the received
+   * bytes of the group, so only one byte per parity byte may be lost.
+   * \return true if parity is not required anymore.
+   */
+  bool RestoreGroup(PendingParity const& pending) {
+    auto const& group = pending.range;
+    if (Distance(buffer_.begin(), group.right) > window_size_) {
+      // whole group is already received
+      return true;
+    }
+    // already emitted data is still in the buffer
+    auto check_range = group;
+    if (Distance(buffer_.begin(), group.left) > window_size_) {
+      check_range.left = buffer_.begin();
+    }
+    auto missed_ranges = std::array<IndexRangeType, kMaxRestoredRanges>{};
+    auto missed_count = chunks_->MissedRanges(check_range, missed_ranges);
+    if (missed_count == 0) {
+      return true;
+    }
+    if (missed_count > missed_ranges.size()) {
+      // wait for more data or for repeat
+      return false;
+    }
+    auto missed = std::span{missed_ranges}.first(missed_count);
+    auto columns = pending.parity.size();
+    if (Distance(missed.front().left, missed.back().right) >= columns) {
+      // wait for more data or for repeat
+      return false;
+    }
+
+    AE_TELED_DEBUG("Restore {} lost ranges by parity for range {}-{}",
+                   missed.size(), group.left, group.right);
+    auto restored = pending.parity;
+    auto add_received = [&](std::size_t offset, std::size_t size) {
+      auto dspan = buffer_.ReadRaw(group.left + offset, size);
+      for (auto const& part : {dspan.first, dspan.second}) {
+        for (auto b : part) {
+          restored[offset++ % columns] ^= b;
+        }
+      }
+    };
+    auto group_size = group.distance() + 1;
+    std::size_t offset = 0;
+    for (auto const& m : missed) {
+      auto missed_offset = Distance(group.left, m.left);
+      add_received(offset, missed_offset - offset);
+      offset = Distance(group.left, m.right) + 1;
+    }
+    add_received(offset, group_size - offset);
+
+    for (auto const& m : missed) {
+      auto missed_offset = Distance(group.left, m.left);
+      auto size = m.distance() + 1;
+      auto data = DataBufferPool::Acquire(size);
+      for (std::size_t i = 0; i < size; ++i) {
+        data.push_back(restored[(missed_offset + i) % columns]);
+      }
+      HandleData(m.left, 0, data);
+    }
+    return true;
+  }
+
   void HandleAcknowledgement() {
     auto ack_offset = static_cast<std::size_t>(last_emitted_);
     AE_TELED_DEBUG("Send acknowledgement for offset: {}", ack_offset);
@@ -229,8 +347,18 @@ class SafeStreamRecvAction {
       AE_TELED_DEBUG("Send repeat request for offset range {}-{}", res->left,
                      res->right);
       auto request_offset = static_cast<std::size_t>(res->left);
+      auto ranges = std::array<IndexRangeType, kMaxSelectiveAckRanges>{};
+      auto count = chunks_->ReceivedRanges(ranges);
+      auto received = std::array<SelectiveAckRange, kMaxSelectiveAckRanges>{};
+      for (std::size_t i = 0; i < count; ++i) {
+        received[i] = SelectiveAckRange{
+            .left = static_cast<std::uint16_t>(ranges[i].left),
+            .right = static_cast<std::uint16_t>(ranges[i].right),
+        };
+      }
       send_ack_repeat_->SendRepeatRequest(
-          static_cast<std::uint16_t>(request_offset));
+          static_cast<std::uint16_t>(request_offset),
+          std::span{received}.first(count));
       // enqueue again
       missing_timer_.Reset();
       EnqueueMissing();
@@ -248,12 +376,13 @@ class SafeStreamRecvAction {
   std::optional<ReceiveChunkListImpl> chunks_;
   std::size_t session_offset{};  //< current session start offset
   IndexType last_emitted_{};
+  std::vector<PendingParity> pending_parity_;
 
   TaskSubscription recv_enqueued_;
   TaskSubscription ack_timer_;
   TaskSubscription missing_timer_;
 
-  ReceiveEvent receive_event_;
+  ReceiveEvent receive_event_{EventSyncPolicy::kSingleThread};
 };
 }  // namespace ae
 
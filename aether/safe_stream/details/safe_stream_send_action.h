@@ -17,7 +17,11 @@
 #ifndef AETHER_SAFE_STREAM_DETAILS_SAFE_STREAM_SEND_ACTION_H_
 #define AETHER_SAFE_STREAM_DETAILS_SAFE_STREAM_SEND_ACTION_H_
 
+#include <span>
+#include <memory>
+#include <vector>
 #include <cstdlib>
+#include <algorithm>
 
 #include "aether/ae_context.h"
 #include "aether/common.h"
@@ -27,7 +31,9 @@
 #include "aether/safe_stream/details/circular_buffer.h"
 #include "aether/safe_stream/details/safe_stream_data_message.h"
 #include "aether/safe_stream/details/sending_chunk_list.h"
+#include "aether/safe_stream/congestion_control.h"
 #include "aether/safe_stream/safe_stream_config.h"
+#include "aether/types/data_buffer_pool.h"
 #include "aether/types/statistic_counter.h"
 #include "aether/write_action/write_action.h"
 
@@ -53,6 +59,31 @@ class ISendDataPush {
   virtual ~ISendDataPush() = default;
   virtual WriteAction& PushData(std::uint16_t index,
                                 DataMessage&& data_message) = 0;
+  /**
+   * \brief Push data referenced in the sender's buffer.
+   * The data must be serialized before return, spans are not valid after.
+   * By default it's copied to the DataMessage.
+   */
+  virtual WriteAction& PushDataSpans(std::uint16_t index,
+                                     DataSpansMessage const& message) {
+    auto data = DataBufferPool::Acquire(message.data.size());
+    data.insert(data.end(), message.data.first.begin(),
+                message.data.first.end());
+    data.insert(data.end(), message.data.second.begin(),
+                message.data.second.end());
+    return PushData(index, DataMessage{
+                               message.reset,
+                               message.repeat_count,
+                               message.delta_offset,
+                               std::move(data),
+                           });
+  }
+  /**
+   * \brief Push XOR parity of the data group starting from index.
+   * Parity is optional, so by default it's not sent.
+   */
+  virtual void PushParity(std::uint16_t /* index */,
+                          FecParityMessage&& /* message */) {}
 };
 
 // TODO: split on templated and not templated parts
@@ -79,10 +110,13 @@ class SafeStreamSendAction {
         send_data_push_{&send_data_push},
         max_repeat_count_{config.max_repeat_count},
         window_size_{config.window_size},
+        fec_group_size_{config.fec_group_size},
+        congestion_control_{MakeCongestionControl(config)},
         sending_buffer_{
             safe_stream_send_action_internal::RandomOffset<std::size_t>()},
-        sending_chunks_{sending_buffer_.begin()},
-        last_sent_{sending_buffer_.begin()} {
+        sending_chunks_{sending_buffer_.begin(), window_size_},
+        last_sent_{sending_buffer_.begin()},
+        fec_group_begin_{sending_buffer_.begin()} {
     assert((window_size_ < Capacity / 2) &&
            "Window size should be less than half of capacity");
     // set first response timeout
@@ -129,16 +163,21 @@ class SafeStreamSendAction {
     // receiving an ack means the other side synced its state
     init_state_ = false;
 
+    auto current_time = Now();
     if (!sending_chunks_.empty()) {
       auto response_duration = std::chrono::duration_cast<Duration>(
-          Now() - sending_chunks_.front().send_time);
+          current_time - sending_chunks_.front().send_time);
       response_statistics_.Add(response_duration);
+      congestion_control_->OnAcked(
+          Distance(sending_buffer_.begin(), confirm_index + 1),
+          response_duration, current_time);
     }
 
     if (IndexComparable{last_sent_, sending_buffer_.begin()} < confirm_index) {
       last_sent_ = confirm_index + 1;
     }
     acknowledged_event_.Emit(sending_buffer_.begin(), confirm_index);
+    ReleaseParity(confirm_index);
     sending_buffer_.Erase(confirm_index + 1);
     sending_chunks_.RemoveUpTo(confirm_index);
     sending_chunks_.set_buffer_begin(sending_buffer_.begin());
@@ -150,6 +189,30 @@ class SafeStreamSendAction {
     return true;
   }
 
+  /**
+   * \brief Mark ranges received by the other side to not repeat them.
+   */
+  void SelectiveAcknowledge(std::span<SelectiveAckRange const> ranges) {
+    auto current_range =
+        IndexRangeType{sending_buffer_.begin(), sending_buffer_.end()};
+    for (auto const& r : ranges) {
+      auto range = IndexRangeType{IndexType{r.left}, IndexType{r.right}};
+      if (!current_range.InRange(range.left, sending_buffer_.begin()) ||
+          !current_range.InRange(range.right, sending_buffer_.begin()) ||
+          range.IsFlipped(sending_buffer_.begin())) {
+        AE_TELED_DEBUG("Selective ack {}-{} is not in a current range",
+                       range.left, range.right);
+        continue;
+      }
+      AE_TELED_DEBUG("Receive selective ack for range {}-{}", range.left,
+                     range.right);
+      sending_chunks_.Acknowledge(range);
+    }
+    // the oldest waiting chunk may be changed
+    repeat_timer_.Reset();
+    EnqueueRepeatTimeout();
+  }
+
   void RequestRepeat(std::uint16_t request_offset) {
     auto request_index = IndexType(request_offset);
     // if not in a current range
@@ -159,6 +222,7 @@ class SafeStreamSendAction {
                        request_index);
       return;
     }
+    congestion_control_->OnLost(Now());
     last_sent_ = request_index;
     EnqueueSend();
   }
@@ -166,9 +230,24 @@ class SafeStreamSendAction {
   void SetMaxPayload(std::size_t max_payload_size) {
     AE_TELED_DEBUG("Set max payload to {}", max_payload_size);
     max_payload_size_ = max_payload_size;
+    congestion_control_->SetMaxPayload(max_payload_size);
     EnqueueSend();
   }
 
+  /**
+   * \brief Replace congestion control selected by config.
+   */
+  void SetCongestionControl(
+      std::unique_ptr<ICongestionControl> congestion_control) {
+    congestion_control_ = std::move(congestion_control);
+    congestion_control_->SetMaxPayload(max_payload_size_);
+    EnqueueSend();
+  }
+
+  ICongestionControl const& congestion_control() const {
+    return *congestion_control_;
+  }
+
   AcknowledgedEvent::Subscriber acknowledged_event() {
     return EventSubscriber{acknowledged_event_};
   }
@@ -225,6 +304,7 @@ class SafeStreamSendAction {
       return;
     }
     AE_TELED_DEBUG("Wait ack timeout, repeat offset {}", range.left);
+    congestion_control_->OnLost(Now());
     // if the range was partially acknowledged, repeat from the
     // beginning
     if (sending_buffer_.begin().Distance(range.left) > window_size_) {
@@ -236,15 +316,21 @@ class SafeStreamSendAction {
   }
 
   Result<typename CircularBufferImpl::DSpan, int> GetNextChunk() {
-    auto on_the_go_data_size = Distance(sending_buffer_.begin(), last_sent_);
-    auto payload_size =
-        std::min(max_payload_size_, window_size_ - on_the_go_data_size);
+    // data received by the other side is not repeated
+    last_sent_ = sending_chunks_.SkipAcknowledged(last_sent_);
+    auto on_the_go_data_size =
+        Distance(sending_buffer_.begin(), last_sent_) + fec_parity_on_the_go_;
+    // the window may be shrunk below the data already on the go
+    auto window = std::min(window_size_, congestion_control_->window());
+    auto payload_size = std::min(
+        {max_payload_size_,
+         ReserveParity(window - std::min(window, on_the_go_data_size)),
+         sending_chunks_.UnacknowledgedSize(last_sent_)});
     if (payload_size == 0) {
       AE_TELED_WARNING(
           "Window size exceeded: begin: {} last_sent: {} on the go data "
           "size: {}, window size: {}",
-          sending_buffer_.begin(), last_sent_, on_the_go_data_size,
-          window_size_);
+          sending_buffer_.begin(), last_sent_, on_the_go_data_size, window);
       // return empty span
       return Ok{typename CircularBufferImpl::DSpan{}};
     }
@@ -282,6 +368,8 @@ class SafeStreamSendAction {
   /**
     The logic to actually send data.
      - check if max_payload_size_ is set
+     - wait for the time congestion control paces the next chunk
+     - send the parity of the closed data group in its own paced slot
      - read chunk of data from the buffer starting from last_sent_ index.
      - register new sending chunk and count repeats
      - push the data to send_data_push_ and wait either for timeout or result
@@ -290,6 +378,22 @@ class SafeStreamSendAction {
     if (max_payload_size_ == 0) {
       return;
     }
+    auto send_time = congestion_control_->SendTime(current_time);
+    if (send_time > current_time) {
+      // send enqueued until paced time
+      send_enqueued_ = ae_context_.scheduler().DelayedTask(
+          [this]() {
+            send_enqueued_.Reset();
+            SendChunk(Now());
+          },
+          send_time);
+      return;
+    }
+    if ((fec_group_chunks_ != 0) && (fec_group_chunks_ >= fec_group_size_)) {
+      SendParity(current_time);
+      EnqueueSend();
+      return;
+    }
     auto res = GetNextChunk().Then([&](CircularBufferImpl::DSpan const& dspan) {
       auto chunk_index_range = IndexRangeType{
           .left = last_sent_,
@@ -302,7 +406,10 @@ class SafeStreamSendAction {
     if (!res) {
       AE_TELED_DEBUG("Send chunk error {}", res.error());
       // If any error over empty buffer
-      if (res.error() != 0) {
+      if (res.error() == 0) {
+        // nothing more to send, protect the last data
+        SendParity(current_time);
+      } else {
         AE_TELED_ERROR("Chunk send error!");
         // reject to send all chunks before the failed one
         RejectSend(last_sent_ - 1);
@@ -315,8 +422,12 @@ class SafeStreamSendAction {
     auto const& [dspan, send_chunk] = res.value();
     if (dspan.size() == 0) {
       AE_TELED_DEBUG("No chunks to send!");
+      // the window is full or nothing more to send, close the group within
+      // the room reserved for its parity
+      SendParity(current_time);
       return;
     }
+    congestion_control_->OnSent(dspan.size(), current_time);
 
     send_subs_ +=
         PushData(dspan, send_chunk.range.left, send_chunk.repeat_count - 1)
@@ -336,6 +447,8 @@ class SafeStreamSendAction {
                   break;
               }
             });
+    AddToParity(dspan, send_chunk.range, send_chunk.repeat_count,
+                current_time);
     // enqueue next chunk send and setup repeat timeout
     EnqueueSend();
     EnqueueRepeatTimeout();
@@ -345,6 +458,7 @@ class SafeStreamSendAction {
     // send failed for a chunk
     send_failed_event_.Emit(sending_buffer_.begin(), end_index);
 
+    ReleaseParity(end_index);
     sending_buffer_.Erase(end_index + 1);
     sending_chunks_.RemoveUpTo(end_index);
     sending_chunks_.set_buffer_begin(sending_buffer_.begin());
@@ -361,41 +475,137 @@ class SafeStreamSendAction {
         sending_buffer_.begin(), data_index, static_cast<int>(repeat_count),
         init_state_, dspan.size());
 
-    DataBuffer data_buffer(dspan.size());
-    std::copy(dspan.first.begin(), dspan.first.end(), data_buffer.begin());
-    std::copy(dspan.second.begin(), dspan.second.end(),
-              data_buffer.begin() +
-                  static_cast<DataBuffer::difference_type>(dspan.first.size()));
-
-    return send_data_push_->PushData(
+    return send_data_push_->PushDataSpans(
         static_cast<std::uint16_t>(sending_buffer_.begin()),
-        DataMessage{
+        DataSpansMessage{
             init_state_,
             repeat_count,
             static_cast<std::uint16_t>(
                 sending_buffer_.begin().Distance(data_index)),
-            std::move(std::move(data_buffer)),
+            DataSpans{dspan.first, dspan.second},
         });
   }
 
+  /**
+   * \brief Reduce the free window by the room for the parity of the current
+   * data group.
+   * The open group needs up to fec_columns_ bytes, the new one needs as much
+   * as its first chunk.
+   */
+  std::size_t ReserveParity(std::size_t free_window) const {
+    if (fec_group_size_ == 0) {
+      return free_window;
+    }
+    if (fec_group_chunks_ == 0) {
+      return free_window / 2;
+    }
+    return free_window - std::min(free_window, fec_columns_);
+  }
+
+  /**
+   * \brief Add the new data chunk to the parity group.
+   * Only the data sent the first time one after another is grouped, the
+   * group is closed by fec_group_size_ chunks, if the window is full or if
+   * nothing more to send.
+   */
+  void AddToParity(CircularBufferImpl::DSpan const& dspan,
+                   IndexRangeType const& range, std::uint8_t repeat_count,
+                   TimePoint current_time) {
+    if ((fec_group_size_ == 0) || (repeat_count != 1)) {
+      return;
+    }
+    if ((fec_group_chunks_ != 0) &&
+        (range.left != fec_group_begin_ + fec_group_data_size_)) {
+      SendParity(current_time);
+    }
+    if (fec_group_chunks_ == 0) {
+      fec_group_begin_ = range.left;
+      fec_group_data_size_ = 0;
+      fec_columns_ = max_payload_size_;
+      fec_parity_ = DataBufferPool::Acquire(fec_columns_);
+    }
+    for (auto const& part : {dspan.first, dspan.second}) {
+      for (auto b : part) {
+        auto column = fec_group_data_size_ % fec_columns_;
+        if (column < fec_parity_.size()) {
+          fec_parity_[column] ^= b;
+        } else {
+          fec_parity_.push_back(b);
+        }
+        ++fec_group_data_size_;
+      }
+    }
+    // the full group is closed by the next paced send
+    ++fec_group_chunks_;
+  }
+
+  /**
+   * \brief Send parity of the current group.
+   * Parity is charged to the congestion control and stays in the window until
+   * the data of its group is acknowledged.
+   */
+  void SendParity(TimePoint current_time) {
+    if (fec_group_chunks_ == 0) {
+      return;
+    }
+    AE_TELED_DEBUG("Send parity for group {} size {}", fec_group_begin_,
+                   fec_group_data_size_);
+    fec_group_chunks_ = 0;
+    fec_parities_.push_back(FecParityOnTheGo{
+        fec_group_begin_ + fec_group_data_size_ - 1, fec_parity_.size()});
+    fec_parity_on_the_go_ += fec_parity_.size();
+    congestion_control_->OnSent(fec_parity_.size(), current_time);
+    send_data_push_->PushParity(
+        static_cast<std::uint16_t>(fec_group_begin_),
+        FecParityMessage{static_cast<std::uint16_t>(fec_group_data_size_),
+                         std::move(fec_parity_)});
+  }
+
+  void ReleaseParity(IndexType end_index) {
+    std::erase_if(fec_parities_, [&](auto const& parity) {
+      if (IndexComparable{parity.end, sending_buffer_.begin()} > end_index) {
+        return false;
+      }
+      fec_parity_on_the_go_ -= parity.size;
+      return true;
+    });
+  }
+
+  struct FecParityOnTheGo {
+    IndexType end;  //< last data index of the group
+    std::size_t size;
+  };
+
   AeContext ae_context_;
   ISendDataPush* send_data_push_;
 
   std::uint8_t max_repeat_count_{};
   std::size_t window_size_{};
   std::size_t max_payload_size_{};
+  std::uint8_t fec_group_size_{};
+  std::unique_ptr<ICongestionControl> congestion_control_;
 
   CircularBufferImpl sending_buffer_;
   SendingChunkListImpl sending_chunks_;
   IndexType last_sent_;  //< last index for last sent data
   bool init_state_{true};
 
+  // current parity group
+  IndexType fec_group_begin_;
+  std::size_t fec_group_data_size_{};
+  std::size_t fec_columns_{};
+  std::uint8_t fec_group_chunks_{};
+  DataBuffer fec_parity_;
+  std::vector<FecParityOnTheGo> fec_parities_;
+  std::size_t fec_parity_on_the_go_{};
+
   MultiSubscription sending_data_subs_;
   MultiSubscription send_subs_;
   ResponseStatistics response_statistics_;
-  AcknowledgedEvent acknowledged_event_;
-  StoppedEvent stopped_event_;
-  SendFailedEvent send_failed_event_;
+  // emitted and subscribed on the scheduler only
+  AcknowledgedEvent acknowledged_event_{EventSyncPolicy::kSingleThread};
+  StoppedEvent stopped_event_{EventSyncPolicy::kSingleThread};
+  SendFailedEvent send_failed_event_{EventSyncPolicy::kSingleThread};
   TaskSubscription repeat_timer_;
   TaskSubscription send_enqueued_;
 };
@@ -17,14 +17,33 @@
 #ifndef AETHER_SAFE_STREAM_DETAILS_SENDING_CHUNK_LIST_H_
 #define AETHER_SAFE_STREAM_DETAILS_SENDING_CHUNK_LIST_H_
 
-#include <vector>
+#include <array>
+#include <limits>
+#include <cstdint>
+#include <algorithm>
+#include <type_traits>
 
 #include "aether/clock.h"
+#include "aether/config.h"
 #include "aether/types/ring_index.h"
+#include "aether/safe_stream/details/ring_bitmap.h"
 
 namespace ae {
-template <typename Index>
+/**
+ * \brief The list of sent and not acknowledged yet chunks.
+ * Chunks are kept in a fixed slab, linked in the send order and indexed in
+ * the ring buffer order, so no allocations are made on send and
+ * acknowledgement.
+ * Selective acknowledgements are marked in a bitmap over the sending window.
+ */
+template <typename Index,
+          std::size_t MaxChunks = AE_SAFE_STREAM_MAX_SENDING_CHUNKS>
 class SendingChunkList {
+  using Slot = std::conditional_t<(MaxChunks < 0xFF), std::uint8_t,
+                                  std::uint16_t>;
+  static_assert(MaxChunks < std::numeric_limits<Slot>::max());
+  static constexpr auto kNoSlot = static_cast<Slot>(MaxChunks);
+
  public:
   using IndexRangeType = RingIndexRange<Index>;
 
@@ -34,57 +53,295 @@ class SendingChunkList {
     std::uint8_t repeat_count;
   };
 
-  explicit SendingChunkList(Index buffer_begin) : buffer_begin_{buffer_begin} {}
+  /**
+   * \param window_size data is sent only up to window_size after the buffer
+   * begin.
+   */
+  SendingChunkList(Index buffer_begin, std::size_t window_size)
+      : buffer_begin_{buffer_begin},
+        acknowledged_{window_size},
+        acknowledged_end_{buffer_begin} {
+    for (std::size_t i = 0; i < MaxChunks; ++i) {
+      nodes_[i].next = static_cast<Slot>(i + 1);
+    }
+  }
 
-  void set_buffer_begin(Index buffer_begin) { buffer_begin_ = buffer_begin; }
+  void set_buffer_begin(Index buffer_begin) {
+    acknowledged_.Advance(Distance(buffer_begin_, buffer_begin));
+    buffer_begin_ = buffer_begin;
+  }
 
   /**
    * \brief Register a new sending chunk.
    * If chunk with that index does not exist, it will be created at the end
    * of the list. Otherwise, it will be moved to the end of the list and
    * updated.
+   * Chunks starting inside the new one are replaced by it, as the data may be
+   * resent split differently if the window is changed. The chunk overlapping
+   * the new one's beginning is cut, so chunks never overlap.
+   * If there is no free slot, the new chunk is joined with the neighbour one.
    */
   Chunk& Register(IndexRangeType chunk_range, TimePoint send_time) {
-    auto old_it = std::find_if(
-        std::begin(chunks_), std::end(chunks_),
-        [&](auto const& c) { return c.range.left == chunk_range.left; });
-
     auto chunk =
         Chunk{.range = chunk_range, .send_time = send_time, .repeat_count{}};
 
-    if (old_it != std::end(chunks_)) {
-      chunk.repeat_count = old_it->repeat_count;
-      chunks_.erase(old_it);
+    auto first = LowerBound(chunk_range.left);
+    auto last = first;
+    for (; (last < count_) &&
+           chunk_range.InRange(At(last).chunk.range.left, buffer_begin_);
+         ++last) {
+      chunk.repeat_count =
+          std::max(chunk.repeat_count, At(last).chunk.repeat_count);
+    }
+    EraseOrdered(first, last);
+
+    if (free_ == kNoSlot) {
+      // joined chunk keeps the bigger repeat count, so the data already
+      // repeated is not sent over the max repeat count
+      auto& node = At((first > 0) ? (first - 1) : first);
+      if (IndexComparable{chunk.range.left, buffer_begin_} >
+          node.chunk.range.left) {
+        chunk.range.left = node.chunk.range.left;
+      }
+      if (IndexComparable{chunk.range.right, buffer_begin_} <
+          node.chunk.range.right) {
+        chunk.range.right = node.chunk.range.right;
+      }
+      chunk.repeat_count =
+          std::max(chunk.repeat_count, node.chunk.repeat_count);
+      node.chunk = chunk;
+      MoveToNewest(SlotOf(node));
+      return node.chunk;
     }
-    return chunks_.emplace_back(chunk);
+
+    if (first > 0) {
+      auto& prev = At(first - 1).chunk;
+      if (IndexComparable{prev.range.right, buffer_begin_} >=
+          chunk.range.left) {
+        prev.range.right = chunk.range.left - 1;
+      }
+    }
+
+    auto slot = free_;
+    free_ = nodes_[slot].next;
+    nodes_[slot].chunk = chunk;
+    InsertOrdered(first, slot);
+    LinkNewest(slot);
+    return nodes_[slot].chunk;
   }
 
   /**
    * \brief Remove all chunks up to the given offset.
    */
   void RemoveUpTo(Index to) {
-    std::erase_if(chunks_, [&](auto const& c) {
-      return IndexComparable{c.range.right, buffer_begin_} <= to;
-    });
+    std::size_t last = 0;
+    while ((last < count_) &&
+           (IndexComparable{At(last).chunk.range.right, buffer_begin_} <= to)) {
+      ++last;
+    }
+    EraseOrdered(0, last);
+    // partially acknowledged chunk is repeated from the acknowledged end
+    if ((count_ > 0) &&
+        (IndexComparable{At(0).chunk.range.left, buffer_begin_} <= to)) {
+      At(0).chunk.range.left = to + 1;
+    }
+    auto size = Distance(buffer_begin_, to) + 1;
+    acknowledged_.Reset(0, std::min(size, acknowledged_.size()));
+    if (size >= AcknowledgedSize()) {
+      acknowledged_end_ = to + 1;
+    }
+  }
+
+  /**
+   * \brief Mark the range as received by the other side.
+   * Chunks inside the range are removed and the range is skipped on repeat.
+   */
+  void Acknowledge(IndexRangeType range) {
+    auto first = LowerBound(range.left);
+    auto last = first;
+    while ((last < count_) && (IndexComparable{At(last).chunk.range.right,
+                                               buffer_begin_} <= range.right)) {
+      ++last;
+    }
+    EraseOrdered(first, last);
+    // nothing is sent out of the window
+    auto offset = Distance(buffer_begin_, range.left);
+    if (offset >= acknowledged_.size()) {
+      return;
+    }
+    auto size = std::min(range.distance() + 1, acknowledged_.size() - offset);
+    acknowledged_.Set(offset, size);
+    if ((offset + size) > AcknowledgedSize()) {
+      acknowledged_end_ = range.left + size;
+    }
+  }
+
+  /**
+   * \brief Move index past the acknowledged ranges.
+   */
+  Index SkipAcknowledged(Index index) const {
+    auto size_after = SizeAfter(index);
+    if (size_after == 0) {
+      return index;
+    }
+    return index + acknowledged_.Find(false, Distance(buffer_begin_, index),
+                                      size_after);
+  }
+
+  /**
+   * \brief Size of data from index to the next acknowledged range.
+   * max of std::size_t if there is no acknowledged ranges after index.
+   */
+  std::size_t UnacknowledgedSize(Index index) const {
+    auto size_after = SizeAfter(index);
+    auto size = acknowledged_.Find(true, Distance(buffer_begin_, index),
+                                   size_after);
+    if (size == size_after) {
+      return std::numeric_limits<std::size_t>::max();
+    }
+    return size;
   }
 
+  /**
+   * \brief Select chunk starting inside the range.
+   */
   Chunk* Select(IndexRangeType range) {
-    // TODO: make more precise selection
-    for (auto& c : chunks_) {
-      if (range.InRange(c.range.left, buffer_begin_)) {
-        return &c;
-      }
+    auto i = LowerBound(range.left);
+    if ((i < count_) &&
+        range.InRange(At(i).chunk.range.left, buffer_begin_)) {
+      return &At(i).chunk;
     }
     return nullptr;
   }
 
-  Chunk& front() { return chunks_.front(); }
-  bool empty() const { return chunks_.empty(); }
+  // the chunk sent first
+  Chunk& front() { return nodes_[oldest_].chunk; }
+  bool empty() const { return count_ == 0; }
+  std::size_t size() const { return count_; }
 
  private:
+  struct Node {
+    Chunk chunk;
+    Slot prev;
+    Slot next;
+  };
+
+  Node& At(std::size_t i) { return nodes_[ordered_[(head_ + i) % MaxChunks]]; }
+  Node const& At(std::size_t i) const {
+    return nodes_[ordered_[(head_ + i) % MaxChunks]];
+  }
+  Slot SlotOf(Node const& node) const {
+    return static_cast<Slot>(&node - nodes_.data());
+  }
+
+  // size from buffer begin to the end of the last acknowledged range
+  std::size_t AcknowledgedSize() const {
+    return Distance(buffer_begin_, acknowledged_end_);
+  }
+
+  // size from index to the end of the last acknowledged range
+  std::size_t SizeAfter(Index index) const {
+    auto offset = Distance(buffer_begin_, index);
+    auto acknowledged_size = AcknowledgedSize();
+    return (offset < acknowledged_size) ? (acknowledged_size - offset) : 0;
+  }
+
+  // the first chunk in the ring order which is not before index
+  std::size_t LowerBound(Index index) const {
+    std::size_t first = 0;
+    std::size_t count = count_;
+    while (count > 0) {
+      auto step = count / 2;
+      if (IndexComparable{At(first + step).chunk.range.left, buffer_begin_} <
+          index) {
+        first += step + 1;
+        count -= step + 1;
+      } else {
+        count = step;
+      }
+    }
+    return first;
+  }
+
+  void InsertOrdered(std::size_t pos, Slot slot) {
+    if (pos == 0) {
+      head_ = (head_ + MaxChunks - 1) % MaxChunks;
+    } else {
+      for (std::size_t i = count_; i > pos; --i) {
+        ordered_[(head_ + i) % MaxChunks] =
+            ordered_[(head_ + i - 1) % MaxChunks];
+      }
+    }
+    ordered_[(head_ + pos) % MaxChunks] = slot;
+    ++count_;
+  }
+
+  // erase chunks in [first, last) of the ring order
+  void EraseOrdered(std::size_t first, std::size_t last) {
+    if (first == last) {
+      return;
+    }
+    for (auto i = first; i < last; ++i) {
+      auto slot = ordered_[(head_ + i) % MaxChunks];
+      Unlink(slot);
+      nodes_[slot].next = free_;
+      free_ = slot;
+    }
+    auto erased = last - first;
+    if (first == 0) {
+      head_ = (head_ + erased) % MaxChunks;
+    } else {
+      for (auto i = last; i < count_; ++i) {
+        ordered_[(head_ + i - erased) % MaxChunks] =
+            ordered_[(head_ + i) % MaxChunks];
+      }
+    }
+    count_ -= erased;
+  }
+
+  void LinkNewest(Slot slot) {
+    nodes_[slot].prev = newest_;
+    nodes_[slot].next = kNoSlot;
+    if (newest_ != kNoSlot) {
+      nodes_[newest_].next = slot;
+    } else {
+      oldest_ = slot;
+    }
+    newest_ = slot;
+  }
+
+  void Unlink(Slot slot) {
+    auto& node = nodes_[slot];
+    if (node.prev != kNoSlot) {
+      nodes_[node.prev].next = node.next;
+    } else {
+      oldest_ = node.next;
+    }
+    if (node.next != kNoSlot) {
+      nodes_[node.next].prev = node.prev;
+    } else {
+      newest_ = node.prev;
+    }
+  }
+
+  void MoveToNewest(Slot slot) {
+    Unlink(slot);
+    LinkNewest(slot);
+  }
+
   Index buffer_begin_;
-  // TODO: make a logic without allocations and resorting
-  std::vector<Chunk> chunks_;
+  std::array<Node, MaxChunks> nodes_;
+  // slots sorted in the ring buffer order, starting from head_
+  std::array<Slot, MaxChunks> ordered_{};
+  std::size_t head_{};
+  std::size_t count_{};
+  // send order list
+  Slot oldest_{kNoSlot};
+  Slot newest_{kNoSlot};
+  Slot free_{};
+  // ranges acknowledged selectively
+  RingBitmap acknowledged_;
+  Index acknowledged_end_;
 };
 }  // namespace ae
 
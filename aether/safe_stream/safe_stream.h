@@ -21,6 +21,7 @@
 #include "aether/common.h"
 #include "aether/write_action/failed_write_action.h"
 
+#include "aether/safe_stream/congestion_control.h"
 #include "aether/safe_stream/details/safe_stream_api.h"
 #include "aether/safe_stream/details/safe_stream_data_message.h"
 #include "aether/safe_stream/details/safe_stream_recv_action.h"
@@ -97,6 +98,11 @@ class SafeStream final : public ByteStream,  // NOLINT
 
   StreamInfo stream_info() const override { return stream_info_; }
 
+  void SetCongestionControl(
+      std::unique_ptr<ICongestionControl> congestion_control) {
+    sender_.SetCongestionControl(std::move(congestion_control));
+  }
+
   void LinkOut(OutStream& out) override {
     out_ = &out;
     update_sub_ = out_->stream_update_event().Subscribe(
@@ -126,6 +132,13 @@ class SafeStream final : public ByteStream,  // NOLINT
                                                  .delta_offset = delta_offset,
                                                  .data = std::move(data)});
   }
+  void SelectiveAckImpl(std::vector<SelectiveAckRange> ranges) override {
+    sender_.SelectiveAcknowledge(ranges);
+  }
+  void FecParityImpl(std::uint16_t index, std::uint16_t size,
+                     DataBuffer parity) override {
+    receiver_.PushParity(index, FecParityMessage{size, std::move(parity)});
+  }
 
   // Implement ISendDataPush
   WriteAction& PushData(
@@ -148,6 +161,29 @@ class SafeStream final : public ByteStream,  // NOLINT
     return api_adapter.Flush();
   }
 
+  WriteAction& PushDataSpans(std::uint16_t begin_offset,
+                             DataSpansMessage const& message) override {
+    assert(out_);
+    // data is packed on flush directly from the sender's buffer
+    auto api_adapter = ApiCallAdapter{ApiContext{*this}, *out_};
+    if (message.reset) {
+      api_adapter->send_reset_spans(begin_offset, message.delta_offset,
+                                    message.repeat_count, message.data);
+    } else {
+      api_adapter->send_spans(begin_offset, message.delta_offset,
+                              message.repeat_count, message.data);
+    }
+    // cppcheck-suppress returnReference
+    return api_adapter.Flush();
+  }
+
+  void PushParity(std::uint16_t index, FecParityMessage&& message) override {
+    assert(out_);
+    auto api_adapter = ApiCallAdapter{ApiContext{*this}, *out_};
+    api_adapter->fec_parity(index, message.size, std::move(message.parity));
+    api_adapter.Flush();
+  }
+
   // Implement ISendConfirmRepeat
   void SendAck(std::uint16_t index) override {
     assert(out_);
@@ -156,10 +192,16 @@ class SafeStream final : public ByteStream,  // NOLINT
     api_adapter.Flush();
   }
 
-  void SendRepeatRequest(std::uint16_t index) override {
+  void SendRepeatRequest(
+      std::uint16_t index,
+      std::span<SelectiveAckRange const> received) override {
     assert(out_);
     auto api_adapter = ApiCallAdapter{ApiContext{*this}, *out_};
     api_adapter->request_repeat(index);
+    // after the repeat request, so the side not supporting it still repeats
+    if (!received.empty()) {
+      api_adapter->selective_ack_span(SelectiveAckSpan{received});
+    }
     api_adapter.Flush();
   }
 
@@ -29,6 +29,14 @@ struct SafeStreamConfig {
   Duration wait_ack_timeout;      //< Timeout for waiting ack
   Duration send_ack_timeout;      //< max time to wait before send ack
   Duration send_repeat_timeout;  //< max time to wait before send repeat request
+  /**
+   * Count of data chunks protected by one XOR parity packet, 0 disables
+   * forward error correction.
+   * Receiver restores one lost chunk per group without waiting for repeat.
+   * Only the sender's value matters, the receiver always accepts parity.
+   * Parity is charged to the congestion control like the data.
+   */
+  std::uint8_t fec_group_size{};
 };
 
 }  // namespace ae
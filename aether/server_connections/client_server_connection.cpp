@@ -177,6 +177,7 @@ ClientServerConnection::stream_update_event() {
 
 WriteAction& ClientServerConnection::LoginApiCall(SubApi<LoginApi> login_api) {
   auto packet = login_api(login_api_);
+  SchedulePendingTimeout();
   return server_connection_.Write(std::move(packet));
 }
 
@@ -184,6 +185,7 @@ WriteAction& ClientServerConnection::AuthorizedApiCall(
     SubApi<AuthorizedApi> auth_api) {
   auto api_call = ApiCallAdapter{ApiContext{login_api_}, server_connection_};
   api_call->login_by_alias(ephemeral_uid_, std::move(auth_api));
+  SchedulePendingTimeout();
   // cppcheck reports false positive
   // cppcheck-suppress returnReference
   return api_call.Flush();
@@ -202,4 +204,24 @@ void ClientServerConnection::OutData(DataBuffer const& data) {
   parser.Parse(client_api_unsafe_);
 }
 
+void ClientServerConnection::SchedulePendingTimeout() {
+  auto deadline = protocol_context_.next_pending_deadline();
+  // already waits for the earlier one
+  if (deadline == TimePoint::max() ||
+      (pending_timeout_sub_ && (pending_deadline_ <= deadline))) {
+    return;
+  }
+  pending_deadline_ = deadline;
+  pending_timeout_sub_ = ae_context_.scheduler().DelayedTask(
+      [this]() {
+        // the running task's subscription is released after the callback
+        // returns, the next timeout is scheduled into the empty one
+        auto running_sub = std::move(pending_timeout_sub_);
+        pending_deadline_ = TimePoint::max();
+        protocol_context_.UpdatePending(Now());
+        SchedulePendingTimeout();
+      },
+      deadline);
+}
+
 }  // namespace ae
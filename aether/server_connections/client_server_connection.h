@@ -76,6 +76,8 @@ class ClientServerConnection {
 
  private:
   void OutData(DataBuffer const& data);
+  // drop api responses not received until the deadline
+  void SchedulePendingTimeout();
 
   AeContext ae_context_;
   PtrView<Server> server_;
@@ -88,6 +90,8 @@ class ClientServerConnection {
 
   client_server_connection_internal ::BufferedServerConnection
       server_connection_;
+  TimePoint pending_deadline_{TimePoint::max()};
+  TaskSubscription pending_timeout_sub_;
 };
 }  // namespace ae
 
@@ -16,8 +16,11 @@
 
 #include "aether/stream_api/sized_packet_gate.h"
 
+#include <utility>
+
 #include "aether/mstream.h"
 #include "aether/mstream_buffers.h"
+#include "aether/types/data_buffer_pool.h"
 
 namespace ae {
 
@@ -25,23 +28,25 @@ static constexpr std::size_t kSizedPacketOverhead =
     sizeof(PacketSize::ValueType);  // max for packet size
 
 DataBuffer SizedPacketGate::WriteIn(DataBuffer&& buffer) {
-  DataBuffer write_buffer;
-  write_buffer.reserve(buffer.size() + kSizedPacketOverhead);
+  auto write_buffer =
+      DataBufferPool::Acquire(buffer.size() + kSizedPacketOverhead);
 
   auto buffer_writer = VectorWriter<PacketSize>(write_buffer);
   auto os = omstream{buffer_writer};
   os << buffer;
 
+  DataBufferPool::Release(std::move(buffer));
   return write_buffer;
 }
 
 void SizedPacketGate::WriteOut(DataBuffer const& buffer) {
   data_packet_collector_.AddData(buffer.data(), buffer.size());
 
-  for (auto packet = data_packet_collector_.PopPacket(); !packet.empty();
-       packet = data_packet_collector_.PopPacket()) {
+  auto packet = DataBufferPool::Acquire(0);
+  while (data_packet_collector_.PopPacket(packet)) {
     out_data_event_.Emit(packet);
   }
+  DataBufferPool::Release(std::move(packet));
 }
 
 std::size_t SizedPacketGate::Overhead() const { return kSizedPacketOverhead; }
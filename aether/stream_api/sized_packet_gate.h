@@ -32,7 +32,8 @@ class SizedPacketGate {
   void DataReceived(DataBuffer const& buffer);
 
   StreamDataPacketCollector data_packet_collector_;
-  Event<void(DataBuffer const& data)> out_data_event_;
+  Event<void(DataBuffer const& data)> out_data_event_{
+      EventSyncPolicy::kSingleThread};
 };
 }  // namespace ae
 #endif  // AETHER_STREAM_API_SIZED_PACKET_GATE_H_
@@ -42,7 +42,7 @@ class StreamApiImpl : public ApiClass {
   StreamEvent::Subscriber stream_event();
 
  private:
-  StreamEvent stream_event_;
+  StreamEvent stream_event_{EventSyncPolicy::kSingleThread};
 };
 
 class StreamIdGenerator {
@@ -67,7 +67,8 @@ class StreamApiGate {
   StreamId stream_id_;
   StreamApiImpl* stream_api_;
   Subscription read_subscription_;
-  Event<void(DataBuffer const& data)> out_data_event_;
+  Event<void(DataBuffer const& data)> out_data_event_{
+      EventSyncPolicy::kSingleThread};
 };
 
 }  // namespace ae
@@ -36,12 +36,12 @@ class GenericTask : public ITask {
   F f_;
 };
 
-template <typename F, typename TP>
+template <typename F, typename TP, typename Base = IDelayedTask<TP>>
   requires(std::invocable<F>)
-class GenericDelayedTask : public IDelayedTask<TP> {
+class GenericDelayedTask : public Base {
  public:
   explicit constexpr GenericDelayedTask(F&& f, TP tp)
-      : IDelayedTask<TP>{tp}, f_{std::move(f)} {}
+      : Base{tp}, f_{std::move(f)} {}
 
   void Invoke() && noexcept override { std::invoke(std::move(f_)); }
 
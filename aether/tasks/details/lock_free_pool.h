@@ -0,0 +1,132 @@
+/*
+ * Copyright 2026 Aethernet Inc.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef AETHER_TASKS_DETAILS_LOCK_FREE_POOL_H_
+#define AETHER_TASKS_DETAILS_LOCK_FREE_POOL_H_
+
+#include <new>
+#include <array>
+#include <atomic>
+#include <limits>
+#include <cstddef>
+#include <cstdint>
+#include <utility>
+#include <type_traits>
+
+namespace ae {
+/**
+ * \brief Fixed size pool with lock-free create and destroy.
+ * Free elements are linked into a stack of indices, the stack head is tagged
+ * with a counter to protect from ABA.
+ * Same interface as etl::generic_pool used by task manager.
+ */
+template <std::size_t ElementSize, std::size_t ElementAlign,
+          std::size_t Capacity>
+class LockFreePool {
+  // pack index and tag into the smallest lock-free word
+  using Packed = std::conditional_t<(Capacity < 0xFFFF), std::uint32_t,
+                                    std::uint64_t>;
+  using Index = std::conditional_t<(Capacity < 0xFFFF), std::uint16_t,
+                                   std::uint32_t>;
+  static_assert(Capacity < std::numeric_limits<Index>::max());
+
+  static constexpr auto kIndexBits = sizeof(Index) * 8;
+  static constexpr auto kEnd = static_cast<Index>(Capacity);
+
+  struct alignas(ElementAlign) Element {
+    unsigned char data[ElementSize];
+  };
+
+ public:
+  LockFreePool() {
+    for (std::size_t i = 0; i < Capacity; ++i) {
+      next_[i].store(static_cast<Index>(i + 1), std::memory_order::relaxed);
+    }
+  }
+
+  LockFreePool(LockFreePool const&) = delete;
+  LockFreePool& operator=(LockFreePool const&) = delete;
+
+  template <typename T, typename... TArgs>
+  T* create(TArgs&&... args) {
+    static_assert(sizeof(T) <= ElementSize, "Element size is too small");
+    static_assert(alignof(T) <= ElementAlign, "Element alignment is too small");
+    auto index = Acquire();
+    if (index == kEnd) {
+      return nullptr;
+    }
+    return ::new (&elements_[index]) T(std::forward<TArgs>(args)...);
+  }
+
+  template <typename T>
+  void destroy(T const* p) {
+    p->~T();
+    auto const* element = reinterpret_cast<Element const*>(p);
+    Release(static_cast<Index>(element - elements_.data()));
+  }
+
+  /**
+   * \brief Check if all the elements are allocated.
+   * The free count is not tracked to keep create and destroy at one atomic
+   * operation.
+   */
+  bool full() const {
+    return IndexOf(head_.load(std::memory_order::relaxed)) == kEnd;
+  }
+
+  static constexpr std::size_t max_size() { return Capacity; }
+
+ private:
+  static constexpr Packed Pack(Index index, Packed tag) {
+    return static_cast<Packed>((tag << kIndexBits) | index);
+  }
+  static constexpr Index IndexOf(Packed packed) {
+    return static_cast<Index>(packed);
+  }
+  static constexpr Packed TagOf(Packed packed) { return packed >> kIndexBits; }
+
+  Index Acquire() {
+    auto head = head_.load(std::memory_order::acquire);
+    for (;;) {
+      auto index = IndexOf(head);
+      if (index == kEnd) {
+        return kEnd;
+      }
+      auto next = next_[index].load(std::memory_order::relaxed);
+      if (head_.compare_exchange_weak(head, Pack(next, TagOf(head) + 1),
+                                      std::memory_order::acq_rel,
+                                      std::memory_order::acquire)) {
+        return index;
+      }
+    }
+  }
+
+  void Release(Index index) {
+    auto head = head_.load(std::memory_order::relaxed);
+    do {
+      next_[index].store(IndexOf(head), std::memory_order::relaxed);
+    } while (!head_.compare_exchange_weak(head, Pack(index, TagOf(head) + 1),
+                                          std::memory_order::release,
+                                          std::memory_order::relaxed));
+  }
+
+  std::array<Element, Capacity> elements_;
+  std::array<std::atomic<Index>, Capacity> next_;
+  std::atomic<Packed> head_{Pack(0, 0)};
+};
+}  // namespace ae
+
+#endif  // AETHER_TASKS_DETAILS_LOCK_FREE_POOL_H_
@@ -23,31 +23,114 @@
 #include <condition_variable>
 #include <cstdio>  // // IWYU pragma: keep
 #include <mutex>
+#include <utility>
 
+#include "aether-miscpp/meta/time_traits.h"
+#include "aether/tasks/details/mpsc_ring.h"
 #include "aether/tasks/details/task_manager.h"
+#include "aether/tasks/details/lock_free_pool.h"
 
 namespace ae {
+/**
+ * \brief Wake up signal for threads waiting for submitted tasks.
+ * One signal may be shared by a number of schedulers to wait for any of them.
+ * Producers lock the mutex only if someone is sleeping.
+ */
+class SchedulerSignal {
+ public:
+  SchedulerSignal() = default;
+
+  SchedulerSignal(SchedulerSignal const&) = delete;
+  SchedulerSignal& operator=(SchedulerSignal const&) = delete;
+
+  /**
+   * \brief Wake up one waiting thread.
+   * Must be called after the submission is published with seq_cst.
+   */
+  void Notify() {
+    if (sleeping_.load(std::memory_order::seq_cst) != 0) {
+      auto lock = std::scoped_lock{lock_};
+      cv_.notify_one();
+    }
+  }
+
+  /**
+   * \brief Wake up all waiting threads.
+   */
+  void NotifyAll() {
+    auto lock = std::scoped_lock{lock_};
+    cv_.notify_all();
+  }
+
+  /**
+   * \brief Wait until wake_up_time or while the predicate is false.
+   * The predicate should check submissions with seq_cst, paired with Notify.
+   */
+  template <typename TimePoint, typename Pred>
+  void WaitUntil(TimePoint wake_up_time, Pred&& pred) {
+    auto lock = std::unique_lock{lock_};
+    // seq_cst orders it before the predicate check
+    sleeping_.fetch_add(1, std::memory_order::seq_cst);
+    cv_.wait_until(lock, wake_up_time, std::forward<Pred>(pred));
+    sleeping_.fetch_sub(1, std::memory_order::relaxed);
+  }
+
+ private:
+  std::mutex lock_;
+  std::condition_variable cv_;
+  std::atomic_size_t sleeping_{};
+};
+
+/**
+ * \brief Task scheduler driven by manual Update calls.
+ * Tasks may be added from any thread. They are created in a lock-free pool
+ * and passed to the Update thread through lock-free submission ring, so
+ * producers never block each other or the Update thread. The wait mutex is
+ * locked by producers only while Update thread sleeps in WaitUntil.
+ * Update and WaitUntil must not be called concurrently, \see
+ * ShardedTaskExecutor to update schedulers from a number of threads.
+ */
 template <typename TaskManagerConf,
           typename TimePointType = std::chrono::system_clock::time_point>
 class ManualTaskScheduler {
-  using task_manager = TaskManager<TaskManagerConf>;
+  using task_pool = LockFreePool<TaskManagerConf::element_size,
+                                 TaskManagerConf::element_align,
+                                 TaskManagerConf::capacity>;
+  using task_manager = TaskManager<TaskManagerConf, TimePointType, task_pool>;
   using regular_list_t =
       std::decay_t<decltype(std::declval<task_manager>().regular())>::list;
   using delayed_list_t =
       std::decay_t<decltype(std::declval<task_manager>().delayed())>::list;
 
+  struct Submission {
+    ITask* task;
+    bool delayed;
+  };
+
  public:
-  ManualTaskScheduler() = default;
+  ManualTaskScheduler() : signal_{&own_signal_} {}
+
+  /**
+   * \brief Use external signal to wake up on submission.
+   */
+  explicit ManualTaskScheduler(SchedulerSignal& signal) : signal_{&signal} {}
+
+  ManualTaskScheduler(ManualTaskScheduler const&) = delete;
+  ManualTaskScheduler& operator=(ManualTaskScheduler const&) = delete;
 
   template <typename F>
   auto Task(F&& f) {
-    return AddSafe([&]() { return task_manager_.Task(std::forward<F>(f)); });
+    return Submit(task_manager_.MakeTask(std::forward<F>(f)), false);
   }
 
   template <typename F, typename TP>
   auto DelayedTask(F&& f, TP tp) {
-    return AddSafe(
-        [&]() { return task_manager_.DelayedTask(std::forward<F>(f), tp); });
+    if constexpr (IsDuration_v<TP>) {
+      return DelayedTask(std::forward<F>(f), TimePointType::clock::now() + tp);
+    } else {
+      return Submit(task_manager_.MakeDelayedTask(std::forward<F>(f), tp),
+                    true);
+    }
   }
 
   /**
@@ -58,23 +141,19 @@ class ManualTaskScheduler {
    */
   TimePointType Update(
       TimePointType current_time = TimePointType::clock::now()) {
-    auto lock = std::unique_lock{lock_};
-    trigger_.store(false, std::memory_order::release);
     CheckOverflows();
+    TakeSubmissions();
 
     // run regular tasks
     task_manager_.regular().StealTasks(reg_list_);
-    UpdateTasks(lock, reg_list_, task_manager_.regular());
+    UpdateTasks(reg_list_, task_manager_.regular());
 
     // run delaed tasks
     task_manager_.delayed().StealTasks(current_time, delay_list_);
-    UpdateTasks(lock, delay_list_, task_manager_.delayed());
+    UpdateTasks(delay_list_, task_manager_.delayed());
 
     // return amount of time for next update
-    if (task_manager_.delayed().size() != 0) {
-      return task_manager_.delayed().back()->expire_at;
-    }
-    return TimePointType::max();
+    return task_manager_.delayed().next_expire_at();
   }
 
   /**
@@ -84,64 +163,80 @@ class ManualTaskScheduler {
    */
   void WaitUntil(TimePointType wake_up_time) {
     // fast check without mutex locking
-    if (trigger_.load(std::memory_order::acquire)) {
+    if (!submissions_.empty()) {
       return;
     }
-
-    auto lock = std::unique_lock{lock_};
-    cv_.wait_until(lock, wake_up_time, [this]() noexcept {
-      return trigger_.load(std::memory_order::acquire);
-    });
+    signal_->WaitUntil(wake_up_time,
+                       [this]() noexcept { return !submissions_.empty(); });
   }
 
-  std::size_t overflow_counter() const { return overflow_counter_; }
+  /**
+   * \brief Check if there are tasks submitted since the last Update.
+   * May be called from any thread, but it is only a hint while Update runs.
+   */
+  bool has_submissions() const { return !submissions_.empty(); }
+
+  std::size_t overflow_counter() const {
+    return overflow_counter_.load(std::memory_order::relaxed);
+  }
 
  private:
-  template <typename F>
-  IActive* AddSafe(F&& f) {
-    auto lock = std::scoped_lock{lock_};
-    auto* p = std::invoke(std::forward<F>(f));
-    if (p == nullptr) {
-      overflow_counter_++;
+  IActive* Submit(ITask* task, bool delayed) {
+    if (task == nullptr) {
+      overflow_counter_.fetch_add(1, std::memory_order::relaxed);
+      return nullptr;
+    }
+    // the ring has a cell for each task in pool, so it's never full
+    [[maybe_unused]] auto res = submissions_.Push(Submission{task, delayed});
+    assert(res);
+    // wake up only the sleeping update thread
+    signal_->Notify();
+    return task;
+  }
+
+  void TakeSubmissions() {
+    Submission s;
+    while (submissions_.Pop(s)) {
+      auto res = s.delayed
+                     ? task_manager_.AddDelayed(
+                           static_cast<IDelayedTask<TimePointType>*>(s.task))
+                     : task_manager_.Add(s.task);
+      if (!res) {
+        overflow_counter_.fetch_add(1, std::memory_order::relaxed);
+      }
     }
-    trigger_.store(true, std::memory_order::release);
-    cv_.notify_one();
-    return p;
   }
 
   template <typename List, typename StealList>
-  void UpdateTasks(std::unique_lock<std::mutex>& lock, StealList& tasks,
-                   List& list) {
-    lock.unlock();
+  void UpdateTasks(StealList& tasks, List& list) {
     for (auto* t : tasks) {
       if (t->active != 0) {
         // each task invoked only once
         std::move(*t).Invoke();
       }
     }
-    lock.lock();
     list.Free(tasks);
     tasks.clear();
   }
 
   void CheckOverflows() {
 #ifndef NDEBUG
-    if (overflow_counter_ != 0) {
+    auto overflows = overflow_counter_.exchange(0, std::memory_order::relaxed);
+    if (overflows != 0) {
       fprintf(stderr, "!!!!!> ManualTaskScheduler: got overflow: %zu\n",
-              overflow_counter_);
-      overflow_counter_ = 0;
+              overflows);
     }
 #endif
   }
 
   task_manager task_manager_;
+  MpscRing<Submission, TaskManagerConf::capacity> submissions_;
   regular_list_t reg_list_;
   delayed_list_t delay_list_;
 
-  std::mutex lock_;
-  std::atomic_bool trigger_{false};
-  std::condition_variable cv_;
-  std::size_t overflow_counter_{};
+  SchedulerSignal own_signal_;
+  SchedulerSignal* signal_;
+  std::atomic_size_t overflow_counter_{};
 };
 }  // namespace ae
 
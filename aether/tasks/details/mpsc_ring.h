@@ -0,0 +1,113 @@
+/*
+ * Copyright 2026 Aethernet Inc.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef AETHER_TASKS_DETAILS_MPSC_RING_H_
+#define AETHER_TASKS_DETAILS_MPSC_RING_H_
+
+#include <array>
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <type_traits>
+
+namespace ae {
+/**
+ * \brief Bounded lock-free multi producer single consumer ring.
+ * Each cell has a sequence number, producer claims a position by moving the
+ * tail and publishes the value by the cell sequence, so consumer never sees
+ * a half written value.
+ */
+template <typename T, std::size_t Capacity>
+  requires(std::is_trivially_copyable_v<T>)
+class MpscRing {
+  struct Cell {
+    std::atomic<std::size_t> sequence;
+    T value;
+  };
+
+ public:
+  MpscRing() {
+    for (std::size_t i = 0; i < Capacity; ++i) {
+      cells_[i].sequence.store(i, std::memory_order::relaxed);
+    }
+  }
+
+  MpscRing(MpscRing const&) = delete;
+  MpscRing& operator=(MpscRing const&) = delete;
+
+  /**
+   * \brief Push value from any thread.
+   * \return false if ring is full.
+   */
+  bool Push(T const& value) {
+    auto pos = tail_.load(std::memory_order::relaxed);
+    for (;;) {
+      auto& cell = cells_[pos % Capacity];
+      auto seq = cell.sequence.load(std::memory_order::acquire);
+      auto diff = static_cast<std::intptr_t>(seq) -
+                  static_cast<std::intptr_t>(pos);
+      if (diff == 0) {
+        // seq_cst to order with the following loads of producer, \see empty
+        if (tail_.compare_exchange_weak(pos, pos + 1,
+                                        std::memory_order::seq_cst,
+                                        std::memory_order::relaxed)) {
+          cell.value = value;
+          cell.sequence.store(pos + 1, std::memory_order::release);
+          return true;
+        }
+      } else if (diff < 0) {
+        return false;
+      } else {
+        pos = tail_.load(std::memory_order::relaxed);
+      }
+    }
+  }
+
+  /**
+   * \brief Pop value, only from the consumer thread.
+   * \return false if ring is empty.
+   */
+  bool Pop(T& value) {
+    auto head = head_.load(std::memory_order::relaxed);
+    auto& cell = cells_[head % Capacity];
+    if (cell.sequence.load(std::memory_order::acquire) != (head + 1)) {
+      return false;
+    }
+    value = cell.value;
+    cell.sequence.store(head + Capacity, std::memory_order::release);
+    head_.store(head + 1, std::memory_order::relaxed);
+    return true;
+  }
+
+  /**
+   * \brief Check if there is no values, even not yet published.
+   * Exact from the consumer thread, from the other threads it's a hint which
+   * may report already popped values.
+   */
+  bool empty() const {
+    return tail_.load(std::memory_order::seq_cst) ==
+           head_.load(std::memory_order::relaxed);
+  }
+
+ private:
+  // producers and consumer positions are split by the cells
+  std::atomic<std::size_t> tail_{};
+  std::array<Cell, Capacity> cells_;
+  std::atomic<std::size_t> head_{};
+};
+}  // namespace ae
+
+#endif  // AETHER_TASKS_DETAILS_MPSC_RING_H_
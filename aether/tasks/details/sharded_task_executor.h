@@ -0,0 +1,160 @@
+/*
+ * Copyright 2026 Aethernet Inc.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef AETHER_TASKS_DETAILS_SHARDED_TASK_EXECUTOR_H_
+#define AETHER_TASKS_DETAILS_SHARDED_TASK_EXECUTOR_H_
+
+#include <atomic>
+#include <memory>
+#include <thread>
+#include <vector>
+#include <chrono>
+#include <cassert>
+#include <cstddef>
+#include <algorithm>
+
+#include "aether/tasks/details/manual_task_scheduler.h"
+
+namespace ae {
+/**
+ * \brief Run a number of task scheduler shards on a pool of worker threads.
+ * Each worker updates its own range of shards and steals runnable shards from
+ * the others while idle.
+ * Shard is stolen as a whole, so tasks of one shard are never invoked
+ * concurrently and objects bound to a shard need no extra locking.
+ */
+template <typename Scheduler,
+          typename TimePointType = std::chrono::system_clock::time_point>
+class ShardedTaskExecutor {
+  struct Shard {
+    explicit Shard(SchedulerSignal& signal) : scheduler{signal} {}
+
+    Scheduler scheduler;
+    // set while some worker updates the shard
+    std::atomic_flag busy;
+    // the next delayed task time, accessed only under busy
+    TimePointType next_update{};
+  };
+
+ public:
+  /**
+   * \param shard_count - count of scheduler shards.
+   * \param worker_count - count of worker threads, 0 for hardware
+   * concurrency.
+   */
+  ShardedTaskExecutor(std::size_t shard_count, std::size_t worker_count = 0)
+      : worker_count_{WorkerCount(shard_count, worker_count)} {
+    assert(shard_count > 0);
+    shards_.reserve(shard_count);
+    for (std::size_t i = 0; i < shard_count; ++i) {
+      shards_.emplace_back(std::make_unique<Shard>(signal_));
+    }
+    workers_.reserve(worker_count_);
+    for (std::size_t i = 0; i < worker_count_; ++i) {
+      workers_.emplace_back([this, i]() { Work(i); });
+    }
+  }
+
+  ~ShardedTaskExecutor() { Stop(); }
+
+  ShardedTaskExecutor(ShardedTaskExecutor const&) = delete;
+  ShardedTaskExecutor& operator=(ShardedTaskExecutor const&) = delete;
+
+  /**
+   * \brief Get the shard scheduler by key, e.g. a hash of client id.
+   */
+  Scheduler& shard(std::size_t key) {
+    return shards_[key % shards_.size()]->scheduler;
+  }
+
+  std::size_t shard_count() const { return shards_.size(); }
+  std::size_t worker_count() const { return worker_count_; }
+
+  /**
+   * \brief Stop and join all workers, tasks left in shards are not invoked.
+   */
+  void Stop() {
+    if (stop_.exchange(true, std::memory_order::acq_rel)) {
+      return;
+    }
+    signal_.NotifyAll();
+    for (auto& w : workers_) {
+      w.join();
+    }
+  }
+
+ private:
+  static std::size_t WorkerCount(std::size_t shard_count,
+                                 std::size_t worker_count) {
+    if (worker_count == 0) {
+      worker_count = std::max(1U, std::thread::hardware_concurrency());
+    }
+    // more workers than shards have nothing to do
+    return std::min(worker_count, shard_count);
+  }
+
+  void Work(std::size_t worker) {
+    // each worker starts from its own range of shards
+    auto const home = (worker * shards_.size()) / worker_count_;
+
+    while (!stop_.load(std::memory_order::acquire)) {
+      auto current_time = TimePointType::clock::now();
+      auto wake_up_time = TimePointType::max();
+      bool updated = false;
+
+      for (std::size_t i = 0; i < shards_.size(); ++i) {
+        auto& shard = *shards_[(home + i) % shards_.size()];
+        // shard is updated by another worker, it takes care of its time
+        if (shard.busy.test_and_set(std::memory_order::acquire)) {
+          continue;
+        }
+        if (shard.scheduler.has_submissions() ||
+            (shard.next_update <= current_time)) {
+          shard.next_update = shard.scheduler.Update(current_time);
+          updated = true;
+        }
+        wake_up_time = std::min(wake_up_time, shard.next_update);
+        shard.busy.clear(std::memory_order::release);
+      }
+
+      // invoked tasks may produce new ones, check again before sleep
+      if (updated) {
+        continue;
+      }
+      signal_.WaitUntil(wake_up_time, [this]() noexcept {
+        return stop_.load(std::memory_order::relaxed) || HasSubmissions();
+      });
+    }
+  }
+
+  // Busy shards are skipped, their worker checks them again after update.
+  bool HasSubmissions() const {
+    return std::any_of(
+        std::begin(shards_), std::end(shards_), [](auto const& shard) {
+          return !shard->busy.test(std::memory_order::relaxed) &&
+                 shard->scheduler.has_submissions();
+        });
+  }
+
+  std::size_t const worker_count_;
+  SchedulerSignal signal_;
+  std::vector<std::unique_ptr<Shard>> shards_;
+  std::vector<std::thread> workers_;
+  std::atomic_bool stop_{false};
+};
+}  // namespace ae
+
+#endif  // AETHER_TASKS_DETAILS_SHARDED_TASK_EXECUTOR_H_
@@ -39,6 +39,12 @@ class IActive {
     }
   }
 
+  /**
+   * \brief Deactivate the task, it will not be invoked.
+   * Task queues may override it to reclaim the task immediately.
+   */
+  virtual void Cancel() noexcept { active = 0; }
+
   std::uintptr_t active{kMagic};
 };
 /**
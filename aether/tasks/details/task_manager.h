@@ -19,11 +19,13 @@
 
 #include <chrono>
 #include <utility>
+#include <algorithm>
 #include <concepts>
 
 #include "aether-miscpp/meta/time_traits.h"
 #include "aether/tasks/details/task_queues.h"
 #include "aether/tasks/details/generic_task.h"
+#include "aether/tasks/details/timer_wheel_queue.h"
 
 #include <etl/generic_pool.h>
 
@@ -32,30 +34,62 @@ namespace task_manager_internal {
 using DefTpType = std::chrono::system_clock::time_point;
 static constexpr std::size_t kDefaultTaskSize =
     (6 * sizeof(void*)) +
-    std::max(sizeof(ITask), sizeof(IDelayedTask<DefTpType>));
+    std::max({sizeof(ITask), sizeof(IDelayedTask<DefTpType>),
+              sizeof(TimerWheelNode<DefTpType>)});
 static constexpr std::size_t kDefaultTaskAlign =
-    std::max(alignof(ITask), alignof(IDelayedTask<DefTpType>));
+    std::max({alignof(ITask), alignof(IDelayedTask<DefTpType>),
+              alignof(TimerWheelNode<DefTpType>)});
 }  // namespace task_manager_internal
 
+/**
+ * \brief Delayed tasks are kept in vector sorted by expiration time.
+ * Add is O(n), but there is no memory overhead.
+ */
+struct SortedDelayedQueue {
+  template <std::size_t Capacity, typename TP, typename Pool>
+  using queue = DelayedTaskQueue<Capacity, TP, Pool>;
+};
+
+/**
+ * \brief Delayed tasks are kept in hierarchical timer wheel.
+ * Add and cancel are O(1), cancelled tasks are freed immediately.
+ * \see TimerWheelTaskQueue
+ */
+template <typename Tick = std::chrono::milliseconds, std::size_t SlotBits = 6,
+          std::size_t Levels = 4>
+struct TimerWheelDelayedQueue {
+  template <std::size_t Capacity, typename TP, typename Pool>
+  using queue =
+      TimerWheelTaskQueue<Capacity, TP, Pool, Tick, SlotBits, Levels>;
+};
+
 template <std::size_t Capacity,
           std::size_t ElementSize = task_manager_internal::kDefaultTaskSize,
-          std::size_t ElementAlign = task_manager_internal::kDefaultTaskAlign>
+          std::size_t ElementAlign = task_manager_internal::kDefaultTaskAlign,
+          typename DelayedQueue = SortedDelayedQueue>
 struct TaskManagerConf {
   static constexpr std::size_t capacity = Capacity;
   static constexpr std::size_t element_size = ElementSize;
   static constexpr std::size_t element_align = ElementAlign;
+  using delayed_queue = DelayedQueue;
 };
 
 template <typename TaskManagerConf,
-          typename TimePointType = task_manager_internal::DefTpType>
+          typename TimePointType = task_manager_internal::DefTpType,
+          typename TaskPool = etl::generic_pool<TaskManagerConf::element_size,
+                                                TaskManagerConf::element_align,
+                                                TaskManagerConf::capacity>>
 class TaskManager {
   static constexpr std::size_t capacity = TaskManagerConf::capacity;
-  static constexpr std::size_t element_size = TaskManagerConf::element_size;
-  static constexpr std::size_t element_align = TaskManagerConf::element_align;
 
-  using task_pool = etl::generic_pool<element_size, element_align, capacity>;
+  using task_pool = TaskPool;
   using regular_task_list = TaskQueue<capacity, task_pool>;
-  using delayd_task_list = DelayedTaskQueue<capacity, TimePointType, task_pool>;
+  using delayd_task_list =
+      typename TaskManagerConf::delayed_queue::template queue<
+          capacity, TimePointType, task_pool>;
+  template <typename F>
+  using delayed_task =
+      typename delayd_task_list::template task_type<std::decay_t<F>>;
 
  public:
   TaskManager()
@@ -67,8 +101,8 @@ class TaskManager {
   template <typename F>
     requires(std::invocable<F>)
   IActive* Task(F&& f) {
-    return Emplace<GenericTask<std::decay_t<F>>>(regular_task_list_,
-                                                 std::forward<F>(f));
+    ReclaimIfFull();
+    return Emplace(regular_task_list_, MakeTask(std::forward<F>(f)));
   }
 
   /**
@@ -77,28 +111,71 @@ class TaskManager {
   template <typename F, typename Dur>
     requires(std::invocable<F> && IsDuration_v<Dur>)
   IActive* DelayedTask(F&& f, Dur dur) {
-    return Emplace<GenericDelayedTask<std::decay_t<F>, TimePointType>>(
-        delayd_task_list_, std::forward<F>(f),
-        TimePointType::clock::now() + dur);
+    return DelayedTask(std::forward<F>(f), TimePointType::clock::now() + dur);
   }
   template <typename F>
     requires(std::invocable<F>)
   IActive* DelayedTask(F&& f, TimePointType tp) {
-    return Emplace<GenericDelayedTask<std::decay_t<F>, TimePointType>>(
-        delayd_task_list_, std::forward<F>(f), tp);
+    ReclaimIfFull();
+    return Emplace(delayd_task_list_,
+                   MakeDelayedTask(std::forward<F>(f), tp));
+  }
+
+  /**
+   * \brief Create regular task without adding it to the queue.
+   * Thread safe if the task pool is.
+   * \see Add
+   */
+  template <typename F>
+    requires(std::invocable<F>)
+  ITask* MakeTask(F&& f) {
+    if (task_pool_.full()) {
+      return nullptr;
+    }
+    return task_pool_.template create<GenericTask<std::decay_t<F>>>(
+        std::forward<F>(f));
+  }
+
+  /**
+   * \brief Create delayed task without adding it to the queue.
+   * Thread safe if the task pool is.
+   * \see AddDelayed
+   */
+  template <typename F>
+    requires(std::invocable<F>)
+  IDelayedTask<TimePointType>* MakeDelayedTask(F&& f, TimePointType tp) {
+    if (task_pool_.full()) {
+      return nullptr;
+    }
+    return task_pool_.template create<delayed_task<F>>(std::forward<F>(f),
+                                                       tp);
+  }
+
+  /**
+   * \brief Add task made by MakeTask to the regular queue.
+   * The task is destroyed if the queue is full.
+   */
+  bool Add(ITask* task) {
+    return Emplace(regular_task_list_, task) != nullptr;
+  }
+
+  /**
+   * \brief Add task made by MakeDelayedTask to the delayed queue.
+   * The task is destroyed if the queue is full.
+   */
+  bool AddDelayed(IDelayedTask<TimePointType>* task) {
+    return Emplace(delayd_task_list_, task) != nullptr;
   }
 
   regular_task_list& regular() { return regular_task_list_; }
   delayd_task_list& delayed() { return delayd_task_list_; }
 
  private:
-  template <typename T, typename List, typename... Args>
-  IActive* Emplace(List& list, Args&&... args) {
-    if (task_pool_.available() == 0) {
+  template <typename List, typename T>
+  IActive* Emplace(List& list, T* p) {
+    if (p == nullptr) {
       return nullptr;
     }
-    auto* p = task_pool_.template create<T>(std::forward<Args>(args)...);
-    assert(p != nullptr);
     if (!list.Add(p)) {
       task_pool_.destroy(p);
       return nullptr;
@@ -106,6 +183,15 @@ class TaskManager {
     return static_cast<IActive*>(p);
   }
 
+  void ReclaimIfFull() {
+    if constexpr (requires { delayd_task_list_.Reclaim(); }) {
+      // cancelled delayed tasks may still hold the pool
+      if (task_pool_.full()) {
+        delayd_task_list_.Reclaim();
+      }
+    }
+  }
+
   task_pool task_pool_;
   regular_task_list regular_task_list_;
   delayd_task_list delayd_task_list_;
@@ -22,6 +22,7 @@
 #include <algorithm>
 
 #include "aether/tasks/details/task.h"
+#include "aether/tasks/details/generic_task.h"
 
 #include "aether/warning_disable.h"
 DISABLE_WARNING_PUSH()
@@ -107,6 +108,8 @@ class DelayedTaskQueue : TaskQueueBase<IDelayedTask<TP>, Capacity, Pool> {
   template <std::size_t max_size>
   using list_container = base::template list_container<max_size>;
   using list = base::list;
+  template <typename F>
+  using task_type = GenericDelayedTask<F, TP>;
 
   using base::base;
 
@@ -151,6 +154,16 @@ class DelayedTaskQueue : TaskQueueBase<IDelayedTask<TP>, Capacity, Pool> {
     to.insert(to.end(), start, std::end(base::list_));
     base::list_.erase(start, std::end(base::list_));
   }
+
+  /**
+   * \brief The earliest expiration time or TP::max() if queue is empty.
+   */
+  TP next_expire_at() const {
+    if (base::list_.empty()) {
+      return TP::max();
+    }
+    return base::list_.back()->expire_at;
+  }
 };
 }  // namespace ae
 
@@ -67,7 +67,7 @@ class TaskSubscription final : public ITaskSubscription {
 
   constexpr void Reset() noexcept {
     if (ptr_ != nullptr) {
-      ptr_->active = 0;
+      ptr_->Cancel();
     }
     ptr_ = nullptr;
   }
@@ -0,0 +1,402 @@
+/*
+ * Copyright 2026 Aethernet Inc.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef AETHER_TASKS_DETAILS_TIMER_WHEEL_QUEUE_H_
+#define AETHER_TASKS_DETAILS_TIMER_WHEEL_QUEUE_H_
+
+#include <bit>
+#include <array>
+#include <limits>
+#include <atomic>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <algorithm>
+
+#include "aether/tasks/details/task.h"
+#include "aether/tasks/details/generic_task.h"
+
+#include "aether/warning_disable.h"
+DISABLE_WARNING_PUSH()
+IGNORE_IMPLICIT_CONVERSION()
+#include <etl/vector.h>
+DISABLE_WARNING_POP()
+
+namespace ae {
+template <std::size_t Capacity, typename TP, typename Pool, typename Tick,
+          std::size_t SlotBits, std::size_t Levels>
+class TimerWheelTaskQueue;
+
+/**
+ * \brief Delayed task linked into the TimerWheelTaskQueue.
+ */
+template <typename TP>
+class TimerWheelNode : public IDelayedTask<TP> {
+  template <std::size_t Capacity, typename TP_, typename Pool, typename Tick,
+            std::size_t SlotBits, std::size_t Levels>
+  friend class TimerWheelTaskQueue;
+
+  enum class State : std::uint8_t { kPending, kLinked, kStolen, kCancelled };
+
+ public:
+  using IDelayedTask<TP>::IDelayedTask;
+
+  /**
+   * \brief Cancel the task and hand it back to the queue.
+   * May be called from any thread, the queue frees the task on its next
+   * access. A task already stolen for invoke is only deactivated.
+   */
+  void Cancel() noexcept override {
+    this->active = 0;
+    auto state = state_.load(std::memory_order::acquire);
+    do {
+      if ((state != State::kPending) && (state != State::kLinked)) {
+        return;
+      }
+    } while (!state_.compare_exchange_weak(state, State::kCancelled,
+                                           std::memory_order::acq_rel));
+    if (state == State::kPending) {
+      // not in the queue yet, it's freed on add
+      return;
+    }
+    auto* head = cancelled_->load(std::memory_order::relaxed);
+    do {
+      next_cancelled_ = head;
+    } while (!cancelled_->compare_exchange_weak(head, this,
+                                                std::memory_order::release,
+                                                std::memory_order::relaxed));
+  }
+
+ private:
+  TimerWheelNode* prev_{};
+  TimerWheelNode* next_{};
+  TimerWheelNode* next_cancelled_{};
+  std::atomic<TimerWheelNode*>* cancelled_{};
+  std::uint16_t slot_{};
+  std::atomic<State> state_{State::kPending};
+};
+
+/**
+ * \brief Hierarchical timer wheel for delayed tasks.
+ * Each of Levels levels has 2^SlotBits slots, level L slot covers
+ * 2^(SlotBits * L) ticks. A task is linked into the lowest level its
+ * expiration fits in and moves down while the wheel turns. Tasks out of the
+ * top level range wait in the overflow list until the next full turn.
+ * Add and cancel are O(1), the tasks are expired with Tick precision but
+ * never before their expire_at.
+ */
+template <std::size_t Capacity, typename TP, typename Pool,
+          typename Tick = std::chrono::milliseconds, std::size_t SlotBits = 6,
+          std::size_t Levels = 4>
+class TimerWheelTaskQueue {
+  static_assert((SlotBits > 0) && (SlotBits <= 6),
+                "Slots occupancy must fit into 64 bit mask");
+  static_assert((Levels > 0) && ((SlotBits * Levels) < 64),
+                "Wheel range must fit into 64 bit tick counter");
+
+  using Node = TimerWheelNode<TP>;
+  using State = typename Node::State;
+
+  static constexpr std::size_t kSlots = std::size_t{1} << SlotBits;
+  static constexpr std::uint64_t kSlotMask = kSlots - 1;
+  static constexpr std::uint16_t kOverflowSlot = Levels * kSlots;
+
+  struct Slot {
+    Node* head;
+    Node* tail;
+  };
+
+ public:
+  static constexpr std::size_t kCapacity = Capacity;
+  template <std::size_t max_size>
+  using list_container = etl::vector<IDelayedTask<TP>*, max_size>;
+  using list = list_container<kCapacity>;
+  template <typename F>
+  using task_type = GenericDelayedTask<F, TP, Node>;
+
+  explicit TimerWheelTaskQueue(Pool& pool)
+      : pool_{&pool}, epoch_{TP::clock::now()} {}
+
+  ~TimerWheelTaskQueue() {
+    Reclaim();
+    for (auto& slot : slots_) {
+      while (slot.head != nullptr) {
+        auto* node = slot.head;
+        Unlink(*node);
+        pool_->template destroy<IDelayedTask<TP>>(node);
+      }
+    }
+  }
+
+  TimerWheelTaskQueue(TimerWheelTaskQueue const&) = delete;
+  TimerWheelTaskQueue& operator=(TimerWheelTaskQueue const&) = delete;
+
+  /**
+   * \brief Add task, it must be created as task_type.
+   */
+  bool Add(IDelayedTask<TP>* p) {
+    Reclaim();
+    if (size_ == kCapacity) {
+      return false;
+    }
+    auto* node = static_cast<Node*>(p);
+    node->cancelled_ = &cancelled_;
+    auto expected = State::kPending;
+    if (!node->state_.compare_exchange_strong(expected, State::kLinked,
+                                              std::memory_order::acq_rel)) {
+      // cancelled before it was added
+      pool_->template destroy<IDelayedTask<TP>>(node);
+      return true;
+    }
+    Insert(*node);
+    ++size_;
+    return true;
+  }
+
+  /**
+   * \brief Steal elements expired before expiration_time.
+   * Stealled elements should be freed with Free function \see Free
+   */
+  template <std::size_t max_count>
+  void StealTasks(TP expiration_time, list_container<max_count>& to) {
+    Reclaim();
+    auto const target = TickOf(expiration_time);
+    for (;;) {
+      StealSlot(expiration_time, to);
+      if (to.full() || (current_ >= target)) {
+        break;
+      }
+      Advance(target);
+    }
+  }
+
+  /**
+   * \brief Free elements.
+   */
+  template <std::size_t max_size>
+  void Free(list_container<max_size>& elements) {
+    for (auto* e : elements) {
+      pool_->template destroy<IDelayedTask<TP>>(e);
+    }
+  }
+
+  /**
+   * \brief Free cancelled tasks.
+   */
+  void Reclaim() {
+    auto* node = cancelled_.exchange(nullptr, std::memory_order::acquire);
+    while (node != nullptr) {
+      auto* next = node->next_cancelled_;
+      Unlink(*node);
+      --size_;
+      pool_->template destroy<IDelayedTask<TP>>(node);
+      node = next;
+    }
+  }
+
+  /**
+   * \brief The earliest time a task may expire.
+   * It is exact for tasks in the lowest level and the time of the next wheel
+   * turn for others.
+   */
+  TP next_expire_at() const {
+    if (size_ == 0) {
+      return TP::max();
+    }
+    if (slots_[current_ & kSlotMask].head != nullptr) {
+      return MinExpireAt(slots_[current_ & kSlotMask]);
+    }
+    auto tick = NextEventTick();
+    if (tick == std::numeric_limits<std::uint64_t>::max()) {
+      return TP::max();
+    }
+    if ((tick >> SlotBits) == (current_ >> SlotBits)) {
+      return MinExpireAt(slots_[tick & kSlotMask]);
+    }
+    return epoch_ + std::chrono::duration_cast<typename TP::duration>(
+                        Tick{static_cast<typename Tick::rep>(tick)});
+  }
+
+  std::size_t size() const { return size_; }
+
+ private:
+  std::uint64_t TickOf(TP tp) const {
+    if (tp <= epoch_) {
+      return 0;
+    }
+    return static_cast<std::uint64_t>(
+        std::chrono::duration_cast<Tick>(tp - epoch_).count());
+  }
+
+  void Insert(Node& node) {
+    auto const tick = std::max(TickOf(node.expire_at), current_);
+    std::size_t level = 0;
+    for (; level < Levels; ++level) {
+      auto const shift = SlotBits * (level + 1);
+      if ((tick >> shift) == (current_ >> shift)) {
+        break;
+      }
+    }
+    if (level == Levels) {
+      Link(kOverflowSlot, node);
+      return;
+    }
+    auto const index = (tick >> (SlotBits * level)) & kSlotMask;
+    Link(static_cast<std::uint16_t>((level * kSlots) + index), node);
+  }
+
+  void Link(std::uint16_t slot_index, Node& node) {
+    auto& slot = slots_[slot_index];
+    node.slot_ = slot_index;
+    node.prev_ = slot.tail;
+    node.next_ = nullptr;
+    if (slot.tail != nullptr) {
+      slot.tail->next_ = &node;
+    } else {
+      slot.head = &node;
+    }
+    slot.tail = &node;
+    if (slot_index != kOverflowSlot) {
+      occupied_[slot_index / kSlots] |= std::uint64_t{1}
+                                        << (slot_index % kSlots);
+    }
+  }
+
+  void Unlink(Node& node) {
+    auto& slot = slots_[node.slot_];
+    if (node.prev_ != nullptr) {
+      node.prev_->next_ = node.next_;
+    } else {
+      slot.head = node.next_;
+    }
+    if (node.next_ != nullptr) {
+      node.next_->prev_ = node.prev_;
+    } else {
+      slot.tail = node.prev_;
+    }
+    node.prev_ = nullptr;
+    node.next_ = nullptr;
+    if ((slot.head == nullptr) && (node.slot_ != kOverflowSlot)) {
+      occupied_[node.slot_ / kSlots] &=
+          ~(std::uint64_t{1} << (node.slot_ % kSlots));
+    }
+  }
+
+  template <std::size_t max_count>
+  void StealSlot(TP expiration_time, list_container<max_count>& to) {
+    auto* node = slots_[current_ & kSlotMask].head;
+    while ((node != nullptr) && !to.full()) {
+      auto* next = node->next_;
+      if (node->expire_at <= expiration_time) {
+        auto expected = State::kLinked;
+        // cancelled ones are left for Reclaim
+        if (node->state_.compare_exchange_strong(expected, State::kStolen,
+                                                 std::memory_order::acq_rel)) {
+          Unlink(*node);
+          --size_;
+          to.push_back(node);
+        }
+      }
+      node = next;
+    }
+  }
+
+  /**
+   * \brief Turn the wheel to the next occupied slot but not after target.
+   */
+  void Advance(std::uint64_t target) {
+    auto const next = (size_ == 0) ? target : NextEventTick();
+    current_ = std::min(next, target);
+    Cascade();
+  }
+
+  /**
+   * \brief Move tasks from the higher level slots starting at current tick.
+   */
+  void Cascade() {
+    if ((current_ & ((std::uint64_t{1} << (SlotBits * Levels)) - 1)) == 0) {
+      Relink(kOverflowSlot);
+    }
+    for (auto level = Levels - 1; level > 0; --level) {
+      auto const shift = SlotBits * level;
+      if ((current_ & ((std::uint64_t{1} << shift) - 1)) != 0) {
+        continue;
+      }
+      auto const index = (current_ >> shift) & kSlotMask;
+      Relink(static_cast<std::uint16_t>((level * kSlots) + index));
+    }
+  }
+
+  void Relink(std::uint16_t slot_index) {
+    auto* node = slots_[slot_index].head;
+    if (node == nullptr) {
+      return;
+    }
+    slots_[slot_index] = Slot{};
+    if (slot_index != kOverflowSlot) {
+      occupied_[slot_index / kSlots] &=
+          ~(std::uint64_t{1} << (slot_index % kSlots));
+    }
+    while (node != nullptr) {
+      auto* next = node->next_;
+      Insert(*node);
+      node = next;
+    }
+  }
+
+  /**
+   * \brief The first tick after current with occupied slot.
+   */
+  std::uint64_t NextEventTick() const {
+    for (std::size_t level = 0; level < Levels; ++level) {
+      auto const shift = SlotBits * level;
+      auto const index = (current_ >> shift) & kSlotMask;
+      auto const after =
+          (index == kSlotMask) ? 0 : (~std::uint64_t{0} << (index + 1));
+      auto const mask = occupied_[level] & after;
+      if (mask != 0) {
+        auto const rotation = (current_ >> (shift + SlotBits))
+                              << (shift + SlotBits);
+        return rotation |
+               (static_cast<std::uint64_t>(std::countr_zero(mask)) << shift);
+      }
+    }
+    if (slots_[kOverflowSlot].head != nullptr) {
+      auto const shift = SlotBits * Levels;
+      return ((current_ >> shift) + 1) << shift;
+    }
+    return std::numeric_limits<std::uint64_t>::max();
+  }
+
+  static TP MinExpireAt(Slot const& slot) {
+    auto res = TP::max();
+    for (auto const* node = slot.head; node != nullptr; node = node->next_) {
+      res = std::min(res, node->expire_at);
+    }
+    return res;
+  }
+
+  Pool* pool_;
+  TP epoch_;
+  std::uint64_t current_{};
+  std::size_t size_{};
+  std::array<Slot, (Levels * kSlots) + 1> slots_{};
+  std::array<std::uint64_t, Levels> occupied_{};
+  std::atomic<Node*> cancelled_{nullptr};
+};
+}  // namespace ae
+
+#endif  // AETHER_TASKS_DETAILS_TIMER_WHEEL_QUEUE_H_
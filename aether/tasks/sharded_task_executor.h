@@ -0,0 +1,24 @@
+/*
+ * Copyright 2026 Aethernet Inc.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef AETHER_TASKS_SHARDED_TASK_EXECUTOR_H_
+#define AETHER_TASKS_SHARDED_TASK_EXECUTOR_H_
+// IWYU pragma: begin_exports
+#include "aether/tasks/manual_task_scheduler.h"
+#include "aether/tasks/details/sharded_task_executor.h"
+// IWYU pragma: end_exports
+
+#endif  // AETHER_TASKS_SHARDED_TASK_EXECUTOR_H_
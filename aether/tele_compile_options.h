@@ -42,6 +42,10 @@ constexpr inline auto _compile_options_list = std::array{
     _OPTION(AE_API_PROTOCOL_MAX_PARSER_PACKER_DEPTH),
     _OPTION(AE_API_PROTOCOL_PENDING_RESPONSE_MAX_SIZE),
     _OPTION(AE_API_PROTOCOL_PENDING_RESPONSE_ALIGN),
+    _OPTION(AE_API_PROTOCOL_PENDING_RESPONSE_TIMEOUT_MS),
+    _OPTION(AE_PTR_DEFERRED_CYCLE_COLLECTION),
+    _OPTION(AE_PTR_CYCLE_COLLECTOR_BUDGET),
+    _OPTION(AE_DOMAIN_STORAGE_MMAP),
     _OPTION(AE_SUPPORT_IPV4),
     _OPTION(AE_SUPPORT_IPV6),
     _OPTION(AE_SUPPORT_UDP),
@@ -92,6 +96,8 @@ constexpr inline auto _compile_options_list = std::array{
     _OPTION(AE_SUPPORT_SPIFS_FS),
     _OPTION(AE_SAFE_STREAM_CAPACITY),
     _OPTION(AE_SAFE_STREAM_RTO_GROW_FACTOR),
+    _OPTION(AE_SAFE_STREAM_CONGESTION_CONTROL),
+    _OPTION(AE_SAFE_STREAM_MAX_SENDING_CHUNKS),
     _OPTION(AE_STATISTICS_CONNECTION_WINDOW_SIZE),
     _OPTION(AE_DEFAULT_CONNECTION_TIMEOUT_MS),
     _OPTION(AE_STATISTICS_RESPONSE_WINDOW_SIZE),
@@ -16,105 +16,97 @@
 
 #include "aether/transport/data_packet_collector.h"
 
-#include <ios>
-#include <algorithm>
 #include <cassert>
 
 #include "aether/mstream_buffers.h"
 #include "aether/mstream.h"
 
 namespace ae {
-
-Packet::Packet(std::size_t expected_size)
-    : mem_buffer{static_cast<std::streamsize>(expected_size)},
-      expected_packet_size{expected_size} {}
-
-Packet::Packet(Packet&& other) noexcept
-    : mem_buffer{std::move(other.mem_buffer)},
-      expected_packet_size{other.expected_packet_size} {}
+// do not keep memory of the big packets after they are consumed
+static constexpr std::size_t kMaxIdleCapacity = 16 * 1024;
 
 void StreamDataPacketCollector::AddData(std::uint8_t const* data,
                                         std::size_t size) {
-  std::size_t offset{};
-
-  // write data to all packets
-  while ((size - offset) > 0) {
-    if (packets_.empty() || IsPacketComplete(packets_.back())) {
-      auto [packet_size, ofst] = GetPacketSize(data + offset, size - offset);
-      // no packet yet
-      if (packet_size == 0) {
-        return;
-      }
-      offset += ofst;
-      packets_.emplace(packet_size);
+  if (read_offset_ == buffer_.size()) {
+    // all the data is consumed, start from the beginning
+    read_offset_ = 0;
+    buffer_.clear();
+    if (buffer_.capacity() > kMaxIdleCapacity) {
+      DataBuffer{}.swap(buffer_);
     }
-
-    offset += WriteToPacket(packets_.back(), data + offset, size - offset);
+  } else if ((read_offset_ != 0) &&
+             ((buffer_.size() + size) > buffer_.capacity())) {
+    // move the rest of data to the beginning instead of growing
+    buffer_.erase(std::begin(buffer_),
+                  std::begin(buffer_) +
+                      static_cast<std::ptrdiff_t>(read_offset_));
+    read_offset_ = 0;
   }
+  buffer_.insert(std::end(buffer_), data, data + size);
 }
 
 void StreamDataPacketCollector::AddData(DataBuffer const& data_buffer) {
   AddData(data_buffer.data(), data_buffer.size());
 }
 
-std::vector<std::uint8_t> StreamDataPacketCollector::PopPacket() {
-  // no completed packet, return empty
-  if (packets_.empty() || !IsPacketComplete(packets_.front())) {
-    return {};
+Span<std::uint8_t const> StreamDataPacketCollector::PeekPacket() {
+  while (ParseHeader()) {
+    // empty packets carry nothing, skip them
+    if (packet_size_ == 0) {
+      DropPacket();
+      continue;
+    }
+    auto available = buffer_.size() - read_offset_ - header_size_;
+    if (available < packet_size_) {
+      break;
+    }
+    return Span<std::uint8_t const>{
+        buffer_.data() + read_offset_ + header_size_, packet_size_};
   }
-  auto& packet = packets_.front();
-  std::vector<std::uint8_t> data_packet(packet.expected_packet_size);
-  std::copy(packet.mem_buffer.Data(),
-            packet.mem_buffer.Data() + packet.mem_buffer.Size(),
-            std::begin(data_packet));
-
-  packets_.pop();
-  return data_packet;
+  return {};
 }
 
-bool StreamDataPacketCollector::IsPacketComplete(Packet const& packet) {
-  return packet.mem_buffer.Size() ==
-         static_cast<std::streamsize>(packet.expected_packet_size);
+void StreamDataPacketCollector::DropPacket() {
+  assert((header_size_ != 0) && "No packet to drop");
+  assert((buffer_.size() - read_offset_) >= (header_size_ + packet_size_));
+  read_offset_ += header_size_ + packet_size_;
+  header_size_ = 0;
+  packet_size_ = 0;
 }
 
-std::pair<std::size_t, std::size_t> StreamDataPacketCollector::GetPacketSize(
-    std::uint8_t const* data, std::size_t size) {
-  auto temp_buffer_size = temp_data_buffer_.size();
-
-  // use no more than packet size may contain
-  auto use_max_size = sizeof(PacketSize::ValueType) < size
-                          ? sizeof(PacketSize::ValueType)
-                          : size;
+bool StreamDataPacketCollector::PopPacket(DataBuffer& packet) {
+  auto packet_data = PeekPacket();
+  if (packet_data.size() == 0) {
+    return false;
+  }
+  packet.assign(std::begin(packet_data), std::end(packet_data));
+  DropPacket();
+  return true;
+}
 
-  temp_data_buffer_.insert(temp_data_buffer_.end(), data, data + use_max_size);
+std::vector<std::uint8_t> StreamDataPacketCollector::PopPacket() {
+  DataBuffer packet;
+  PopPacket(packet);
+  return packet;
+}
 
-  VectorReader<PacketSize> reader(temp_data_buffer_);
+bool StreamDataPacketCollector::ParseHeader() {
+  if (header_size_ != 0) {
+    return true;
+  }
+  auto reader = SpanReader<PacketSize>{Span<std::uint8_t const>{
+      buffer_.data() + read_offset_, buffer_.size() - read_offset_}};
   auto is = imstream{reader};
 
   PacketSize packet_size;
   is >> packet_size;
   if (!data_was_read(is)) {
-    return {0, size};
+    return false;
   }
 
-  temp_data_buffer_.clear();
-
-  assert((temp_buffer_size + size) >= reader.offset_);
-  return {static_cast<std::size_t>(packet_size),
-          reader.offset_ - temp_buffer_size};
-}
-
-std::size_t StreamDataPacketCollector::WriteToPacket(Packet& packet,
-                                                     std::uint8_t const* data,
-                                                     std::size_t size) {
-  auto avail_cap = packet.mem_buffer.AvailableCapacity();
-  auto write_size = avail_cap > static_cast<std::streamsize>(size)
-                        ? static_cast<std::streamsize>(size)
-                        : avail_cap;
-
-  packet.mem_buffer.sputn(reinterpret_cast<char const*>(data), write_size);
-
-  return static_cast<std::size_t>(write_size);
+  header_size_ = reader.offset_;
+  packet_size_ = static_cast<std::size_t>(packet_size);
+  return true;
 }
 
 }  // namespace ae
@@ -20,47 +20,55 @@
 #include <cstddef>
 #include <cstdint>
 #include <vector>
-#include <queue>
-#include <utility>
 
 #include <numeric/tiered_int.h>
 
-#include "aether/memory_buffer.h"
+#include "aether/types/span.h"
 #include "aether/types/data_buffer.h"
 
 namespace ae {
 
 using PacketSize = TieredInt<std::uint64_t, std::uint8_t, 250>;
 
-struct Packet {
-  explicit Packet(std::size_t expected_size);
-  Packet(Packet const&) = delete;
-  Packet(Packet&& other) noexcept;
-
-  MemStreamBuf<> mem_buffer;
-  std::size_t expected_packet_size;
-};
-
+/**
+ * \brief Splits the stream of size prefixed packets into packets.
+ * All the received data is kept in one contiguous buffer, packet headers are
+ * parsed in place and packets are handed out as views into it or copied into
+ * the caller's reusable buffer.
+ */
 class StreamDataPacketCollector {
  public:
-  // fill packets in queue with provided stream data_buffer
+  // append stream data
   void AddData(std::uint8_t const* data, std::size_t size);
   void AddData(DataBuffer const& data_buffer);
+
+  /**
+   * \brief Get the next completed packet without copy.
+   * \return empty span if there is no completed packet. The view is valid
+   * until the next AddData or DropPacket call.
+   */
+  Span<std::uint8_t const> PeekPacket();
+  // remove the packet returned by PeekPacket
+  void DropPacket();
+
+  /**
+   * \brief Pop a packet data into packet, reusing it's memory.
+   * \return false if there is no completed packet.
+   */
+  bool PopPacket(DataBuffer& packet);
   // pops a packet data if any, else return empty
   std::vector<std::uint8_t> PopPacket();
 
  private:
-  static bool IsPacketComplete(Packet const& packet);
-  // return new packet size and data offset to start reading
-  std::pair<std::size_t, std::size_t> GetPacketSize(std::uint8_t const* data,
-                                                    std::size_t size);
-  // return data offset
-  std::size_t WriteToPacket(Packet& packet, std::uint8_t const* data,
-                            std::size_t size);
+  // parse header of the front packet if not yet
+  bool ParseHeader();
 
-  std::queue<Packet> packets_;
-  // used if packet is not complete to get packet size
-  std::vector<std::uint8_t> temp_data_buffer_;
+  // stream data from read_offset_ to the end
+  DataBuffer buffer_;
+  std::size_t read_offset_{};
+  // parsed header of the front packet
+  std::size_t header_size_{};
+  std::size_t packet_size_{};
 };
 }  // namespace ae
 
@@ -20,6 +20,7 @@
 
 #  include "aether/mstream.h"
 #  include "aether/mstream_buffers.h"
+#  include "aether/types/data_buffer_pool.h"
 #  include "aether/write_action/failed_write_action.h"
 
 #  include "aether/transport/transport_tele.h"
@@ -308,11 +309,12 @@ void ModemTransport::DataReceived(ConnectionIndex connection,
 
 void ModemTransport::DataReceivedTcp(DataBuffer const& data_in) {
   data_packet_collector_.AddData(data_in.data(), data_in.size());
-  for (auto data = data_packet_collector_.PopPacket(); !data.empty();
-       data = data_packet_collector_.PopPacket()) {
+  auto data = DataBufferPool::Acquire(0);
+  while (data_packet_collector_.PopPacket(data)) {
     AE_TELE_DEBUG(kModemTransportReceive, "Receive data size {}", data.size());
     out_data_event_.Emit(data);
   }
+  DataBufferPool::Release(std::move(data));
 }
 
 void ModemTransport::DataReceivedUdp(DataBuffer const& data_in) {
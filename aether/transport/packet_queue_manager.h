@@ -17,17 +17,27 @@
 #ifndef AETHER_TRANSPORT_SOCKET_PACKET_QUEUE_MANAGER_H_
 #define AETHER_TRANSPORT_SOCKET_PACKET_QUEUE_MANAGER_H_
 
+#include <array>
 #include <mutex>
 #include <type_traits>
 
 #include <etl/circular_buffer.h>
 
 #include "aether/ae_context.h"
+#include "aether/types/span.h"
 #include "aether/transport/packet_send_action.h"
 
 #include "aether/transport/transport_tele.h"
 
 namespace ae {
+/**
+ * \brief Send action able to send a number of queued actions by one call.
+ * SendBatch sends the actions in order and updates their states the same way
+ * as Send does.
+ */
+template <typename T>
+concept BatchSendAction = requires(Span<T*> batch) { T::SendBatch(batch); };
+
 template <typename T, std::size_t MaxSize = 10>
   requires(std::is_base_of_v<PacketSendAction, T>)
 class PacketQueueManager {
@@ -68,6 +78,15 @@ class PacketQueueManager {
     }
     index_ = (index_ <= i) ? 0 : index_ - i;
 
+    if constexpr (BatchSendAction<T>) {
+      SendBatch();
+    } else {
+      SendEach();
+    }
+  }
+
+ private:
+  void SendEach() {
     // send queued packets
     for (; index_ < queue_.size(); index_++) {
       auto& current = queue_[index_];
@@ -92,7 +111,34 @@ class PacketQueueManager {
     }
   }
 
- private:
+  void SendBatch() {
+    // all not done packets are sent together
+    std::array<T*, kMaxSize> batch;
+    std::size_t count = 0;
+    for (auto i = index_; i < queue_.size(); i++) {
+      if (!queue_[i].is_done()) {
+        batch[count++] = &queue_[i];
+      }
+    }
+    if (count == 0) {
+      index_ = queue_.size();
+      return;
+    }
+    T::SendBatch(Span{batch.data(), count});
+
+    // the same states as for SendEach
+    for (; index_ < queue_.size(); index_++) {
+      auto& current = queue_[index_];
+      if (current.is_done()) {
+        continue;
+      }
+      if (current.re_enqueue()) {
+        Enqueue();
+      }
+      break;
+    }
+  }
+
   void Enqueue() {
     if (!enqueue_sub_) {
       enqueue_sub_ = ae_context_.scheduler().Task([&]() {
@@ -19,6 +19,7 @@
 
 #include <cstdint>
 #include <cstddef>
+#include <optional>
 
 #include "aether/types/span.h"
 #include "aether/types/address.h"
@@ -45,6 +46,11 @@ class ISocket {
   using RecvDataCb = SmallFunction<void(Span<std::uint8_t> data_span)>;
   using ErrorCb = SmallFunction<void()>;
 
+  // max count of buffers sent by one call, posix guarantees at least 16 iovecs
+  static constexpr std::size_t kMaxSendBuffers = 16;
+  // max count of datagrams sent by one call
+  static constexpr std::size_t kMaxSendDatagrams = 16;
+
   virtual ~ISocket() = default;
 
   /**
@@ -70,6 +76,58 @@ class ISocket {
    * return 0.
    */
   virtual std::optional<std::size_t> Send(Span<std::uint8_t> data) = 0;
+  /**
+   * \brief Non blocking send of a number of buffers as one continuous data.
+   * Only first kMaxSendBuffers are sent.
+   * \return sent count over all the buffers, same as the Send above.
+   */
+  virtual std::optional<std::size_t> Send(
+      Span<Span<std::uint8_t const> const> buffers) {
+    // send one by one until the socket is busy
+    std::size_t sent = 0;
+    for (auto const& b : buffers) {
+      auto res = Send(Span{const_cast<std::uint8_t*>(b.data()),  // NOLINT
+                           b.size()});
+      if (!res) {
+        return (sent == 0) ? res : sent;
+      }
+      sent += *res;
+      if (*res != b.size()) {
+        break;
+      }
+    }
+    return sent;
+  }
+  /**
+   * \brief Non blocking send of a number of buffers each as a separate
+   * datagram. Only first kMaxSendDatagrams are sent.
+   * Datagram sent not completely is an error.
+   * \return count of sent datagrams, in case of error on the first datagram
+   * returns nullopt, if socket is busy return 0.
+   */
+  virtual std::optional<std::size_t> SendDatagrams(
+      Span<Span<std::uint8_t const> const> datagrams) {
+    std::size_t sent = 0;
+    for (auto const& d : datagrams) {
+      if (sent == kMaxSendDatagrams) {
+        break;
+      }
+      auto res = Send(Span{const_cast<std::uint8_t*>(d.data()),  // NOLINT
+                           d.size()});
+      if (!res) {
+        return (sent == 0) ? res : sent;
+      }
+      if (*res == 0) {
+        break;
+      }
+      if (*res != d.size()) {
+        // the error is reported for the first datagram
+        return (sent == 0) ? std::nullopt : std::optional{sent};
+      }
+      ++sent;
+    }
+    return sent;
+  }
   /**
    * \brief Broke the connection.
    */
@@ -43,6 +43,7 @@ class LwipCBUdpSocket : public ISocket {
   ISocket& ReadyToWrite(ReadyToWriteCb ready_to_write_cb) override;
   ISocket& RecvData(RecvDataCb recv_data_cb) override;
   ISocket& Error(ErrorCb error_cb) override;
+  using ISocket::Send;
   std::optional<std::size_t> Send(Span<std::uint8_t> data) override;
 
   void Disconnect() override;
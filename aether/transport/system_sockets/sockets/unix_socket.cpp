@@ -24,9 +24,12 @@
 #  include <netinet/tcp.h>
 #  include <sys/ioctl.h>
 #  include <sys/socket.h>
+#  include <sys/uio.h>
 #  include <unistd.h>
 
+#  include <array>
 #  include <cerrno>
+#  include <algorithm>
 
 #  include "aether/tele.h"
 
@@ -64,17 +67,27 @@ std::optional<std::size_t> UnixSocket::Send(Span<std::uint8_t> data) {
   // add nosignal to prevent throw SIGPIPE and handle it manually
   int flags = MSG_NOSIGNAL;
   auto res = send(*socket_->fd(), data.data(), size_to_send, flags);
-  if (res == -1) {
-    if ((errno == EAGAIN) || (errno == EWOULDBLOCK)) {
-      // poll read and write
-      socket_->Events(EventType::kRead | EventType::kError | EventType::kWrite);
-    } else {
-      AE_TELED_ERROR("Send to socket error {} {}", errno, strerror(errno));
-      return std::nullopt;
-    }
-    return 0;
+  return SendResult(res);
+}
+
+std::optional<std::size_t> UnixSocket::Send(
+    Span<Span<std::uint8_t const> const> buffers) {
+  if (!socket_) {
+    return std::nullopt;
   }
-  return static_cast<std::size_t>(res);
+  std::array<iovec, kMaxSendBuffers> iov;
+  auto count = std::min(buffers.size(), iov.size());
+  for (std::size_t i = 0; i < count; ++i) {
+    auto const& b = buffers.data()[i];
+    iov[i].iov_base = const_cast<std::uint8_t*>(b.data());  // NOLINT
+    iov[i].iov_len = b.size();
+  }
+  msghdr msg{};
+  msg.msg_iov = iov.data();
+  msg.msg_iovlen = static_cast<decltype(msg.msg_iovlen)>(count);
+  // gather all the buffers into one send, also with nosignal
+  auto res = sendmsg(*socket_->fd(), &msg, MSG_NOSIGNAL);
+  return SendResult(res);
 }
 
 void UnixSocket::Disconnect() {
@@ -171,6 +184,20 @@ std::optional<std::size_t> UnixSocket::Receive(DescriptorType fd,
   return static_cast<std::size_t>(res);
 }
 
+std::optional<std::size_t> UnixSocket::SendResult(ssize_t res) {
+  if (res == -1) {
+    if ((errno == EAGAIN) || (errno == EWOULDBLOCK)) {
+      // poll read and write
+      socket_->Events(EventType::kRead | EventType::kError | EventType::kWrite);
+    } else {
+      AE_TELED_ERROR("Send to socket error {} {}", errno, strerror(errno));
+      return std::nullopt;
+    }
+    return 0;
+  }
+  return static_cast<std::size_t>(res);
+}
+
 std::optional<int> UnixSocket::GetSocketError(DescriptorType fd) {
   int err{};
   socklen_t len = sizeof(len);
@@ -22,6 +22,8 @@
 
 #  define UNIX_SOCKET_ENABLED 1
 
+#  include <sys/types.h>
+
 #  include <optional>
 
 #  include "aether/poller/poller.h"
@@ -42,6 +44,8 @@ class UnixSocket : public ISocket {
   ISocket& RecvData(RecvDataCb recv_data_cb) override;
   ISocket& Error(ErrorCb error_cb) override;
   std::optional<std::size_t> Send(Span<std::uint8_t> data) override;
+  std::optional<std::size_t> Send(
+      Span<Span<std::uint8_t const> const> buffers) override;
 
   void Disconnect() override;
 
@@ -49,7 +53,7 @@ class UnixSocket : public ISocket {
   void Poll();
   virtual void OnPollerEvent(DescriptorType fd, EventType event);
 
-  void OnReadEvent(DescriptorType fd);
+  virtual void OnReadEvent(DescriptorType fd);
   void OnWriteEvent();
   void OnErrorEvent();
 
@@ -58,6 +62,8 @@ class UnixSocket : public ISocket {
 
   std::optional<int> GetSocketError(DescriptorType fd);
 
+  std::optional<std::size_t> SendResult(ssize_t res);
+
   std::optional<UnixPolledFd> socket_;
 
   ReadyToWriteCb ready_to_write_cb_;
@@ -25,16 +25,28 @@
 #  include <sys/socket.h>
 #  include <unistd.h>
 
+#  include <array>
+#  include <cerrno>
+#  include <algorithm>
+
 #  include "aether-miscpp/misc/defer.h"
 #  include "aether/transport/system_sockets/sockets/get_sock_addr.h"
 
 #  include "aether/tele.h"
 
 namespace ae {
+// 1200 is our default MTU for UDP
+static constexpr std::size_t kUdpMtu = 1200;
+#  if UNIX_UDP_MMSG_ENABLED
+// max count of datagrams received by one call
+static constexpr std::size_t kRecvBatchSize = 16;
+#  else
+static constexpr std::size_t kRecvBatchSize = 1;
+#  endif
+
 UnixUdpSocket::UnixUdpSocket(Ptr<IPoller> const& poller)
     : UnixSocket{*poller, MakeSocket()} {
-  // 1200 is our default MTU for UDP
-  recv_buffer_.resize(1200);
+  recv_buffer_.resize(kRecvBatchSize * kUdpMtu);
 }
 
 int UnixUdpSocket::MakeSocket() {
@@ -84,5 +96,78 @@ ISocket& UnixUdpSocket::Connect(AddressPort const& destination,
   return *this;
 }
 
+#  if UNIX_UDP_MMSG_ENABLED
+std::optional<std::size_t> UnixUdpSocket::SendDatagrams(
+    Span<Span<std::uint8_t const> const> datagrams) {
+  if (!socket_) {
+    return std::nullopt;
+  }
+  std::array<iovec, kMaxSendDatagrams> iov;
+  std::array<mmsghdr, kMaxSendDatagrams> msgs{};
+  auto count = std::min(datagrams.size(), msgs.size());
+  for (std::size_t i = 0; i < count; ++i) {
+    auto const& d = datagrams.data()[i];
+    iov[i].iov_base = const_cast<std::uint8_t*>(d.data());  // NOLINT
+    iov[i].iov_len = d.size();
+    msgs[i].msg_hdr.msg_iov = &iov[i];
+    msgs[i].msg_hdr.msg_iovlen = 1;
+  }
+  // socket is connected, so no address for each message
+  auto res = sendmmsg(*socket_->fd(), msgs.data(),
+                      static_cast<unsigned int>(count), MSG_NOSIGNAL);
+  auto sent = SendResult(res);
+  if (!sent) {
+    return sent;
+  }
+  // datagram sent not completely is an error
+  for (std::size_t i = 0; i < *sent; ++i) {
+    if (msgs[i].msg_len != iov[i].iov_len) {
+      AE_TELED_ERROR("Datagram is sent partially {} of {}", msgs[i].msg_len,
+                     iov[i].iov_len);
+      return (i == 0) ? std::nullopt : std::optional{i};
+    }
+  }
+  return sent;
+}
+
+void UnixUdpSocket::OnReadEvent(DescriptorType fd) {
+  std::array<iovec, kRecvBatchSize> iov;
+  std::array<mmsghdr, kRecvBatchSize> msgs{};
+  for (std::size_t i = 0; i < kRecvBatchSize; ++i) {
+    iov[i].iov_base = recv_buffer_.data() + (i * kUdpMtu);
+    iov[i].iov_len = kUdpMtu;
+    msgs[i].msg_hdr.msg_iov = &iov[i];
+    msgs[i].msg_hdr.msg_iovlen = 1;
+  }
+
+  // read all datagrams
+  while (true) {
+    auto res = recvmmsg(fd, msgs.data(), kRecvBatchSize, 0, nullptr);
+    if (res < 0) {
+      // No data
+      if ((errno == EWOULDBLOCK) || (errno == EAGAIN)) {
+        return;
+      }
+      AE_TELED_ERROR("Recv error {} {}", errno, strerror(errno));
+      OnErrorEvent();
+      return;
+    }
+    auto count = static_cast<std::size_t>(res);
+    for (std::size_t i = 0; i < count; ++i) {
+      // skip empty datagrams
+      if ((msgs[i].msg_len == 0) || !recv_data_cb_) {
+        continue;
+      }
+      recv_data_cb_(Span{recv_buffer_.data() + (i * kUdpMtu),
+                         static_cast<std::size_t>(msgs[i].msg_len)});
+    }
+    if (count < kRecvBatchSize) {
+      // socket is drained
+      return;
+    }
+  }
+}
+#  endif
+
 }  // namespace ae
 #endif
@@ -22,6 +22,11 @@
 
 #if AE_SUPPORT_UDP && UNIX_SOCKET_ENABLED
 
+// send and receive a number of datagrams by one call
+#  if defined(__linux__) || defined(__FreeBSD__)
+#    define UNIX_UDP_MMSG_ENABLED 1
+#  endif
+
 namespace ae {
 class UnixUdpSocket final : public UnixSocket {
  public:
@@ -30,6 +35,14 @@ class UnixUdpSocket final : public UnixSocket {
   ISocket& Connect(AddressPort const& destination,
                    ConnectedCb connected_cb) override;
 
+#  if UNIX_UDP_MMSG_ENABLED
+  std::optional<std::size_t> SendDatagrams(
+      Span<Span<std::uint8_t const> const> datagrams) override;
+
+ protected:
+  void OnReadEvent(DescriptorType fd) override;
+#  endif
+
  private:
   static int MakeSocket();
 };
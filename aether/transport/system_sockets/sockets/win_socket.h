@@ -41,6 +41,7 @@ class WinSocket : public ISocket {
   ISocket& RecvData(RecvDataCb recv_data_cb) override;
   ISocket& Error(ErrorCb error_cb) override;
 
+  using ISocket::Send;
   std::optional<std::size_t> Send(Span<std::uint8_t> data) override;
   void Disconnect() override;
 
@@ -79,12 +79,13 @@ void TcpBase::OnRecvData(Span<std::uint8_t> data) {
     read_event_sub_ = ae_context_.scheduler().Task([&]() {
       auto sl = std::scoped_lock{buffer_lock_};
       read_event_ = false;
-      for (auto data = data_packet_collector_.PopPacket(); !data.empty();
-           data = data_packet_collector_.PopPacket()) {
+      auto data = DataBufferPool::Acquire(0);
+      while (data_packet_collector_.PopPacket(data)) {
         AE_TELE_DEBUG(kTcpTransportReceive, "Socket {} received data size {}",
                       endpoint_, data.size());
         out_data_event_.Emit(data);
       }
+      DataBufferPool::Release(std::move(data));
     });
   }
 }
@@ -25,8 +25,12 @@
 
 #    define SYSTEM_SOCKET_TCP_TRANSPORT_ENABLED 1
 
+#    include <array>
 #    include <mutex>
+#    include <cstdint>
+#    include <utility>
 #    include <optional>
+#    include <algorithm>
 
 #    include "aether/common.h"
 #    include "aether/ae_context.h"
@@ -36,6 +40,7 @@
 #    include "aether/mstream.h"
 #    include "aether/mstream_buffers.h"
 #    include "aether/stream_api/istream.h"
+#    include "aether/types/data_buffer_pool.h"
 #    include "aether/transport/packet_send_action.h"
 #    include "aether/transport/packet_queue_manager.h"
 #    include "aether/transport/data_packet_collector.h"
@@ -46,37 +51,72 @@
 
 namespace ae {
 namespace tcp_internal {
+/**
+ * \brief Send packet size prefix and packet data.
+ * The size prefix is kept in a small inline buffer and data is sent from the
+ * data buffer as is, without copying into a framed packet.
+ */
 template <typename Sock>
 class SendAction final : public PacketSendAction {
+  // max size of serialized PacketSize
+  static constexpr std::size_t kMaxHeaderSize =
+      sizeof(std::uint8_t) + sizeof(std::uint64_t);
+
  public:
   SendAction(AeContext const& ae_context, Sock& socket,
              DataBuffer&& data_buffer)
       : ae_context_{ae_context},
         socket_{&socket},
-        data_{std::move(data_buffer)} {}
+        data_{std::move(data_buffer)} {
+    auto os = omstream{header_};
+    os << static_cast<PacketSize>(data_.size());
+  }
+
+  ~SendAction() override { DataBufferPool::Release(std::move(data_)); }
 
   AE_CLASS_MOVE_ONLY(SendAction)
 
   void Send() override {
-    reenqueue_ = false;
+    auto* self = this;
+    SendBatch(Span{&self, 1});
+  }
 
-    auto size_to_send = data_.size() - sent_offset_;
-    auto res = socket_->Send(Span{data_.data() + sent_offset_, size_to_send});
+  /**
+   * \brief Send a number of actions queued to one socket by one call.
+   */
+  static void SendBatch(Span<SendAction*> batch) {
+    // header and data for each action
+    std::array<Span<std::uint8_t const>, ISocket::kMaxSendBuffers> buffers;
+    std::size_t buffers_count = 0;
+    std::size_t actions_count = 0;
+    for (auto* action : batch) {
+      if ((buffers_count + 2) > buffers.size()) {
+        break;
+      }
+      action->reenqueue_ = false;
+      buffers_count += action->GetBuffers(buffers.data() + buffers_count);
+      ++actions_count;
+    }
+
+    auto& first = *batch.data()[0];
+    auto res = first.socket_->Send(
+        Span<Span<std::uint8_t const> const>{buffers.data(), buffers_count});
     if (!res) {
       AE_TELED_ERROR("Data has not been written");
-      SetStatus(WriteAction::Status::kFail);
+      for (std::size_t i = 0; i < actions_count; ++i) {
+        batch.data()[i]->SetStatus(WriteAction::Status::kFail);
+      }
       return;
     }
     if (*res == 0) {
-      reenqueue_ = true;
+      first.reenqueue_ = true;
       return;
     }
 
-    AE_TELED_DEBUG("Data has been written size {} data {}", *res, data_);
-    sent_offset_ += *res;
-
-    if (sent_offset_ >= data_.size()) {
-      SetStatus(WriteAction::Status::kSuccess);
+    // distribute sent size over actions in order
+    auto sent = *res;
+    for (std::size_t i = 0; (i < actions_count) && (sent != 0); ++i) {
+      sent = batch.data()[i]->OnSent(sent);
     }
     // reenque must happen on event from socket
   }
@@ -98,8 +138,35 @@ class SendAction final : public PacketSendAction {
   }
 
  private:
+  // get not sent parts of header and data, return the count of buffers
+  std::size_t GetBuffers(Span<std::uint8_t const>* buffers) const {
+    auto header = header_.span();
+    if (sent_offset_ < header.size()) {
+      buffers[0] = header.sub(sent_offset_, header.size() - sent_offset_);
+      buffers[1] = Span<std::uint8_t const>{data_.data(), data_.size()};
+      return 2;
+    }
+    auto data_offset = sent_offset_ - header.size();
+    buffers[0] = Span<std::uint8_t const>{data_.data() + data_offset,
+                                          data_.size() - data_offset};
+    return 1;
+  }
+
+  // return the rest of sent size
+  std::size_t OnSent(std::size_t sent) {
+    auto size_to_send = header_.written + data_.size() - sent_offset_;
+    auto consumed = std::min(sent, size_to_send);
+    sent_offset_ += consumed;
+    AE_TELED_DEBUG("Data has been written size {} data {}", consumed, data_);
+    if (consumed == size_to_send) {
+      SetStatus(WriteAction::Status::kSuccess);
+    }
+    return sent - consumed;
+  }
+
   AeContext ae_context_;
   Sock* socket_;
+  ArrayWriter<kMaxHeaderSize, PacketSize> header_;
   DataBuffer data_;
   std::size_t sent_offset_ = 0;
   bool is_done_ = false;
@@ -174,14 +241,9 @@ class TcpTransport final : public tcp_internal::TcpBase {
     AE_TELE_DEBUG(kTcpTransportSend, "Socket {} send data size {}", endpoint_,
                   in_data.size());
 
-    auto packet_data = std::vector<std::uint8_t>{};
-    VectorWriter<PacketSize> vw{packet_data};
-    auto os = omstream{vw};
-    // copy data with size
-    os << std::move(in_data);  // NOLINT
-
+    // data is sent with size prefix without copy, \see SendAction
     auto* send_action =
-        queue_manager_.AddPacket(ae_context_, socket_, std::move(packet_data));
+        queue_manager_.AddPacket(ae_context_, socket_, std::move(in_data));
     if (send_action == nullptr) {
       AE_TELED_ERROR("Queue manager is full");
       return FailedWrite();
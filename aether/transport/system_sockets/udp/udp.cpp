@@ -67,7 +67,8 @@ void UdpBase::OnConnected(ISocket::ConnectionState connection_state) {
 void UdpBase::OnRecvData(Span<std::uint8_t> data) {
   auto lock = std::scoped_lock{buffer_mutex_};
   // put data into read buffers
-  read_buffers_.emplace_back(std::begin(data), std::end(data));
+  read_buffers_.emplace_back(DataBufferPool::Acquire(data.size()))
+      .assign(std::begin(data), std::end(data));
   // if not scheduled schedule a task to emit the data
   if (!read_event_.exchange(true)) {
     read_event_sub_ = ae_context_.scheduler().Task([&]() {
@@ -79,10 +80,11 @@ void UdpBase::OnRecvData(Span<std::uint8_t> data) {
         return rb;
       });
 
-      for (auto const& d : buffers) {
+      for (auto& d : buffers) {
         AE_TELE_DEBUG(kUdpTransportReceive, "Socket {} received data size {}",
                       endpoint_, d.size());
         out_data_event_.Emit(d);
+        DataBufferPool::Release(std::move(d));
       }
     });
   }
@@ -25,14 +25,18 @@
 
 #    define SYSTEM_SOCKET_UDP_TRANSPORT_ENABLED 1
 
+#    include <array>
 #    include <mutex>
+#    include <utility>
 #    include <optional>
+#    include <algorithm>
 
 #    include "aether/ae_context.h"
 #    include "aether/events/multi_subscription.h"
 
 #    include "aether/poller/poller.h"
 #    include "aether/stream_api/istream.h"
+#    include "aether/types/data_buffer_pool.h"
 #    include "aether/transport/transport_tele.h"
 #    include "aether/transport/packet_send_action.h"
 #    include "aether/transport/packet_queue_manager.h"
@@ -50,28 +54,50 @@ class SendAction final : public PacketSendAction {
         socket_{&socket},
         data_{std::move(data_buffer)} {}
 
+  ~SendAction() override { DataBufferPool::Release(std::move(data_)); }
+
   AE_CLASS_MOVE_ONLY(SendAction)
 
   void Send() override {
-    reenqueue_ = false;
-    auto res = socket_->Send(Span{data_.data(), data_.size()});
+    auto* self = this;
+    SendBatch(Span{&self, 1});
+  }
+
+  /**
+   * \brief Send a number of actions queued to one socket by one call, each as
+   * a separate datagram.
+   */
+  static void SendBatch(Span<SendAction*> batch) {
+    std::array<Span<std::uint8_t const>, ISocket::kMaxSendDatagrams>
+        datagrams;
+    auto count = std::min(batch.size(), datagrams.size());
+    for (std::size_t i = 0; i < count; ++i) {
+      auto* action = batch.data()[i];
+      action->reenqueue_ = false;
+      datagrams[i] =
+          Span<std::uint8_t const>{action->data_.data(), action->data_.size()};
+    }
+
+    auto& first = *batch.data()[0];
+    auto res = first.socket_->SendDatagrams(
+        Span<Span<std::uint8_t const> const>{datagrams.data(), count});
     if (!res) {
       AE_TELED_ERROR("Data has not been written");
-      SetStatus(WriteAction::Status::kFail);
+      first.SetStatus(WriteAction::Status::kFail);
+      // the rest are not sent yet
+      if (count > 1) {
+        batch.data()[1]->reenqueue_ = true;
+      }
       return;
     }
-    AE_TELED_DEBUG("Data has been written size {}", *res);
-    if (*res == 0) {
-      reenqueue_ = true;
+    AE_TELED_DEBUG("Datagrams has been written count {}", *res);
+    for (std::size_t i = 0; i < *res; ++i) {
+      batch.data()[i]->SetStatus(WriteAction::Status::kSuccess);
+    }
+    if (*res < batch.size()) {
       // Not sent yet
-      return;
+      batch.data()[*res]->reenqueue_ = true;
     }
-    if (*res != data_.size()) {
-      AE_TELED_ERROR("Send error, sent size isn't same as packet size");
-      SetStatus(WriteAction::Status::kFail);
-      return;
-    }    
-    SetStatus(WriteAction::Status::kSuccess);
   }
 
   void Stop() noexcept override {
@@ -18,6 +18,7 @@
 #define AETHER_TYPE_TRAITS_H_
 
 #include <array>
+#include <cstddef>
 #include <string>
 #include <utility>
 #include <optional>
@@ -106,6 +107,24 @@ struct IsFunctionPtr<
     std::void_t<decltype(static_cast<TFuncPtr>(std::declval<T>()))>>
     : std::true_type {};
 
+/**
+ * \brief Type is serialized the same as it is stored in memory, so a range of
+ * such values is serialized by one copy.
+ * Arithmetic and enum values are serialized in the host byte order, exactly as
+ * a bulk copy does, except bool which is checked on read.
+ * Specialize it for trivially copyable types without padding, which are
+ * serialized member by member in the declaration order.
+ */
+template <typename T, typename Enable = void>
+struct IsBulkSerializable
+    : std::bool_constant<(std::is_arithmetic_v<T> || std::is_enum_v<T>) &&
+                         !std::is_same_v<T, bool>> {};
+
+template <typename T, std::size_t N>
+struct IsBulkSerializable<std::array<T, N>>
+    : std::bool_constant<IsBulkSerializable<T>::value &&
+                         (sizeof(std::array<T, N>) == (N * sizeof(T)))> {};
+
 template <typename Array>
 struct ArraySize;
 
@@ -0,0 +1,84 @@
+/*
+ * Copyright 2026 Aethernet Inc.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef AETHER_TYPES_BORROWED_DATA_H_
+#define AETHER_TYPES_BORROWED_DATA_H_
+
+#include <cstddef>
+#include <concepts>
+#include <cstdint>
+
+#include "aether/mstream.h"
+#include "aether/types/span.h"
+#include "aether/types/data_buffer.h"
+
+namespace ae {
+/**
+ * \brief Bytes field parsed in place.
+ * Serialized the same way as DataBuffer, but refers to the parsed packet
+ * instead of owning a copy, so it is valid only while the packet is alive.
+ * Use ToBuffer to keep the data.
+ */
+class BorrowedData {
+ public:
+  using value_type = std::uint8_t;
+  using const_iterator = std::uint8_t const*;
+
+  BorrowedData() = default;
+  explicit BorrowedData(Span<std::uint8_t const> data) : data_{data} {}
+  explicit BorrowedData(DataBuffer const& data)
+      : data_{data.data(), data.size()} {}
+
+  std::uint8_t const* data() const { return data_.data(); }
+  std::size_t size() const { return data_.size(); }
+  bool empty() const { return data_.size() == 0; }
+
+  const_iterator begin() const { return data_.begin(); }
+  const_iterator end() const { return data_.end(); }
+
+  Span<std::uint8_t const> span() const { return data_; }
+  DataBuffer ToBuffer() const { return DataBuffer{begin(), end()}; }
+
+  /**
+   * \brief Borrow from the readers over not owned memory.
+   */
+  template <typename Ib>
+    requires requires(Ib& ib, std::size_t size) {
+      { ib.borrow(size) } -> std::same_as<Span<std::uint8_t const>>;
+    }
+  friend imstream<Ib>& operator>>(imstream<Ib>& is, BorrowedData& value) {
+    typename Ib::size_type size;
+    is >> size;
+    if (data_was_read(is)) {
+      value.data_ = is.ib_.borrow(static_cast<std::size_t>(size));
+    }
+    return is;
+  }
+
+  template <typename Ob>
+  friend omstream<Ob>& operator<<(omstream<Ob>& os,
+                                  BorrowedData const& value) {
+    os << static_cast<typename Ob::size_type>(value.size());
+    os.write(value.data(), value.size());
+    return os;
+  }
+
+ private:
+  Span<std::uint8_t const> data_;
+};
+}  // namespace ae
+
+#endif  // AETHER_TYPES_BORROWED_DATA_H_
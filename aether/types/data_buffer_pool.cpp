@@ -0,0 +1,85 @@
+/*
+ * Copyright 2026 Aethernet Inc.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "aether/types/data_buffer_pool.h"
+
+#include <utility>
+
+namespace ae {
+DataBuffer DataBufferPool::Acquire(std::size_t size) {
+  auto required = size + kTailroom;
+  // size classes only matter for the buffers kept in the pool
+  if constexpr (kPoolSize != 0) {
+    for (std::size_t i = 0; i < kSizeClasses.size(); ++i) {
+      if (required <= kSizeClasses[i]) {
+        return Instance().Get(i);
+      }
+    }
+  }
+  // too big for the pool or pool is disabled
+  DataBuffer buffer;
+  buffer.reserve(required);
+  return buffer;
+}
+
+void DataBufferPool::Release(DataBuffer&& buffer) {
+  // memory not taken by the pool is freed with it
+  auto released = std::move(buffer);
+  if constexpr (kPoolSize == 0) {
+    return;
+  }
+  auto capacity = released.capacity();
+  // do not keep memory of the too big buffers
+  if ((capacity < kSizeClasses.front()) ||
+      (capacity > (2 * kSizeClasses.back()))) {
+    return;
+  }
+  // the biggest class the buffer fits
+  std::size_t size_class = kSizeClasses.size() - 1;
+  while (capacity < kSizeClasses[size_class]) {
+    --size_class;
+  }
+  released.clear();
+  Instance().Put(size_class, released);
+}
+
+DataBufferPool& DataBufferPool::Instance() {
+  // never destroyed to allow release buffers from the static destructors
+  static auto* pool = new DataBufferPool{};
+  return *pool;
+}
+
+DataBuffer DataBufferPool::Get(std::size_t size_class) {
+  if constexpr (kPoolSize != 0) {
+    auto lock = std::scoped_lock{lock_};
+    if (free_count_[size_class] != 0) {
+      return std::move(free_[size_class][--free_count_[size_class]]);
+    }
+  }
+  DataBuffer buffer;
+  buffer.reserve(kSizeClasses[size_class]);
+  return buffer;
+}
+
+void DataBufferPool::Put(std::size_t size_class, DataBuffer& buffer) {
+  if constexpr (kPoolSize != 0) {
+    auto lock = std::scoped_lock{lock_};
+    if (free_count_[size_class] != kPoolSize) {
+      free_[size_class][free_count_[size_class]++] = std::move(buffer);
+    }
+  }
+}
+}  // namespace ae
@@ -0,0 +1,67 @@
+/*
+ * Copyright 2026 Aethernet Inc.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef AETHER_TYPES_DATA_BUFFER_POOL_H_
+#define AETHER_TYPES_DATA_BUFFER_POOL_H_
+
+#include <array>
+#include <mutex>
+#include <cstddef>
+
+#include "aether/config.h"
+#include "aether/types/data_buffer.h"
+
+namespace ae {
+/**
+ * \brief Pool of the data buffers memory.
+ * Buffers are split into size classes by their capacity, released buffers are
+ * kept in the class free list and returned by Acquire without allocation.
+ * Buffers are passed through the stream layers by move and released by the
+ * layer consumed the data.
+ */
+class DataBufferPool {
+ public:
+  // min capacity of buffers in each size class
+  static constexpr std::array<std::size_t, 4> kSizeClasses{256, 1024, 4096,
+                                                           16384};
+  static constexpr std::size_t kPoolSize = AE_DATA_BUFFER_POOL_SIZE;
+  static constexpr std::size_t kTailroom = AE_DATA_BUFFER_TAILROOM;
+
+  /**
+   * \brief Get an empty buffer able to hold size bytes and the tailroom
+   * without reallocation.
+   */
+  static DataBuffer Acquire(std::size_t size);
+  /**
+   * \brief Return the buffer's memory to the pool.
+   * Any buffer is accepted, too small or too big are just freed.
+   */
+  static void Release(DataBuffer&& buffer);
+
+ private:
+  static DataBufferPool& Instance();
+
+  DataBuffer Get(std::size_t size_class);
+  // take the buffer if there is a space in the size class
+  void Put(std::size_t size_class, DataBuffer& buffer);
+
+  std::mutex lock_;
+  std::array<std::array<DataBuffer, kPoolSize>, kSizeClasses.size()> free_;
+  std::array<std::size_t, kSizeClasses.size()> free_count_{};
+};
+}  // namespace ae
+
+#endif  // AETHER_TYPES_DATA_BUFFER_POOL_H_
@@ -0,0 +1,212 @@
+/*
+ * Copyright 2026 Aethernet Inc.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef AETHER_TYPES_FLAT_HASH_MAP_H_
+#define AETHER_TYPES_FLAT_HASH_MAP_H_
+
+#include <vector>
+#include <cstddef>
+#include <cstdint>
+#include <utility>
+#include <type_traits>
+
+namespace ae {
+/**
+ * \brief Open addressed hash map for integral keys.
+ * Linear probing over a flat array of slots, erase shifts the following slots
+ * back, so there are no tombstones. Any insert may move the values.
+ */
+template <typename Key, typename Value>
+  requires(std::is_integral_v<Key>)
+class FlatHashMap {
+  struct Slot {
+    Key key{};
+    bool used{};
+    Value value{};
+  };
+
+ public:
+  FlatHashMap() = default;
+
+  Value* Find(Key key) {
+    auto i = Lookup(key);
+    return (i == kNotFound) ? nullptr : &slots_[i].value;
+  }
+
+  Value const* Find(Key key) const {
+    auto i = Lookup(key);
+    return (i == kNotFound) ? nullptr : &slots_[i].value;
+  }
+
+  bool Contains(Key key) const { return Lookup(key) != kNotFound; }
+
+  /**
+   * \brief Find value by key or insert the default constructed one.
+   * \return the value and true if it's inserted.
+   */
+  std::pair<Value*, bool> Insert(Key key) {
+    if (auto i = Lookup(key); i != kNotFound) {
+      return {&slots_[i].value, false};
+    }
+    if (((size_ + 1) * 4) > (slots_.size() * 3)) {
+      Rehash(slots_.empty() ? kMinCapacity : slots_.size() * 2);
+    }
+    auto& slot = slots_[FreeSlot(key)];
+    slot.key = key;
+    slot.used = true;
+    ++size_;
+    return {&slot.value, true};
+  }
+
+  Value& operator[](Key key) { return *Insert(key).first; }
+
+  bool Erase(Key key) {
+    auto i = Lookup(key);
+    if (i == kNotFound) {
+      return false;
+    }
+    auto mask = slots_.size() - 1;
+    for (auto j = (i + 1) & mask; slots_[j].used; j = (j + 1) & mask) {
+      // slot j may fill the gap if the gap is between its home and j
+      auto home = Home(slots_[j].key);
+      if (((j - home) & mask) >= ((j - i) & mask)) {
+        slots_[i] = std::move(slots_[j]);
+        i = j;
+      }
+    }
+    slots_[i] = Slot{};
+    --size_;
+    return true;
+  }
+
+  void Clear() {
+    for (auto& slot : slots_) {
+      if (slot.used) {
+        slot = Slot{};
+      }
+    }
+    size_ = 0;
+  }
+
+  void Reserve(std::size_t count) {
+    auto capacity = kMinCapacity;
+    while ((capacity * 3) < (count * 4)) {
+      capacity *= 2;
+    }
+    if (capacity > slots_.size()) {
+      Rehash(capacity);
+    }
+  }
+
+  // apply func(key, value) to each element
+  template <typename TFunc>
+  void ForEach(TFunc&& func) {
+    for (auto& slot : slots_) {
+      if (slot.used) {
+        func(slot.key, slot.value);
+      }
+    }
+  }
+
+  template <typename TFunc>
+  void ForEach(TFunc&& func) const {
+    for (auto const& slot : slots_) {
+      if (slot.used) {
+        func(slot.key, slot.value);
+      }
+    }
+  }
+
+  std::size_t size() const { return size_; }
+  bool empty() const { return size_ == 0; }
+
+ private:
+  static constexpr std::size_t kMinCapacity = 16;
+  static constexpr auto kNotFound = static_cast<std::size_t>(-1);
+
+  std::size_t Home(Key key) const {
+    // fibonacci hashing, the high bits of product are the best mixed
+    auto value = static_cast<std::uint64_t>(key);
+    return static_cast<std::size_t>((value * 0x9E3779B97F4A7C15ULL) >> shift_);
+  }
+
+  std::size_t Lookup(Key key) const {
+    if (size_ == 0) {
+      return kNotFound;
+    }
+    auto mask = slots_.size() - 1;
+    for (auto i = Home(key); slots_[i].used; i = (i + 1) & mask) {
+      if (slots_[i].key == key) {
+        return i;
+      }
+    }
+    return kNotFound;
+  }
+
+  std::size_t FreeSlot(Key key) const {
+    auto mask = slots_.size() - 1;
+    auto i = Home(key);
+    while (slots_[i].used) {
+      i = (i + 1) & mask;
+    }
+    return i;
+  }
+
+  void Rehash(std::size_t capacity) {
+    auto old = std::exchange(slots_, std::vector<Slot>(capacity));
+    shift_ = 64;
+    for (auto c = capacity; c > 1; c >>= 1) {
+      --shift_;
+    }
+    for (auto& slot : old) {
+      if (slot.used) {
+        auto& new_slot = slots_[FreeSlot(slot.key)];
+        new_slot.key = slot.key;
+        new_slot.used = true;
+        new_slot.value = std::move(slot.value);
+      }
+    }
+  }
+
+  std::vector<Slot> slots_;
+  std::size_t size_{};
+  std::size_t shift_{64};
+};
+
+/**
+ * \brief Open addressed hash set for integral keys \see FlatHashMap.
+ */
+template <typename Key>
+class FlatHashSet {
+  struct Empty {};
+
+ public:
+  // return true if key is inserted, false if it's already in the set
+  bool Insert(Key key) { return map_.Insert(key).second; }
+  bool Contains(Key key) const { return map_.Contains(key); }
+  bool Erase(Key key) { return map_.Erase(key); }
+  void Clear() { map_.Clear(); }
+  void Reserve(std::size_t count) { map_.Reserve(count); }
+
+  std::size_t size() const { return map_.size(); }
+  bool empty() const { return map_.empty(); }
+
+ private:
+  FlatHashMap<Key, Empty> map_;
+};
+}  // namespace ae
+
+#endif  // AETHER_TYPES_FLAT_HASH_MAP_H_
@@ -24,6 +24,7 @@
 #include <cassert>
 #include <charconv>
 #include <string_view>
+#include <type_traits>
 
 #include "aether/type_traits.h"
 #include "aether-miscpp/format/format.h"
@@ -98,6 +99,12 @@ struct Uid {
   std::array<std::uint8_t, kSize> value;
 };
 
+// serialized as the only value member
+template <>
+struct IsBulkSerializable<Uid>
+    : std::bool_constant<std::is_trivially_copyable_v<Uid> &&
+                         (sizeof(Uid) == Uid::kSize)> {};
+
 template <>
 struct Formatter<Uid> {
   template <typename TStream>
@@ -20,6 +20,7 @@
 #include "aether/types/uid.h"
 #include "aether-miscpp/reflect/reflect.h"
 #include "aether/types/data_buffer.h"
+#include "aether/types/borrowed_data.h"
 
 namespace ae {
 struct AeMessage {
@@ -28,6 +29,17 @@ struct AeMessage {
   Uid uid;
   DataBuffer data;
 };
+
+/**
+ * \brief Received AeMessage with the data parsed in place.
+ * Same wire format as AeMessage, valid only while the packet is alive.
+ */
+struct AeMessageView {
+  AE_REFLECT_MEMBERS(uid, data)
+
+  Uid uid;
+  BorrowedData data;
+};
 }  // namespace ae
 
 #endif  // AETHER_WORK_CLOUD_API_AE_MESSAGE_H_
@@ -39,7 +39,7 @@ void ClientApiSafe::NewChildren([[maybe_unused]] std::vector<Uid> const& uids) {
   AE_TELED_DEBUG("NewChildren");
 }
 
-void ClientApiSafe::SendMessages(std::vector<AeMessage> const& messages) {
+void ClientApiSafe::SendMessages(std::vector<AeMessageView> const& messages) {
   for (auto const& msg : messages) {
     AE_TELED_DEBUG("Received message uid:{}", msg.uid);
     send_message_event_.Emit(msg);
@@ -110,7 +110,7 @@ void ClientApiSafe::SendAccessCheckResults(
   AE_TELED_DEBUG("SendAccessCheckResults");
 }
 
-void ClientApiSafe::SendMessage(AeMessage const& msg) {
+void ClientApiSafe::SendMessage(AeMessageView const& msg) {
   AE_TELED_DEBUG("Received message uid:{}", msg.uid);
   send_message_event_.Emit(msg);
 }
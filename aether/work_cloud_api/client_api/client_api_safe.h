@@ -48,7 +48,7 @@ class ClientApiSafe : public ApiClassImpl<ClientApiSafe> {
   void ChangeParent(Uid const& uid);
   void ChangeAlias(Uid const& uid);
   void NewChildren(std::vector<Uid> const& uids);
-  void SendMessages(std::vector<AeMessage> const& messages);
+  void SendMessages(std::vector<AeMessageView> const& messages);
 
   void SendServerDescriptor(ServerDescriptor const& server_descriptor);
   void SendServerDescriptors(
@@ -71,7 +71,7 @@ class ClientApiSafe : public ApiClassImpl<ClientApiSafe> {
   void SendAllAccessedClients(Uid const& uid,
                               std::vector<Uid> const& accessed_clients);
   void SendAccessCheckResults(std::vector<AccessCheckResult> const& results);
-  void SendMessage(AeMessage const& message);
+  void SendMessage(AeMessageView const& message);
 
   void SendCLoudConfig(std::vector<CloudConfig> const& configs);
 
@@ -109,7 +109,7 @@ class ClientApiSafe : public ApiClassImpl<ClientApiSafe> {
   auto send_cloud_configs() { return EventSubscriber{send_cloud_configs_}; }
 
  private:
-  Event<void(AeMessage const& message)> send_message_event_;
+  Event<void(AeMessageView const& message)> send_message_event_;
   Event<void(ServerDescriptor const& server_descriptor)>
       send_server_descriptor_event_;
   Event<void(Uid const& uid, CloudDescriptor const& cloud)> send_cloud_event_;
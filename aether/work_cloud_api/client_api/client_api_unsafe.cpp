@@ -27,19 +27,20 @@ ClientApiUnsafe::ClientApiUnsafe(ProtocolContext& protocol_context,
       client_safe_api_{protocol_context} {}
 
 void ClientApiUnsafe::SendSafeApiData(SubApiImpl<ClientApiSafe> sub_api) {
-  sub_api.Parse(client_safe_api_, [this](auto const& data) {
-    auto decrypted = Decrypt(data);
-    if (decrypted.empty()) {
+  // sub api owns its data, so it's decrypted in place
+  sub_api.Parse(client_safe_api_, [this](DataBuffer& data) -> DataBuffer& {
+    if (!Decrypt(data)) {
       AE_TELED_WARNING("Dropped packet: client safe api decrypt failed");
-      return decrypted;
+      data.clear();
+      return data;
     }
-    AE_TELED_DEBUG("Client api unsafe data {}", decrypted);
-    return decrypted;
+    AE_TELED_DEBUG("Client api unsafe data {}", data);
+    return data;
   });
 }
 
-DataBuffer ClientApiUnsafe::Decrypt(DataBuffer const& data) {
-  return decrypt_provider_->Decrypt(data);
+bool ClientApiUnsafe::Decrypt(DataBuffer& data) {
+  return decrypt_provider_->DecryptInPlace(data);
 }
 
 }  // namespace ae
@@ -39,7 +39,7 @@ class ClientApiUnsafe : public ApiClassImpl<ClientApiUnsafe> {
   ClientApiSafe& client_api_safe() { return client_safe_api_; }
 
  private:
-  DataBuffer Decrypt(DataBuffer const& data);
+  bool Decrypt(DataBuffer& data);
 
   IDecryptProvider* decrypt_provider_;
   ClientApiSafe client_safe_api_;
@@ -16,6 +16,9 @@
 
 #include "aether/work_cloud_api/work_server_api/login_api.h"
 
+#include <utility>
+
+#include "aether/types/data_buffer_pool.h"
 #include "aether/tele.h"
 
 namespace ae {
@@ -28,11 +31,15 @@ LoginApi::LoginApi(ProtocolContext& protocol_context,
       encrypt_provider_{&encrypt_provider},
       auth_api_{protocol_context} {}
 
-DataBuffer LoginApi::Encrypt(DataBuffer const& data) {
+DataBuffer LoginApi::Encrypt(DataBuffer&& data) {
   AE_TELED_DEBUG("Login api data {}", data);
-  auto enc_data = encrypt_provider_->Encrypt(data);
-  AE_TELED_DEBUG("Login api encrypted size {}, {}", enc_data.size(), enc_data);
-  return enc_data;
+  if (!encrypt_provider_->EncryptInPlace(data)) {
+    AE_TELED_ERROR("Login api encryption failed");
+    DataBufferPool::Release(std::move(data));
+    return {};
+  }
+  AE_TELED_DEBUG("Login api encrypted size {}, {}", data.size(), data);
+  return std::move(data);
 }
 
 }  // namespace ae
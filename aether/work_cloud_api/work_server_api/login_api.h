@@ -54,7 +54,7 @@ class LoginApi : public ApiClass {
   AuthorizedApi& authorized_api() { return auth_api_; }
 
  private:
-  DataBuffer Encrypt(DataBuffer const& data);
+  DataBuffer Encrypt(DataBuffer&& data);
 
   IEncryptProvider* encrypt_provider_;
   AuthorizedApi auth_api_;
@@ -20,10 +20,14 @@ void setUp() {}
 void tearDown() {}
 
 extern int test_method_call();
+extern int test_api_dispatch_bench();
 
 int main() {
   int res = 0;
   res += test_method_call();
+#if defined AE_API_PROTOCOL_BENCH
+  res += test_api_dispatch_bench();
+#endif
 
   return res;
 }
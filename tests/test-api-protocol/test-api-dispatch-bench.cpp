@@ -0,0 +1,98 @@
+/*
+ * Copyright 2026 Aethernet Inc.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <unity.h>
+
+#include <vector>
+#include <cstdint>
+
+#include "aether/api_protocol/api_protocol.h"
+#include "aether/work_cloud_api/ae_message.h"
+#include "aether/work_cloud_api/client_api/client_api_safe.h"
+
+#include "tests/benchmarking.h"
+
+#if defined AE_API_PROTOCOL_BENCH
+namespace ae::test_api_dispatch_bench {
+static constexpr std::size_t kBenchCount = 1000;
+static constexpr std::size_t kMessages = 1000;
+
+// ClientApiSafe::SendMessage is the last registered method
+static constexpr MessageId kSendMessage = 20;
+static constexpr MessageId kSendMessages = 6;
+
+AeMessage MakeMessage(std::size_t i) {
+  auto message = AeMessage{};
+  message.uid.value[0] = static_cast<std::uint8_t>(i);
+  message.data = DataBuffer(32, static_cast<std::uint8_t>(i));
+  return message;
+}
+
+void test_SendMessagesDispatchBench() {
+  ProtocolContext pc;
+  auto client_api = ClientApiSafe{pc};
+  std::size_t received = 0;
+  client_api.send_message_event().Subscribe(
+      [&](AeMessageView const& /* message */) { ++received; });
+
+  DataBuffer send_message_packet;
+  {
+    auto writer = VectorWriter<PackedSize>{send_message_packet};
+    auto os = omstream{writer};
+    for (std::size_t i = 0; i < kMessages; ++i) {
+      os << kSendMessage << MakeMessage(i);
+    }
+  }
+
+  DataBuffer send_messages_packet;
+  {
+    auto messages = std::vector<AeMessage>{};
+    for (std::size_t i = 0; i < kMessages; ++i) {
+      messages.push_back(MakeMessage(i));
+    }
+    auto writer = VectorWriter<PackedSize>{send_messages_packet};
+    auto os = omstream{writer};
+    os << kSendMessages << messages;
+  }
+
+  tests::BenchmarkFunc(
+      [&](auto) {
+        auto parser = ApiParser{pc, send_message_packet};
+        parser.Parse(client_api);
+      },
+      kBenchCount, "parse packet with ", kMessages, " send_message calls");
+  TEST_ASSERT_EQUAL(kBenchCount * kMessages, received);
+
+  received = 0;
+  tests::BenchmarkFunc(
+      [&](auto) {
+        auto parser = ApiParser{pc, send_messages_packet};
+        parser.Parse(client_api);
+      },
+      kBenchCount, "parse send_messages with ", kMessages, " entries");
+  TEST_ASSERT_EQUAL(kBenchCount * kMessages, received);
+}
+
+}  // namespace ae::test_api_dispatch_bench
+#endif
+
+int test_api_dispatch_bench() {
+  UNITY_BEGIN();
+#if defined AE_API_PROTOCOL_BENCH
+  RUN_TEST(ae::test_api_dispatch_bench::test_SendMessagesDispatchBench);
+#endif
+  return UNITY_END();
+}
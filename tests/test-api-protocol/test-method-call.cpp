@@ -16,14 +16,17 @@
 
 #include <unity.h>
 
+#include <memory>
 #include <string>
 #include <utility>
 #include <vector>
 
 #include "aether/api_protocol/api_protocol.h"
+#include "aether/api_protocol/pending_table.h"
 #include "aether/events/events.h"
 
 #include "aether/types/data_buffer.h"
+#include "aether/types/borrowed_data.h"
 
 #include "assert_packet.h"
 
@@ -37,15 +40,21 @@ struct Number {
 class ApiLevel1 : public ApiClassImpl<ApiLevel1> {
  public:
   explicit ApiLevel1(ProtocolContext& protocol_context)
-      : ApiClassImpl{protocol_context}, method_3{protocol_context} {}
+      : ApiClassImpl{protocol_context},
+        method_3{protocol_context},
+        method_4{protocol_context} {}
 
   void Method3Impl(float a) { method_3_event.Emit(a); }
+  void Method4Impl(BorrowedData data) { method_4_event.Emit(data); }
 
-  AE_METHODS(RegMethod<03, &ApiLevel1::Method3Impl>);
+  AE_METHODS(RegMethod<03, &ApiLevel1::Method3Impl>,
+             RegMethod<04, &ApiLevel1::Method4Impl>);
 
   Method<03, void(float a)> method_3;
+  Method<04, void(DataBuffer data)> method_4;
 
   Event<void(float a)> method_3_event;
+  Event<void(BorrowedData const& data)> method_4_event;
 };
 
 class ApiLevel0 : public ApiClassImpl<ApiLevel0> {
@@ -136,6 +145,37 @@ void test_ApiMethodInvoke() {
   TEST_ASSERT(level1_method3_called);
 }
 
+// registered methods and the return result api extension
+static_assert(ApiDispatchTable<ApiLevel0>::Get(3) != nullptr);
+static_assert(ApiDispatchTable<ApiLevel0>::Get(6) != nullptr);
+static_assert(ApiDispatchTable<ApiLevel0>::Get(ReturnResultApi::kSendError) !=
+              nullptr);
+static_assert(ApiDispatchTable<ApiLevel0>::Get(7) == nullptr);
+
+void test_UnknownMessageIdDropsPacket() {
+  ProtocolContext pc;
+
+  auto api_level0 = ApiLevel0{pc};
+
+  DataBuffer packet;
+  {
+    auto writer = VectorWriter<PackedSize>{packet};
+    auto os = omstream{writer};
+    os << MessageId{3} << int{1} << std::string{"a"};
+    os << MessageId{200} << int{2};
+    os << MessageId{3} << int{3} << std::string{"b"};
+  }
+
+  int method3_called = 0;
+  EventSubscriber{api_level0.method_3_event}.Subscribe(
+      [&](int, std::string const&) { ++method3_called; });
+
+  auto parser = ApiParser{pc, packet};
+  parser.Parse(api_level0);
+
+  TEST_ASSERT_EQUAL(1, method3_called);
+}
+
 void test_ReturnResult() {
   ProtocolContext pc;
 
@@ -204,6 +244,152 @@ void test_MethodWithSubApi() {
   TEST_ASSERT_TRUE(level1_method3_called);
 }
 
+/**
+ * \brief Sub context and borrowed data are parsed in place of the packet.
+ */
+void test_SubContextParsedInPlace() {
+  ProtocolContext pc;
+
+  auto api_level0 = ApiLevel0{pc};
+  auto call_context = ApiContext{api_level0};
+
+  auto payload = DataBuffer(300);
+  for (std::size_t i = 0; i < payload.size(); ++i) {
+    payload[i] = static_cast<std::uint8_t>(i);
+  }
+  call_context->method_5(54)->method_4(payload);
+
+  DataBuffer packet = std::move(call_context);
+
+  bool method4_called = false;
+  EventSubscriber{api_level0.api_level1.method_4_event}.Subscribe(
+      [&](BorrowedData const& data) {
+        method4_called = true;
+        // points into the packet
+        TEST_ASSERT_TRUE(data.data() >= packet.data());
+        TEST_ASSERT_TRUE((data.data() + data.size()) <=
+                         (packet.data() + packet.size()));
+        TEST_ASSERT_TRUE(data.ToBuffer() == payload);
+      });
+
+  auto parser =
+      ApiParser{pc, Span<std::uint8_t const>{packet.data(), packet.size()}};
+  parser.Parse(api_level0);
+
+  TEST_ASSERT_TRUE(method4_called);
+}
+
+/**
+ * \brief Sub api bigger than one byte size prefix is packed the same as
+ * packed separately.
+ */
+void test_NestedPackingBigChild() {
+  static constexpr int kCount = 100;
+
+  ProtocolContext pc;
+
+  auto api_level0 = ApiLevel0{pc};
+  auto call_context = ApiContext{api_level0};
+  {
+    auto sub_context = call_context->method_5(54);
+    for (int i = 0; i < kCount; ++i) {
+      sub_context->method_3(static_cast<float>(i));
+    }
+  }
+  DataBuffer packet = std::move(call_context);
+
+  auto child = DataBuffer{};
+  auto child_writer = VectorWriter<PackedSize>{child};
+  auto child_os = omstream{child_writer};
+  for (int i = 0; i < kCount; ++i) {
+    child_os << MessageId{3} << static_cast<float>(i);
+  }
+  auto expected = DataBuffer{};
+  auto writer = VectorWriter<PackedSize>{expected};
+  auto os = omstream{writer};
+  os << MessageId{5} << int{54} << child;
+
+  TEST_ASSERT_EQUAL(expected.size(), packet.size());
+  TEST_ASSERT_EQUAL_UINT8_ARRAY(expected.data(), packet.data(),
+                                expected.size());
+
+  int level1_method3_called = 0;
+  EventSubscriber{api_level0.api_level1.method_3_event}.Subscribe(
+      [&](float a) {
+        TEST_ASSERT_EQUAL_FLOAT(static_cast<float>(level1_method3_called), a);
+        ++level1_method3_called;
+      });
+
+  auto parser = ApiParser{pc, packet};
+  parser.Parse(api_level0);
+
+  TEST_ASSERT_EQUAL(kCount, level1_method3_called);
+}
+
+/**
+ * \brief Children with the size prefix of different width packed one after
+ * another are packed the same as packed separately.
+ */
+void test_NestedPackingSizeChange() {
+  ProtocolContext pc;
+
+  auto api_level0 = ApiLevel0{pc};
+  for (int count : {100, 10, 100, 100, 1000, 10}) {
+    auto call_context = ApiContext{api_level0};
+    {
+      auto sub_context = call_context->method_5(54);
+      for (int i = 0; i < count; ++i) {
+        sub_context->method_3(static_cast<float>(i));
+      }
+    }
+    DataBuffer packet = std::move(call_context);
+
+    auto child = DataBuffer{};
+    auto child_writer = VectorWriter<PackedSize>{child};
+    auto child_os = omstream{child_writer};
+    for (int i = 0; i < count; ++i) {
+      child_os << MessageId{3} << static_cast<float>(i);
+    }
+    auto expected = DataBuffer{};
+    auto writer = VectorWriter<PackedSize>{expected};
+    auto os = omstream{writer};
+    os << MessageId{5} << int{54} << child;
+
+    TEST_ASSERT_EQUAL(expected.size(), packet.size());
+    TEST_ASSERT_EQUAL_UINT8_ARRAY(expected.data(), packet.data(),
+                                  expected.size());
+  }
+}
+
+/**
+ * \brief More messages than packet stack's storage are packed in order.
+ */
+void test_PacketStackManyMessages() {
+  static constexpr int kCount = 50;
+
+  ProtocolContext pc;
+
+  auto api_level0 = ApiLevel0{pc};
+  auto call_context = ApiContext{api_level0};
+  for (int i = 0; i < kCount; ++i) {
+    call_context->method_3(i, std::to_string(i));
+  }
+  DataBuffer packet = std::move(call_context);
+
+  int level0_method3_called = 0;
+  EventSubscriber{api_level0.method_3_event}.Subscribe(
+      [&](int a, std::string const& b) {
+        TEST_ASSERT_EQUAL(level0_method3_called, a);
+        TEST_ASSERT_EQUAL_STRING(std::to_string(a).c_str(), b.c_str());
+        ++level0_method3_called;
+      });
+
+  auto parser = ApiParser{pc, packet};
+  parser.Parse(api_level0);
+
+  TEST_ASSERT_EQUAL(kCount, level0_method3_called);
+}
+
 void test_ProtocolContextStackAccess() {
   ProtocolContext pc;
 
@@ -410,13 +596,86 @@ void test_PendingResponseDuplicateReplacementPreservesFifo() {
   TEST_ASSERT_FALSE(second_evicted);
 }
 
+void test_PendingResponseDeadline() {
+  using Entry = api_promise_internal::PendingResponseEntry<short, int>;
+  ProtocolContext pc;
+
+  auto now = Now();
+  auto& late = pc.CreatePendingResponse<Entry>(RequestId{1}, now + 2s);
+  auto& early = pc.CreatePendingResponse<Entry>(RequestId{2}, now + 1s);
+
+  int late_error = 0;
+  int early_error = 0;
+  auto late_sub = EventSubscriber{late.event}.Subscribe(
+      [&](auto const& res) { late_error = res.error(); });
+  auto early_sub = EventSubscriber{early.event}.Subscribe(
+      [&](auto const& res) { early_error = res.error(); });
+
+  TEST_ASSERT_TRUE((now + 1s) == pc.UpdatePending(now));
+  TEST_ASSERT_EQUAL(2, pc.pending_count());
+
+  // early is dropped by the deadline
+  TEST_ASSERT_TRUE((now + 2s) == pc.UpdatePending(now + 1s));
+  TEST_ASSERT_EQUAL(-1, early_error);
+  TEST_ASSERT_EQUAL(1, pc.pending_count());
+
+  pc.SetSendErrorResponse(RequestId{1}, 0, 7);
+  TEST_ASSERT_EQUAL(7, late_error);
+  TEST_ASSERT_TRUE(TimePoint::max() == pc.UpdatePending(now + 3s));
+  TEST_ASSERT_EQUAL(0, pc.pending_count());
+}
+
+void test_PendingTableManyInFlight() {
+  static constexpr std::uint32_t kCount = 4096;
+  using Table = PendingTable<std::uint32_t, kCount>;
+  auto table = std::make_unique<Table>();
+  auto values = std::vector<std::uint32_t>(kCount);
+
+  auto deadline = TimePoint{};
+  for (std::uint32_t i = 0; i < kCount; ++i) {
+    values[i] = i;
+    table->Insert(RequestId{i + 1}, &values[i], deadline + i * 1ms);
+  }
+  TEST_ASSERT_TRUE(table->full());
+
+  // take every other in the order of responses
+  for (std::uint32_t i = 1; i < kCount; i += 2) {
+    auto* value = table->Take(RequestId{i + 1});
+    TEST_ASSERT_NOT_NULL(value);
+    TEST_ASSERT_EQUAL(i, *value);
+  }
+  TEST_ASSERT_NULL(table->Take(RequestId{2}));
+  TEST_ASSERT_EQUAL(kCount / 2, table->size());
+
+  // the rest are still found after the probe sequences are shifted
+  for (std::uint32_t i = 0; i < kCount; i += 2) {
+    TEST_ASSERT_EQUAL(i, *table->Take(RequestId{i + 1}));
+    table->Insert(RequestId{i + 1}, &values[i], deadline + i * 1ms);
+  }
+
+  // front is the earliest deadline
+  for (std::uint32_t i = 0; i < kCount; i += 2) {
+    TEST_ASSERT_TRUE((deadline + i * 1ms) == table->next_deadline());
+    auto front = table->TakeFront();
+    TEST_ASSERT_EQUAL(i + 1, front.request_id.id);
+    TEST_ASSERT_EQUAL(i, *front.value);
+  }
+  TEST_ASSERT_TRUE(table->empty());
+  TEST_ASSERT_TRUE(TimePoint::max() == table->next_deadline());
+}
+
 }  // namespace ae::test_method_call
 
 int test_method_call() {
   UNITY_BEGIN();
   RUN_TEST(ae::test_method_call::test_ApiMethodInvoke);
+  RUN_TEST(ae::test_method_call::test_UnknownMessageIdDropsPacket);
   RUN_TEST(ae::test_method_call::test_ReturnResult);
   RUN_TEST(ae::test_method_call::test_MethodWithSubApi);
+  RUN_TEST(ae::test_method_call::test_SubContextParsedInPlace);
+  RUN_TEST(ae::test_method_call::test_NestedPackingBigChild);
+  RUN_TEST(ae::test_method_call::test_NestedPackingSizeChange);
+  RUN_TEST(ae::test_method_call::test_PacketStackManyMessages);
   RUN_TEST(ae::test_method_call::test_ProtocolContextStackAccess);
   RUN_TEST(ae::test_method_call::test_PendingResponseCapacityEvictsOldest);
   RUN_TEST(
@@ -426,5 +685,7 @@ int test_method_call() {
   RUN_TEST(ae::test_method_call::test_PendingResponseFifoAfterMiddleRemoval);
   RUN_TEST(ae::test_method_call::
                test_PendingResponseDuplicateReplacementPreservesFifo);
+  RUN_TEST(ae::test_method_call::test_PendingResponseDeadline);
+  RUN_TEST(ae::test_method_call::test_PendingTableManyInFlight);
   return UNITY_END();
 }
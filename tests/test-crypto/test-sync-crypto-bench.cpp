@@ -0,0 +1,104 @@
+/*
+ * Copyright 2026 Aethernet Inc.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <unity.h>
+
+#include <array>
+#include <cstddef>
+#include <utility>
+
+#include "aether/config.h"
+#include "aether/memory.h"
+#include "aether/crypto/key.h"
+#include "aether/crypto/key_gen.h"
+#include "aether/crypto/ikey_provider.h"
+#include "aether/crypto/sync_crypto_provider.h"
+#include "aether/types/data_buffer_pool.h"
+
+#include "tests/benchmarking.h"
+
+#if AE_CRYPTO_SYNC != AE_NONE && defined AE_CRYPTO_BENCH
+namespace ae::test_sync_crypto_bench {
+// bytes encrypted for each message size
+#  if !defined NDEBUG
+static constexpr std::size_t kBenchBytes = 16 * 1024 * 1024;
+#  else
+static constexpr std::size_t kBenchBytes = 256 * 1024 * 1024;
+#  endif
+static constexpr std::array<std::size_t, 7> kMessageSizes{
+    16, 64, 256, 1024, 4096, 16384, 65536};
+
+class TestKeyProvider : public ISyncKeyProvider {
+ public:
+  explicit TestKeyProvider(Key key) : key_{std::move(key)} { nonce_.Init(); }
+
+  Key GetKey() const override { return key_; }
+  CryptoNonce const& Nonce() const override {
+    nonce_.Next();
+    return nonce_;
+  }
+
+ private:
+  Key key_;
+  mutable CryptoNonce nonce_;
+};
+
+void test_EncryptDecryptBench() {
+  Key key;
+  CryptoSyncKeygen(key);
+  auto encrypt = SyncEncryptProvider{make_unique<TestKeyProvider>(key)};
+  auto decrypt = SyncDecryptProvider{make_unique<TestKeyProvider>(key)};
+
+  for (auto size : kMessageSizes) {
+    auto const count = kBenchBytes / size;
+    auto const message = DataBuffer(size, 0x42);
+
+    std::size_t decrypted_size = 0;
+    tests::BenchmarkFunc(
+        [&](auto) {
+          auto encrypted = encrypt.Encrypt(message);
+          auto decrypted = decrypt.Decrypt(encrypted);
+          decrypted_size += decrypted.size();
+          DataBufferPool::Release(std::move(encrypted));
+          DataBufferPool::Release(std::move(decrypted));
+        },
+        count, "Encrypt and decrypt copy of ", size, " bytes");
+    TEST_ASSERT_EQUAL(count * size, decrypted_size);
+
+    decrypted_size = 0;
+    auto data = DataBuffer{};
+    data.reserve(size + encrypt.EncryptOverhead());
+    tests::BenchmarkFunc(
+        [&](auto) {
+          data.assign(std::begin(message), std::end(message));
+          encrypt.EncryptInPlace(data);
+          decrypt.DecryptInPlace(data);
+          decrypted_size += data.size();
+        },
+        count, "Encrypt and decrypt in place ", size, " bytes");
+    TEST_ASSERT_EQUAL(count * size, decrypted_size);
+  }
+}
+}  // namespace ae::test_sync_crypto_bench
+#endif
+
+int test_sync_crypto_bench() {
+  UNITY_BEGIN();
+#if AE_CRYPTO_SYNC != AE_NONE && defined AE_CRYPTO_BENCH
+  RUN_TEST(ae::test_sync_crypto_bench::test_EncryptDecryptBench);
+#endif
+  return UNITY_END();
+}
@@ -0,0 +1,137 @@
+/*
+ * Copyright 2026 Aethernet Inc.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <unity.h>
+
+#include <utility>
+
+#include "aether/config.h"
+#include "aether/memory.h"
+#include "aether/crypto/key.h"
+#include "aether/crypto/key_gen.h"
+#include "aether/crypto/ikey_provider.h"
+#include "aether/crypto/sync_crypto_provider.h"
+
+#if AE_CRYPTO_SYNC != AE_NONE
+namespace ae::test_sync_crypto {
+class TestKeyProvider : public ISyncKeyProvider {
+ public:
+  explicit TestKeyProvider(Key key) : key_{std::move(key)} { nonce_.Init(); }
+
+  Key GetKey() const override { return key_; }
+  CryptoNonce const& Nonce() const override {
+    nonce_.Next();
+    return nonce_;
+  }
+
+ private:
+  Key key_;
+  mutable CryptoNonce nonce_;
+};
+
+struct Providers {
+  Providers() {
+    Key key;
+    CryptoSyncKeygen(key);
+    encrypt = make_unique<SyncEncryptProvider>(
+        make_unique<TestKeyProvider>(key));
+    decrypt = make_unique<SyncDecryptProvider>(
+        make_unique<TestKeyProvider>(key));
+  }
+
+  std::unique_ptr<SyncEncryptProvider> encrypt;
+  std::unique_ptr<SyncDecryptProvider> decrypt;
+};
+
+static DataBuffer MakeData(std::size_t size) {
+  DataBuffer data(size);
+  for (std::size_t i = 0; i < size; ++i) {
+    data[i] = static_cast<std::uint8_t>(i);
+  }
+  return data;
+}
+
+void test_CopyAndInPlaceCompatible() {
+  auto providers = Providers{};
+  auto const message = MakeData(100);
+
+  // encrypted by copy decrypted in place
+  auto encrypted = providers.encrypt->Encrypt(message);
+  TEST_ASSERT_EQUAL(message.size() + providers.encrypt->EncryptOverhead(),
+                    encrypted.size());
+  TEST_ASSERT_TRUE(providers.decrypt->DecryptInPlace(encrypted));
+  TEST_ASSERT_EQUAL(message.size(), encrypted.size());
+  TEST_ASSERT_EQUAL_UINT8_ARRAY(message.data(), encrypted.data(),
+                                message.size());
+
+  // encrypted in place decrypted by copy
+  auto data = message;
+  TEST_ASSERT_TRUE(providers.encrypt->EncryptInPlace(data));
+  TEST_ASSERT_EQUAL(message.size() + providers.encrypt->EncryptOverhead(),
+                    data.size());
+  auto decrypted = providers.decrypt->Decrypt(data);
+  TEST_ASSERT_EQUAL(message.size(), decrypted.size());
+  TEST_ASSERT_EQUAL_UINT8_ARRAY(message.data(), decrypted.data(),
+                                message.size());
+}
+
+void test_InPlaceWithoutReallocation() {
+  auto providers = Providers{};
+  auto const message = MakeData(1000);
+
+  auto data = DataBuffer{};
+  data.reserve(message.size() + providers.encrypt->EncryptOverhead());
+  data.assign(std::begin(message), std::end(message));
+  auto const* memory = data.data();
+
+  TEST_ASSERT_TRUE(providers.encrypt->EncryptInPlace(data));
+#  if AE_CRYPTO_SYNC == AE_CHACHA20_POLY1305
+  TEST_ASSERT_TRUE(memory == data.data());
+#  endif
+  TEST_ASSERT_TRUE(providers.decrypt->DecryptInPlace(data));
+#  if AE_CRYPTO_SYNC == AE_CHACHA20_POLY1305
+  TEST_ASSERT_TRUE(memory == data.data());
+#  endif
+  TEST_ASSERT_EQUAL(message.size(), data.size());
+  TEST_ASSERT_EQUAL_UINT8_ARRAY(message.data(), data.data(), message.size());
+}
+
+void test_DecryptCorrupted() {
+  auto providers = Providers{};
+  auto const message = MakeData(100);
+
+  auto data = message;
+  TEST_ASSERT_TRUE(providers.encrypt->EncryptInPlace(data));
+  data[10] ^= 0xFF;
+  TEST_ASSERT_TRUE(providers.decrypt->Decrypt(data).empty());
+  TEST_ASSERT_FALSE(providers.decrypt->DecryptInPlace(data));
+
+  // too short to be encrypted
+  auto short_data = MakeData(providers.encrypt->EncryptOverhead());
+  TEST_ASSERT_FALSE(providers.decrypt->DecryptInPlace(short_data));
+}
+}  // namespace ae::test_sync_crypto
+#endif
+
+int test_sync_crypto() {
+  UNITY_BEGIN();
+#if AE_CRYPTO_SYNC != AE_NONE
+  RUN_TEST(ae::test_sync_crypto::test_CopyAndInPlaceCompatible);
+  RUN_TEST(ae::test_sync_crypto::test_InPlaceWithoutReallocation);
+  RUN_TEST(ae::test_sync_crypto::test_DecryptCorrupted);
+#endif
+  return UNITY_END();
+}
@@ -20,9 +20,15 @@ void setUp() {}
 void tearDown() {}
 
 extern int test_ds_synchronization();
+extern int test_mmap_domain_storage();
+extern int test_ds_bench();
 
 int main() {
   int res = 0;
   res += test_ds_synchronization();
+  res += test_mmap_domain_storage();
+#if defined AE_DOMAIN_STORAGE_BENCH
+  res += test_ds_bench();
+#endif
   return res;
 }
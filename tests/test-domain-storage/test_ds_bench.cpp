@@ -0,0 +1,117 @@
+/*
+ * Copyright 2026 Aethernet Inc.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <unity.h>
+
+#include <array>
+#include <memory>
+#include <vector>
+#include <cstddef>
+#include <cstdint>
+#include <cstdio>
+
+#include "aether/domain_storage/mmap_domain_storage.h"
+#include "aether/domain_storage/file_system_std_storage.h"
+
+#include "tests/benchmarking.h"
+
+#if defined AE_DOMAIN_STORAGE_BENCH
+namespace ae::test_ds_bench {
+static constexpr std::size_t kRepeatCount = 5;
+static constexpr std::array<std::size_t, 2> kObjectCounts{1'000, 5'000};
+// each object is stored as a few classes like Obj - Base - Derived
+static constexpr std::array<std::uint32_t, 3> kClasses{100, 200, 300};
+static constexpr std::size_t kDataSize = 128;
+
+void SaveObjects(IDomainStorage& storage, std::size_t object_count) {
+  auto data = std::vector<std::uint8_t>(kDataSize, 42);
+  for (std::size_t i = 0; i < object_count; ++i) {
+    for (auto class_id : kClasses) {
+      auto writer = storage.Store(
+          {ObjId{static_cast<ObjId::Type>(i + 1)}, class_id, 0});
+      writer->write(data.data(), data.size());
+    }
+  }
+}
+
+// loads every object as Domain does
+std::size_t LoadObjects(IDomainStorage& storage, std::size_t object_count) {
+  auto data = std::vector<std::uint8_t>(kDataSize);
+  std::size_t loaded = 0;
+  for (std::size_t i = 0; i < object_count; ++i) {
+    auto id = ObjId{static_cast<ObjId::Type>(i + 1)};
+    for (auto class_id : storage.Enumerate(id)) {
+      auto load = storage.Load({id, class_id, 0});
+      if (load.result != DomainLoadResult::kLoaded) {
+        continue;
+      }
+      load.reader->read(data.data(), data.size());
+      ++loaded;
+    }
+  }
+  return loaded;
+}
+
+template <typename TStorageFactory>
+void BenchStorage(TStorageFactory&& storage_factory, char const* name) {
+  for (auto object_count : kObjectCounts) {
+    auto storage = storage_factory();
+    storage->CleanUp();
+    tests::BenchmarkFunc(
+        [&](auto) { SaveObjects(*storage, object_count); }, kRepeatCount,
+        name, " save ", object_count, " objects");
+    storage.reset();
+
+    std::size_t loaded = 0;
+    tests::BenchmarkFunc(
+        [&](auto) {
+          // startup opens the storage and loads all the objects
+          auto startup_storage = storage_factory();
+          loaded = LoadObjects(*startup_storage, object_count);
+        },
+        kRepeatCount, name, " startup with ", object_count, " objects");
+    TEST_ASSERT_EQUAL(object_count * kClasses.size(), loaded);
+
+    storage_factory()->CleanUp();
+  }
+}
+
+void test_FileSystemStdStorageBench() {
+#  if defined AE_FILE_SYSTEM_STD_ENABLED
+  BenchStorage([]() { return std::make_unique<FileSystemStdStorage>(); },
+               "FileSystemStdStorage");
+#  endif
+}
+
+void test_MmapDomainStorageBench() {
+#  if defined AE_MMAP_DOMAIN_STORAGE_ENABLED
+  static constexpr char kPath[] = "test_ds_bench.aedb";
+  BenchStorage([]() { return std::make_unique<MmapDomainStorage>(kPath); },
+               "MmapDomainStorage");
+  std::remove(kPath);
+#  endif
+}
+}  // namespace ae::test_ds_bench
+#endif
+
+int test_ds_bench() {
+  UNITY_BEGIN();
+#if defined AE_DOMAIN_STORAGE_BENCH
+  RUN_TEST(ae::test_ds_bench::test_FileSystemStdStorageBench);
+  RUN_TEST(ae::test_ds_bench::test_MmapDomainStorageBench);
+#endif
+  return UNITY_END();
+}
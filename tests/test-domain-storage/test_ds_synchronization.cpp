@@ -17,6 +17,7 @@
 #include <unity.h>
 
 #include <array>
+#include <cstdio>
 #include <cstdint>
 #include <iostream>
 
@@ -25,6 +26,7 @@
 
 // IWYU pragma: begin_exports
 #include "aether/domain_storage/file_system_std_storage.h"
+#include "aether/domain_storage/mmap_domain_storage.h"
 #include "aether/domain_storage/ram_domain_storage.h"
 #include "aether/domain_storage/spifs_domain_storage.h"
 #include "aether/domain_storage/static_domain_storage.h"
@@ -160,6 +162,18 @@ void test_SyncWithFSStorage() {
   TestSyncDataStorage(std::move(static_storage), std::move(fs_storage));
 }
 
+#if defined AE_MMAP_DOMAIN_STORAGE_ENABLED
+static constexpr char kMmapPath[] = "test_ds_synchronization.aedb";
+
+void test_SyncWithMmapStorage() {
+  auto static_storage = make_unique<StaticDomainStorage>(static_data);
+  auto mmap_storage = make_unique<MmapDomainStorage>(kMmapPath);
+  mmap_storage->CleanUp();
+  TestSyncDataStorage(std::move(static_storage), std::move(mmap_storage));
+  std::remove(kMmapPath);
+}
+#endif
+
 }  // namespace ae::test_ds_synchronization
 
 int test_ds_synchronization() {
@@ -169,5 +183,8 @@ int test_ds_synchronization() {
   UNITY_BEGIN();
   RUN_TEST(ae::test_ds_synchronization::test_SyncWithRamStorage);
   RUN_TEST(ae::test_ds_synchronization::test_SyncWithFSStorage);
+#if defined AE_MMAP_DOMAIN_STORAGE_ENABLED
+  RUN_TEST(ae::test_ds_synchronization::test_SyncWithMmapStorage);
+#endif
   return UNITY_END();
 }
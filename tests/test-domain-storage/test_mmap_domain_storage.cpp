@@ -0,0 +1,213 @@
+/*
+ * Copyright 2026 Aethernet Inc.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <unity.h>
+
+#include <vector>
+#include <cstdio>
+#include <cstdint>
+#include <fstream>
+
+#include "aether/domain_storage/mmap_domain_storage.h"
+
+#if defined AE_MMAP_DOMAIN_STORAGE_ENABLED
+namespace ae::test_mmap_domain_storage {
+static constexpr char kPath[] = "test_mmap_storage.aedb";
+
+void Save(IDomainStorage& storage, DomainQuery const& query,
+          std::vector<std::uint8_t> const& data) {
+  auto writer = storage.Store(query);
+  writer->write(data.data(), data.size());
+}
+
+std::vector<std::uint8_t> Read(IDomainStorage& storage,
+                               DomainQuery const& query, std::size_t size) {
+  auto load = storage.Load(query);
+  TEST_ASSERT(load.result == DomainLoadResult::kLoaded);
+  std::vector<std::uint8_t> data(size);
+  load.reader->read(data.data(), data.size());
+  return data;
+}
+
+void test_StoreLoadReopen() {
+  std::remove(kPath);
+  auto const data_1 = std::vector<std::uint8_t>{1, 2, 3, 4};
+  auto const data_2 = std::vector<std::uint8_t>{5, 6, 7};
+  auto const data_3 = std::vector<std::uint8_t>{8, 9};
+  {
+    auto storage = MmapDomainStorage{kPath};
+    Save(storage, {ObjId{1}, 100, 0}, data_1);
+    Save(storage, {ObjId{1}, 101, 0}, data_2);
+    Save(storage, {ObjId{1}, 101, 1}, data_2);
+    Save(storage, {ObjId{2}, 200, 0}, data_1);
+    // overwrite
+    Save(storage, {ObjId{1}, 100, 0}, data_3);
+    storage.Remove(ObjId{2});
+    storage.Remove(ObjId{3});
+
+    TEST_ASSERT_EQUAL_UINT8_ARRAY(
+        data_3.data(), Read(storage, {ObjId{1}, 100, 0}, 2).data(), 2);
+  }
+  auto storage = MmapDomainStorage{kPath};
+  auto classes = storage.Enumerate(ObjId{1});
+  TEST_ASSERT_EQUAL(2, classes.size());
+  TEST_ASSERT_EQUAL(100, classes[0]);
+  TEST_ASSERT_EQUAL(101, classes[1]);
+  TEST_ASSERT_EQUAL_UINT8_ARRAY(
+      data_3.data(), Read(storage, {ObjId{1}, 100, 0}, 2).data(), 2);
+  TEST_ASSERT_EQUAL_UINT8_ARRAY(
+      data_2.data(), Read(storage, {ObjId{1}, 101, 1}, 3).data(), 3);
+  TEST_ASSERT(storage.Load({ObjId{1}, 100, 1}).result ==
+              DomainLoadResult::kEmpty);
+  TEST_ASSERT(storage.Load({ObjId{2}, 200, 0}).result ==
+              DomainLoadResult::kRemoved);
+  TEST_ASSERT(storage.Load({ObjId{3}, 300, 0}).result ==
+              DomainLoadResult::kRemoved);
+  TEST_ASSERT(storage.Load({ObjId{4}, 400, 0}).result ==
+              DomainLoadResult::kEmpty);
+  TEST_ASSERT(storage.Enumerate(ObjId{2}).empty());
+
+  // store again after remove
+  Save(storage, {ObjId{2}, 201, 0}, data_2);
+  TEST_ASSERT(storage.Load({ObjId{2}, 200, 0}).result ==
+              DomainLoadResult::kEmpty);
+  TEST_ASSERT_EQUAL_UINT8_ARRAY(
+      data_2.data(), Read(storage, {ObjId{2}, 201, 0}, 3).data(), 3);
+
+  storage.CleanUp();
+  TEST_ASSERT(storage.Enumerate(ObjId{1}).empty());
+  TEST_ASSERT(storage.Load({ObjId{2}, 201, 0}).result ==
+              DomainLoadResult::kEmpty);
+  std::remove(kPath);
+}
+
+void test_BrokenTail() {
+  std::remove(kPath);
+  auto const data = std::vector<std::uint8_t>{1, 2, 3, 4};
+  {
+    auto storage = MmapDomainStorage{kPath};
+    Save(storage, {ObjId{1}, 100, 0}, data);
+    Save(storage, {ObjId{2}, 200, 0}, data);
+  }
+  // write a part of the record as if the app was interrupted
+  {
+    auto file = std::ofstream{kPath, std::ios::binary | std::ios::app};
+    file.write("\xEC\x0B\x5D\xAE\x03\x00", 6);
+  }
+  {
+    auto storage = MmapDomainStorage{kPath};
+    TEST_ASSERT_EQUAL_UINT8_ARRAY(
+        data.data(), Read(storage, {ObjId{2}, 200, 0}, 4).data(), 4);
+    Save(storage, {ObjId{3}, 300, 0}, data);
+  }
+  auto storage = MmapDomainStorage{kPath};
+  TEST_ASSERT_EQUAL_UINT8_ARRAY(
+      data.data(), Read(storage, {ObjId{1}, 100, 0}, 4).data(), 4);
+  TEST_ASSERT_EQUAL_UINT8_ARRAY(
+      data.data(), Read(storage, {ObjId{3}, 300, 0}, 4).data(), 4);
+  std::remove(kPath);
+}
+
+void test_Compaction() {
+  std::remove(kPath);
+  auto const data = std::vector<std::uint8_t>(1024, 42);
+  auto const last = std::vector<std::uint8_t>(1024, 43);
+  auto storage = MmapDomainStorage{kPath};
+  Save(storage, {ObjId{1}, 100, 0}, data);
+  storage.Remove(ObjId{2});
+
+  // a hundred overwrites are enough to compact the file
+  for (int i = 0; i < 100; ++i) {
+    Save(storage, {ObjId{3}, 300, 0}, data);
+  }
+  TEST_ASSERT_LESS_THAN(MmapDomainStorage::kCompactionThreshold,
+                        storage.file_size());
+
+  // compaction is postponed while reader is alive
+  Save(storage, {ObjId{3}, 300, 0}, last);
+  auto load = storage.Load({ObjId{1}, 100, 0});
+  TEST_ASSERT(load.result == DomainLoadResult::kLoaded);
+  auto size_before = storage.file_size();
+  storage.Compact();
+  TEST_ASSERT_EQUAL(size_before, storage.file_size());
+  Save(storage, {ObjId{4}, 400, 0}, data);
+  auto read = std::vector<std::uint8_t>(data.size());
+  load.reader->read(read.data(), read.size());
+  TEST_ASSERT_EQUAL_UINT8_ARRAY(data.data(), read.data(), data.size());
+  load.reader.reset();
+  TEST_ASSERT_EQUAL(0, storage.stale_size());
+  TEST_ASSERT_LESS_THAN(size_before, storage.file_size());
+
+  TEST_ASSERT_EQUAL_UINT8_ARRAY(
+      last.data(), Read(storage, {ObjId{3}, 300, 0}, 1024).data(), 1024);
+  TEST_ASSERT(storage.Load({ObjId{2}, 200, 0}).result ==
+              DomainLoadResult::kRemoved);
+
+  // compacted file is read back after reopen
+  auto reopened = MmapDomainStorage{kPath};
+  TEST_ASSERT_EQUAL_UINT8_ARRAY(
+      data.data(), Read(reopened, {ObjId{4}, 400, 0}, 1024).data(), 1024);
+  TEST_ASSERT(reopened.Load({ObjId{2}, 200, 0}).result ==
+              DomainLoadResult::kRemoved);
+  std::remove(kPath);
+}
+
+void test_CleanUpWithReader() {
+  std::remove(kPath);
+  auto const data = std::vector<std::uint8_t>{1, 2, 3, 4};
+  auto storage = MmapDomainStorage{kPath};
+  Save(storage, {ObjId{1}, 100, 0}, data);
+  auto load = storage.Load({ObjId{1}, 100, 0});
+  TEST_ASSERT(load.result == DomainLoadResult::kLoaded);
+
+  storage.CleanUp();
+  TEST_ASSERT(storage.Load({ObjId{1}, 100, 0}).result ==
+              DomainLoadResult::kEmpty);
+  Save(storage, {ObjId{2}, 200, 0}, data);
+
+  // the reader still reads the data loaded before clean up
+  auto read = std::vector<std::uint8_t>(data.size());
+  load.reader->read(read.data(), read.size());
+  TEST_ASSERT(load.reader->result() == ReadResult::kYes);
+  TEST_ASSERT_EQUAL_UINT8_ARRAY(data.data(), read.data(), data.size());
+  // read out of the record fails
+  auto tail = std::vector<std::uint8_t>(2, 0xFF);
+  load.reader->read(tail.data(), tail.size());
+  TEST_ASSERT(load.reader->result() == ReadResult::kNo);
+  auto const zeros = std::vector<std::uint8_t>(tail.size(), 0);
+  TEST_ASSERT_EQUAL_UINT8_ARRAY(zeros.data(), tail.data(), tail.size());
+  load.reader.reset();
+
+  auto reopened = MmapDomainStorage{kPath};
+  TEST_ASSERT(reopened.Load({ObjId{1}, 100, 0}).result ==
+              DomainLoadResult::kEmpty);
+  TEST_ASSERT_EQUAL_UINT8_ARRAY(
+      data.data(), Read(reopened, {ObjId{2}, 200, 0}, 4).data(), 4);
+  std::remove(kPath);
+}
+}  // namespace ae::test_mmap_domain_storage
+#endif
+
+int test_mmap_domain_storage() {
+  UNITY_BEGIN();
+#if defined AE_MMAP_DOMAIN_STORAGE_ENABLED
+  RUN_TEST(ae::test_mmap_domain_storage::test_StoreLoadReopen);
+  RUN_TEST(ae::test_mmap_domain_storage::test_BrokenTail);
+  RUN_TEST(ae::test_mmap_domain_storage::test_Compaction);
+  RUN_TEST(ae::test_mmap_domain_storage::test_CleanUpWithReader);
+#endif
+  return UNITY_END();
+}
@@ -21,10 +21,14 @@ void tearDown() {}
 
 extern int test_events();
 extern int test_events_mt();
+extern int test_events_bench();
 
 int main() {
   auto res = 0;
   res += test_events();
   res += test_events_mt();
+#if defined AE_EVENTS_BENCH
+  res += test_events_bench();
+#endif
   return res;
 }
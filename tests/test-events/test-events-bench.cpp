@@ -0,0 +1,119 @@
+/*
+ * Copyright 2026 Aethernet Inc.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <unity.h>
+
+#include <array>
+#include <vector>
+#include <cstddef>
+
+#include "aether/events/events.h"
+
+#include "tests/benchmarking.h"
+
+#if defined AE_EVENTS_BENCH
+namespace ae::test_events_bench {
+static constexpr std::size_t kEmitCount = 1'000'000;
+static constexpr std::size_t kSubscribeCount = 100'000;
+
+void BenchEmit(EventSyncPolicy sync_policy, char const* name,
+               std::size_t subscribers) {
+  Event<void(int)> event{sync_policy};
+  int sum = 0;
+  auto subs = std::vector<Subscription>{};
+  for (std::size_t i = 0; i < subscribers; ++i) {
+    subs.emplace_back(
+        EventSubscriber{event}.Subscribe([&](int x) { sum += x; }));
+  }
+
+  tests::BenchmarkFunc([&](auto) { event.Emit(1); }, kEmitCount, "emit ",
+                       name, " event to ", subscribers, " subscribers");
+  TEST_ASSERT_EQUAL(kEmitCount * subscribers, static_cast<std::size_t>(sum));
+}
+
+void BenchSubscribe(EventSyncPolicy sync_policy, char const* name) {
+  Event<void(int)> event{sync_policy};
+  int sum = 0;
+  // a few long living subscriptions
+  auto subs = std::vector<Subscription>{};
+  for (std::size_t i = 0; i < 4; ++i) {
+    subs.emplace_back(
+        EventSubscriber{event}.Subscribe([&](int x) { sum += x; }));
+  }
+
+  tests::BenchmarkFunc(
+      [&](auto i) {
+        auto sub = Subscription{
+            EventSubscriber{event}.Subscribe([&](int x) { sum += x; })};
+        if ((i % 8) == 0) {
+          event.Emit(1);
+        }
+      },
+      kSubscribeCount, "subscribe, unsubscribe ", name, " event");
+  TEST_ASSERT_GREATER_THAN(0, sum);
+}
+
+void BenchCreate(EventSyncPolicy sync_policy, char const* name,
+                 std::size_t subscribers) {
+  int sum = 0;
+  auto handler = [&](int x) { sum += x; };
+  tests::BenchmarkFunc(
+      [&](auto) {
+        Event<void(int)> event{sync_policy};
+        std::array<Subscription, 2> subs;
+        for (std::size_t i = 0; i < subscribers; ++i) {
+          subs[i] = EventSubscriber{event}.Subscribe(handler);
+        }
+        event.Emit(1);
+      },
+      kSubscribeCount, "create ", name, " event with ", subscribers,
+      " subscribers");
+  TEST_ASSERT_EQUAL(kSubscribeCount * subscribers,
+                    static_cast<std::size_t>(sum));
+}
+
+void test_EmitBench() {
+  BenchEmit(EventSyncPolicy::kMutex, "mutex", 1);
+  BenchEmit(EventSyncPolicy::kSingleThread, "single thread", 1);
+  BenchEmit(EventSyncPolicy::kMutex, "mutex", 16);
+  BenchEmit(EventSyncPolicy::kSingleThread, "single thread", 16);
+}
+
+void test_CreateBench() {
+  BenchCreate(EventSyncPolicy::kMutex, "mutex", 0);
+  BenchCreate(EventSyncPolicy::kSingleThread, "single thread", 0);
+  BenchCreate(EventSyncPolicy::kMutex, "mutex", 1);
+  BenchCreate(EventSyncPolicy::kSingleThread, "single thread", 1);
+  BenchCreate(EventSyncPolicy::kMutex, "mutex", 2);
+  BenchCreate(EventSyncPolicy::kSingleThread, "single thread", 2);
+}
+
+void test_SubscribeBench() {
+  BenchSubscribe(EventSyncPolicy::kMutex, "mutex");
+  BenchSubscribe(EventSyncPolicy::kSingleThread, "single thread");
+}
+}  // namespace ae::test_events_bench
+#endif
+
+int test_events_bench() {
+  UNITY_BEGIN();
+#if defined AE_EVENTS_BENCH
+  RUN_TEST(ae::test_events_bench::test_EmitBench);
+  RUN_TEST(ae::test_events_bench::test_SubscribeBench);
+  RUN_TEST(ae::test_events_bench::test_CreateBench);
+#endif
+  return UNITY_END();
+}
@@ -16,6 +16,9 @@
 
 #include <unity.h>
 
+#include <memory>
+#include <vector>
+
 #include "aether/events/events.h"
 #include "aether/events/multi_subscription.h"
 
@@ -210,6 +213,118 @@ void test_EventReSubscribeOnHandler() {
   event.Emit(2);
   TEST_ASSERT(cb_called_second);
 }
+
+void test_SingleThreadEvent() {
+  Event<void(int)> event{EventSyncPolicy::kSingleThread};
+  int sum = 0;
+  auto s1 = Subscription{
+      EventSubscriber{event}.Subscribe([&](int x) { sum += x; })};
+  auto s2 = Subscription{};
+  // subscribe and unsubscribe while emit
+  auto s3 = Subscription{EventSubscriber{event}.Subscribe([&](int) {
+    s1.Reset();
+    if (!s2) {
+      s2 = EventSubscriber{event}.Subscribe([&](int y) { sum += 10 * y; });
+    }
+  })};
+
+  event.Emit(1);
+  TEST_ASSERT_EQUAL(1, sum);
+  event.Emit(2);
+  TEST_ASSERT_EQUAL(21, sum);
+  TEST_ASSERT_FALSE(s1);
+  TEST_ASSERT_TRUE(s2);
+}
+
+void test_RemovedIndexNotReused() {
+  Event<void(int)> event;
+  int first = 0;
+  int second = 0;
+  auto deleter = EventSubscriber{event}.Subscribe([&](int) { first++; });
+  deleter.Delete();
+  TEST_ASSERT_FALSE(deleter.alive());
+
+  // new handler takes the freed slot
+  auto s = Subscription{EventSubscriber{event}.Subscribe([&](int) {
+    second++;
+  })};
+  // the old deleter must not remove it
+  deleter.Delete();
+  TEST_ASSERT_FALSE(deleter.alive());
+  TEST_ASSERT_TRUE(s);
+
+  event.Emit(1);
+  TEST_ASSERT_EQUAL(0, first);
+  TEST_ASSERT_EQUAL(1, second);
+}
+
+void test_ManySubscriptions() {
+  static constexpr int kCount = 1000;
+  Event<void(int)> event;
+  int sum = 0;
+  std::vector<Subscription> subs;
+  for (int i = 0; i < kCount; ++i) {
+    subs.emplace_back(EventSubscriber{event}.Subscribe([&](int x) {
+      sum += x;
+    }));
+  }
+  // remove every other
+  for (int i = 0; i < kCount; i += 2) {
+    subs[static_cast<std::size_t>(i)].Reset();
+  }
+  event.Emit(1);
+  TEST_ASSERT_EQUAL(kCount / 2, sum);
+
+  // refill the removed
+  for (int i = 0; i < kCount; i += 2) {
+    subs[static_cast<std::size_t>(i)] =
+        EventSubscriber{event}.Subscribe([&](int x) { sum += x; });
+  }
+  sum = 0;
+  event.Emit(1);
+  TEST_ASSERT_EQUAL(kCount, sum);
+}
+
+void test_EventDestroyedInHandler() {
+  for (auto policy :
+       {EventSyncPolicy::kMutex, EventSyncPolicy::kSingleThread}) {
+    auto event = std::make_unique<Event<void(int)>>(policy);
+    int called = 0;
+    auto s1 = Subscription{EventSubscriber{*event}.Subscribe([&](int) {
+      called++;
+      event.reset();
+    })};
+    auto s2 =
+        Subscription{EventSubscriber{*event}.Subscribe([&](int) { called++; })};
+    event->Emit(1);
+    TEST_ASSERT_NULL(event.get());
+    TEST_ASSERT_EQUAL(2, called);
+    TEST_ASSERT_FALSE(s1);
+    TEST_ASSERT_FALSE(s2);
+  }
+}
+
+void test_SingleThreadEventNoSubscribers() {
+  Event<void(int)> event{EventSyncPolicy::kSingleThread};
+  // no handlers list yet
+  event.Emit(1);
+
+  int sum = 0;
+  {
+    auto s = Subscription{
+        EventSubscriber{event}.Subscribe([&](int x) { sum += x; })};
+    event.Emit(1);
+  }
+  event.Emit(1);
+  TEST_ASSERT_EQUAL(1, sum);
+
+  // moved from event is empty
+  auto moved = std::move(event);
+  auto s = Subscription{
+      EventSubscriber{moved}.Subscribe([&](int x) { sum += x; })};
+  moved.Emit(2);
+  TEST_ASSERT_EQUAL(3, sum);
+}
 }  // namespace ae::test_events
 
 int test_events() {
@@ -221,5 +336,10 @@ int test_events() {
   RUN_TEST(ae::test_events::test_MultiSubscription);
   RUN_TEST(ae::test_events::test_EventRecursionCall);
   RUN_TEST(ae::test_events::test_EventReSubscribeOnHandler);
+  RUN_TEST(ae::test_events::test_SingleThreadEvent);
+  RUN_TEST(ae::test_events::test_RemovedIndexNotReused);
+  RUN_TEST(ae::test_events::test_ManySubscriptions);
+  RUN_TEST(ae::test_events::test_EventDestroyedInHandler);
+  RUN_TEST(ae::test_events::test_SingleThreadEventNoSubscribers);
   return UNITY_END();
 }
@@ -22,11 +22,15 @@ void tearDown() {}
 extern int run_test_object_create();
 extern int run_test_update_objects();
 extern int run_test_version_iterator();
+extern int test_domain_load_bench();
 
 int main() {
   int res{};
   res += run_test_object_create();
   res += run_test_version_iterator();
   res += run_test_update_objects();
+#if defined AE_DOMAIN_LOAD_BENCH
+  res += test_domain_load_bench();
+#endif
   return res;
 }
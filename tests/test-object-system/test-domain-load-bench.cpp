@@ -0,0 +1,162 @@
+/*
+ * Copyright 2026 Aethernet Inc.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <unity.h>
+
+#include <array>
+#include <vector>
+#include <cstddef>
+#include <cstdint>
+
+#include "aether/obj/obj.h"
+#include "aether/obj/domain.h"
+#include "aether/obj/obj_ptr.h"
+
+#include "map_domain_storage.h"
+
+#include "tests/benchmarking.h"
+
+#if defined AE_DOMAIN_LOAD_BENCH
+namespace ae::test_domain_load_bench {
+static constexpr std::size_t kLoadCount = 10;
+static constexpr std::array<std::size_t, 3> kClientCounts{100, 1'000, 5'000};
+// each client cloud refers to a few servers shared with other clients
+static constexpr std::size_t kCloudSize = 3;
+
+// Aether like graph: aether - clients - cloud - servers
+class BenchServerBase : public Obj {
+  AE_OBJECT(BenchServerBase, Obj, 0)
+
+ protected:
+  BenchServerBase() = default;
+
+ public:
+  explicit BenchServerBase(ObjProp prop) : Obj{prop} {}
+
+  AE_OBJECT_REFLECT(AE_MMBR(server_id))
+
+  std::uint32_t server_id{};
+};
+
+class BenchServer : public BenchServerBase {
+  AE_OBJECT(BenchServer, BenchServerBase, 0)
+
+  BenchServer() = default;
+
+ public:
+  explicit BenchServer(ObjProp prop) : BenchServerBase{prop} {}
+
+  AE_OBJECT_REFLECT(AE_MMBR(endpoints))
+
+  std::vector<std::uint32_t> endpoints;
+};
+
+class BenchCloud : public Obj {
+  AE_OBJECT(BenchCloud, Obj, 0)
+
+  BenchCloud() = default;
+
+ public:
+  explicit BenchCloud(ObjProp prop) : Obj{prop} {}
+
+  AE_OBJECT_REFLECT(AE_MMBR(servers))
+
+  std::vector<BenchServer::ptr> servers;
+};
+
+class BenchClient : public Obj {
+  AE_OBJECT(BenchClient, Obj, 0)
+
+  BenchClient() = default;
+
+ public:
+  explicit BenchClient(ObjProp prop)
+      : Obj{prop}, cloud{BenchCloud::ptr::Create(domain)} {}
+
+  AE_OBJECT_REFLECT(AE_MMBR(uid), AE_MMBR(cloud))
+
+  std::uint64_t uid{};
+  BenchCloud::ptr cloud;
+};
+
+class BenchAether : public Obj {
+  AE_OBJECT(BenchAether, Obj, 0)
+
+  BenchAether() = default;
+
+ public:
+  explicit BenchAether(ObjProp prop) : Obj{prop} {}
+
+  AE_OBJECT_REFLECT(AE_MMBR(clients), AE_MMBR(servers))
+
+  std::vector<BenchClient::ptr> clients;
+  std::vector<BenchServer::ptr> servers;
+};
+
+void SaveAether(MapDomainStorage& facility, std::size_t client_count) {
+  Domain domain{ae::Now(), facility};
+  auto aether = BenchAether::ptr::Create(CreateWith{domain}.with_id(1));
+  auto server_count = client_count / 2;
+  for (std::size_t i = 0; i < server_count; ++i) {
+    auto server = BenchServer::ptr::Create(domain);
+    server->server_id = static_cast<std::uint32_t>(i);
+    server->endpoints = {1, 2, 3};
+    aether->servers.push_back(std::move(server));
+  }
+  for (std::size_t i = 0; i < client_count; ++i) {
+    auto client = BenchClient::ptr::Create(domain);
+    client->uid = i;
+    for (std::size_t s = 0; s < kCloudSize; ++s) {
+      client->cloud->servers.push_back(
+          aether->servers[(i + s) % server_count]);
+    }
+    aether->clients.push_back(std::move(client));
+  }
+
+  tests::BenchmarkFunc([&](auto) { aether.Save(); }, kLoadCount,
+                       "save aether with ", client_count, " clients and ",
+                       server_count, " servers");
+}
+
+void test_LoadAetherBench() {
+  for (auto client_count : kClientCounts) {
+    auto facility = MapDomainStorage{};
+    SaveAether(facility, client_count);
+
+    std::size_t loaded_clients = 0;
+    tests::BenchmarkFunc(
+        [&](auto) {
+          Domain domain{ae::Now(), facility};
+          auto aether =
+              BenchAether::ptr::Declare(CreateWith{domain}.with_id(1));
+          aether.Load();
+          loaded_clients = aether->clients.size();
+        },
+        kLoadCount, "load aether with ", client_count, " clients and ",
+        client_count / 2, " servers");
+    TEST_ASSERT_EQUAL(client_count, loaded_clients);
+  }
+}
+}  // namespace ae::test_domain_load_bench
+#endif
+
+int test_domain_load_bench() {
+  UNITY_BEGIN();
+#if defined AE_DOMAIN_LOAD_BENCH
+  RUN_TEST(ae::test_domain_load_bench::test_LoadAetherBench);
+#endif
+  return UNITY_END();
+}
@@ -0,0 +1,139 @@
+/*
+ * Copyright 2026 Aethernet Inc.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "tests/test-poller/loopback_echo.h"
+
+#include <fcntl.h>
+#include <unistd.h>
+#include <arpa/inet.h>
+#include <netinet/in.h>
+#include <netinet/tcp.h>
+#include <sys/socket.h>
+
+#include <vector>
+#include <cstring>
+#include <utility>
+
+namespace ae::test_poller {
+namespace {
+sockaddr_in LoopbackAddr() {
+  sockaddr_in addr{};
+  addr.sin_family = AF_INET;
+  addr.sin_addr.s_addr = htonl(INADDR_LOOPBACK);
+  addr.sin_port = 0;
+  return addr;
+}
+
+sockaddr_in BoundAddr(int fd) {
+  sockaddr_in addr{};
+  socklen_t len = sizeof(addr);
+  getsockname(fd, reinterpret_cast<sockaddr*>(&addr), &len);
+  return addr;
+}
+
+void SetNonBlocking(int fd) {
+  auto flags = fcntl(fd, F_GETFL, 0);
+  fcntl(fd, F_SETFL, flags | O_NONBLOCK);
+}
+}  // namespace
+
+SocketPair::SocketPair(SocketPair&& other) noexcept
+    : server{std::exchange(other.server, -1)},
+      client{std::exchange(other.client, -1)} {}
+
+SocketPair::~SocketPair() {
+  if (server != -1) {
+    close(server);
+  }
+  if (client != -1) {
+    close(client);
+  }
+}
+
+SocketPair MakeTcpPair() {
+  SocketPair pair;
+  auto listener = socket(AF_INET, SOCK_STREAM, 0);
+  auto addr = LoopbackAddr();
+  bind(listener, reinterpret_cast<sockaddr*>(&addr), sizeof(addr));
+  listen(listener, 1);
+  addr = BoundAddr(listener);
+
+  pair.client = socket(AF_INET, SOCK_STREAM, 0);
+  connect(pair.client, reinterpret_cast<sockaddr*>(&addr), sizeof(addr));
+  pair.server = accept(listener, nullptr, nullptr);
+  close(listener);
+
+  int one = 1;
+  setsockopt(pair.client, IPPROTO_TCP, TCP_NODELAY, &one, sizeof(one));
+  setsockopt(pair.server, IPPROTO_TCP, TCP_NODELAY, &one, sizeof(one));
+  SetNonBlocking(pair.server);
+  return pair;
+}
+
+SocketPair MakeUdpPair() {
+  SocketPair pair;
+  pair.server = socket(AF_INET, SOCK_DGRAM, 0);
+  pair.client = socket(AF_INET, SOCK_DGRAM, 0);
+  auto addr = LoopbackAddr();
+  bind(pair.server, reinterpret_cast<sockaddr*>(&addr), sizeof(addr));
+  bind(pair.client, reinterpret_cast<sockaddr*>(&addr), sizeof(addr));
+  auto server_addr = BoundAddr(pair.server);
+  auto client_addr = BoundAddr(pair.client);
+  connect(pair.server, reinterpret_cast<sockaddr*>(&client_addr),
+          sizeof(client_addr));
+  connect(pair.client, reinterpret_cast<sockaddr*>(&server_addr),
+          sizeof(server_addr));
+  SetNonBlocking(pair.server);
+  return pair;
+}
+
+EchoServer::EchoServer(std::shared_ptr<NativePoller> const& poller, int fd)
+    : polled_fd_{fd, poller, MethodPtr<&EchoServer::OnEvent>{this}},
+      buffer_{} {
+  polled_fd_.Events(EventType::kRead | EventType::kError);
+}
+
+void EchoServer::OnEvent(DescriptorType fd, EventType event) {
+  if ((event & EventType::kRead) == 0) {
+    return;
+  }
+  // read all available data
+  while (true) {
+    auto res = recv(fd, buffer_.data(), buffer_.size(), 0);
+    if (res <= 0) {
+      return;
+    }
+    send(fd, buffer_.data(), static_cast<std::size_t>(res), MSG_NOSIGNAL);
+  }
+}
+
+bool PingPong(int client, std::uint8_t const* message, std::size_t size) {
+  if (send(client, message, size, MSG_NOSIGNAL) !=
+      static_cast<ssize_t>(size)) {
+    return false;
+  }
+  std::vector<std::uint8_t> echo(size);
+  std::size_t received = 0;
+  while (received < size) {
+    auto res = recv(client, echo.data() + received, size - received, 0);
+    if (res <= 0) {
+      return false;
+    }
+    received += static_cast<std::size_t>(res);
+  }
+  return std::memcmp(echo.data(), message, size) == 0;
+}
+}  // namespace ae::test_poller
@@ -0,0 +1,66 @@
+/*
+ * Copyright 2026 Aethernet Inc.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef TESTS_TEST_POLLER_LOOPBACK_ECHO_H_
+#define TESTS_TEST_POLLER_LOOPBACK_ECHO_H_
+
+#include <array>
+#include <memory>
+#include <cstddef>
+#include <cstdint>
+
+#include "aether/poller/poller.h"
+#include "aether/poller/unix_poller.h"
+
+namespace ae::test_poller {
+/**
+ * \brief Pair of connected loopback sockets.
+ * server is non blocking and served by poller, client is blocking.
+ */
+struct SocketPair {
+  SocketPair() = default;
+  SocketPair(SocketPair&& other) noexcept;
+  ~SocketPair();
+
+  int server = -1;
+  int client = -1;
+};
+
+SocketPair MakeTcpPair();
+SocketPair MakeUdpPair();
+
+/**
+ * \brief Sends back everything received on the polled socket.
+ */
+class EchoServer {
+ public:
+  EchoServer(std::shared_ptr<NativePoller> const& poller, int fd);
+
+ private:
+  void OnEvent(DescriptorType fd, EventType event);
+
+  UnixPolledFd polled_fd_;
+  std::array<std::uint8_t, 1500> buffer_;
+};
+
+/**
+ * \brief Send message from the client and wait for the echo.
+ * \return true if echo is the same as the message.
+ */
+bool PingPong(int client, std::uint8_t const* message, std::size_t size);
+}  // namespace ae::test_poller
+
+#endif  // TESTS_TEST_POLLER_LOOPBACK_ECHO_H_
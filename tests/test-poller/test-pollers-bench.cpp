@@ -0,0 +1,122 @@
+/*
+ * Copyright 2026 Aethernet Inc.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <unity.h>
+
+#include <array>
+#include <memory>
+#include <vector>
+#include <cstdint>
+#include <string_view>
+
+#include <sys/socket.h>
+
+#include "aether/poller/epoll_poller.h"
+#include "aether/poller/io_uring_poller.h"
+
+#include "tests/benchmarking.h"
+#include "tests/test-poller/loopback_echo.h"
+
+namespace ae::test_pollers_bench {
+using test_poller::EchoServer;
+using test_poller::PingPong;
+using test_poller::SocketPair;
+
+#if !defined NDEBUG
+static constexpr std::size_t kBenchCount = 20'000;
+#else
+static constexpr std::size_t kBenchCount = 200'000;
+#endif
+static constexpr std::size_t kFanOutConnections = 256;
+
+template <typename TPollerImpl>
+void PingPongBench(SocketPair const& pair, std::string_view name) {
+  auto poller = std::make_shared<TPollerImpl>();
+  auto server = EchoServer{poller, pair.server};
+  std::array<std::uint8_t, 100> message{};
+  tests::BenchmarkFunc(
+      [&](auto i) {
+        message[0] = static_cast<std::uint8_t>(i);
+        TEST_ASSERT_TRUE(
+            PingPong(pair.client, message.data(), message.size()));
+      },
+      kBenchCount, name, " ping pong message size ", message.size());
+}
+
+void FanOutBench(std::shared_ptr<NativePoller> const& poller,
+                 std::string_view name) {
+  std::vector<SocketPair> pairs;
+  std::vector<std::unique_ptr<EchoServer>> servers;
+  for (std::size_t i = 0; i < kFanOutConnections; ++i) {
+    auto& pair = pairs.emplace_back(test_poller::MakeTcpPair());
+    servers.emplace_back(std::make_unique<EchoServer>(poller, pair.server));
+  }
+
+  std::array<std::uint8_t, 100> message{};
+  tests::BenchmarkFunc(
+      [&](auto i) {
+        message[0] = static_cast<std::uint8_t>(i);
+        // send to all connections first to make poller wake up with a batch
+        for (auto const& pair : pairs) {
+          send(pair.client, message.data(), message.size(), MSG_NOSIGNAL);
+        }
+        std::array<std::uint8_t, message.size()> echo{};
+        for (auto const& pair : pairs) {
+          std::size_t received = 0;
+          while (received < echo.size()) {
+            auto res = recv(pair.client, echo.data() + received,
+                            echo.size() - received, 0);
+            TEST_ASSERT_GREATER_THAN(0, res);
+            received += static_cast<std::size_t>(res);
+          }
+        }
+      },
+      kBenchCount / kFanOutConnections, name, " fan out to ",
+      kFanOutConnections, " tcp connections");
+}
+
+void test_TcpPingPong() {
+  PingPongBench<EpollImpl>(test_poller::MakeTcpPair(), "epoll tcp");
+  if (IoUringImpl::IsSupported()) {
+    PingPongBench<IoUringImpl>(test_poller::MakeTcpPair(), "io_uring tcp");
+  }
+}
+
+void test_UdpPingPong() {
+  PingPongBench<EpollImpl>(test_poller::MakeUdpPair(), "epoll udp");
+  if (IoUringImpl::IsSupported()) {
+    PingPongBench<IoUringImpl>(test_poller::MakeUdpPair(), "io_uring udp");
+  }
+}
+
+void test_TcpFanOut() {
+  FanOutBench(std::make_shared<EpollImpl>(), "epoll");
+  FanOutBench(std::make_shared<EpollImpl>(
+                  EpollImpl::Config{.shards = 4, .max_events = 64}),
+              "sharded epoll 4x64");
+  if (IoUringImpl::IsSupported()) {
+    FanOutBench(std::make_shared<IoUringImpl>(), "io_uring");
+  }
+}
+}  // namespace ae::test_pollers_bench
+
+int test_pollers_bench() {
+  UNITY_BEGIN();
+  RUN_TEST(ae::test_pollers_bench::test_TcpPingPong);
+  RUN_TEST(ae::test_pollers_bench::test_UdpPingPong);
+  RUN_TEST(ae::test_pollers_bench::test_TcpFanOut);
+  return UNITY_END();
+}
@@ -0,0 +1,124 @@
+/*
+ * Copyright 2026 Aethernet Inc.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <unity.h>
+
+#include <array>
+#include <memory>
+#include <vector>
+#include <cstdint>
+
+#include "aether/poller/epoll_poller.h"
+#include "aether/poller/io_uring_poller.h"
+
+#include "tests/test-poller/loopback_echo.h"
+
+namespace ae::test_poller {
+static constexpr std::size_t kPingCount = 100;
+
+void EchoTest(std::shared_ptr<NativePoller> const& poller,
+              SocketPair const& pair) {
+  auto server = EchoServer{poller, pair.server};
+  std::array<std::uint8_t, 64> message{};
+  for (std::size_t i = 0; i < kPingCount; ++i) {
+    message.fill(static_cast<std::uint8_t>(i));
+    TEST_ASSERT_TRUE(PingPong(pair.client, message.data(), message.size()));
+  }
+}
+
+void MultipleConnectionsTest(std::shared_ptr<NativePoller> const& poller) {
+  static constexpr std::size_t kConnections = 32;
+  std::vector<SocketPair> pairs;
+  std::vector<std::unique_ptr<EchoServer>> servers;
+  for (std::size_t i = 0; i < kConnections; ++i) {
+    auto& pair = pairs.emplace_back(MakeTcpPair());
+    servers.emplace_back(std::make_unique<EchoServer>(poller, pair.server));
+  }
+  std::array<std::uint8_t, 16> message{};
+  for (std::size_t i = 0; i < kConnections; ++i) {
+    message.fill(static_cast<std::uint8_t>(i));
+    TEST_ASSERT_TRUE(
+        PingPong(pairs[i].client, message.data(), message.size()));
+  }
+  // remove half of connections and check the rest still served
+  servers.resize(kConnections / 2);
+  for (std::size_t i = 0; i < servers.size(); ++i) {
+    TEST_ASSERT_TRUE(
+        PingPong(pairs[i].client, message.data(), message.size()));
+  }
+}
+
+void test_EpollTcpEcho() {
+  auto poller = std::make_shared<EpollImpl>();
+  EchoTest(poller, MakeTcpPair());
+}
+
+void test_EpollUdpEcho() {
+  auto poller = std::make_shared<EpollImpl>();
+  EchoTest(poller, MakeUdpPair());
+}
+
+void test_EpollMultipleConnections() {
+  MultipleConnectionsTest(std::make_shared<EpollImpl>());
+}
+
+void test_ShardedEpollTcpEcho() {
+  auto poller = std::make_shared<EpollImpl>(
+      EpollImpl::Config{.shards = 4, .max_events = 64});
+  EchoTest(poller, MakeTcpPair());
+}
+
+void test_ShardedEpollMultipleConnections() {
+  MultipleConnectionsTest(std::make_shared<EpollImpl>(
+      EpollImpl::Config{.shards = 4, .max_events = 64}));
+}
+
+void test_IoUringTcpEcho() {
+  if (!IoUringImpl::IsSupported()) {
+    TEST_IGNORE_MESSAGE("io_uring is not supported");
+  }
+  auto poller = std::make_shared<IoUringImpl>();
+  EchoTest(poller, MakeTcpPair());
+}
+
+void test_IoUringUdpEcho() {
+  if (!IoUringImpl::IsSupported()) {
+    TEST_IGNORE_MESSAGE("io_uring is not supported");
+  }
+  auto poller = std::make_shared<IoUringImpl>();
+  EchoTest(poller, MakeUdpPair());
+}
+
+void test_IoUringMultipleConnections() {
+  if (!IoUringImpl::IsSupported()) {
+    TEST_IGNORE_MESSAGE("io_uring is not supported");
+  }
+  MultipleConnectionsTest(std::make_shared<IoUringImpl>());
+}
+}  // namespace ae::test_poller
+
+int test_pollers() {
+  UNITY_BEGIN();
+  RUN_TEST(ae::test_poller::test_EpollTcpEcho);
+  RUN_TEST(ae::test_poller::test_EpollUdpEcho);
+  RUN_TEST(ae::test_poller::test_EpollMultipleConnections);
+  RUN_TEST(ae::test_poller::test_ShardedEpollTcpEcho);
+  RUN_TEST(ae::test_poller::test_ShardedEpollMultipleConnections);
+  RUN_TEST(ae::test_poller::test_IoUringTcpEcho);
+  RUN_TEST(ae::test_poller::test_IoUringUdpEcho);
+  RUN_TEST(ae::test_poller::test_IoUringMultipleConnections);
+  return UNITY_END();
+}
@@ -25,6 +25,7 @@ extern int test_shared_ptr_bench();
 
 extern int run_test_ptr();
 extern int test_ptr_cycles();
+extern int test_ptr_cycles_bench();
 extern int test_ptr_view();
 extern int test_ptr_inheritance();
 
@@ -40,6 +41,9 @@ int main() {
 #if defined AE_RC_PTR_BENCH
   res += test_rc_ptr_bench();
   res += test_shared_ptr_bench();
+#endif
+#if defined AE_PTR_CYCLES_BENCH
+  res += test_ptr_cycles_bench();
 #endif
   return res;
 }
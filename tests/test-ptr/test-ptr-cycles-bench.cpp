@@ -0,0 +1,138 @@
+/*
+ * Copyright 2026 Aethernet Inc.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <unity.h>
+
+#include <array>
+#include <vector>
+#include <cstddef>
+#include <algorithm>
+
+#include "aether/ptr/ptr.h"
+#include "aether/ptr/cycle_collector.h"
+
+#include "tests/benchmarking.h"
+
+#if defined AE_PTR_CYCLES_BENCH
+namespace ae::test_ptr_cycles_bench {
+#  if !defined NDEBUG
+static constexpr std::size_t kBenchNodes = 100'000;
+#  else
+static constexpr std::size_t kBenchNodes = 1'000'000;
+#  endif
+static constexpr std::size_t kBranching = 4;
+static constexpr std::array<std::size_t, 4> kGraphSizes{10, 100, 1'000,
+                                                        10'000};
+
+// like cloud - servers - channels, each child references its parent
+struct Node {
+  ~Node() { ++destroyed; }
+  static inline std::size_t destroyed = 0;
+
+  Ptr<Node> parent;
+  std::vector<Ptr<Node>> children;
+
+  AE_REFLECT_MEMBERS(parent, children)
+};
+
+Ptr<Node> MakeGraph(std::size_t size) {
+  auto nodes = std::vector<Ptr<Node>>{};
+  nodes.reserve(size);
+  nodes.push_back(MakePtr<Node>());
+  for (std::size_t i = 1; i < size; ++i) {
+    auto& child = nodes.emplace_back(MakePtr<Node>());
+    auto& parent = nodes[(i - 1) / kBranching];
+    child->parent = parent;
+    parent->children.push_back(child);
+  }
+  return nodes.front();
+}
+
+std::vector<Ptr<Node>> MakeGraphs(std::size_t size, std::size_t count) {
+  // do not check the graph on each building step
+  CycleCollector::SetDeferred(true);
+  auto graphs = std::vector<Ptr<Node>>{};
+  graphs.reserve(count);
+  for (std::size_t i = 0; i < count; ++i) {
+    graphs.push_back(MakeGraph(size));
+  }
+  CycleCollector::Collect();
+  return graphs;
+}
+
+void BenchDestroy(bool deferred, std::size_t size) {
+  auto count = std::max(kBenchNodes / size, std::size_t{1});
+  auto graphs = MakeGraphs(size, count);
+  CycleCollector::SetDeferred(deferred);
+  Node::destroyed = 0;
+
+  tests::BenchmarkFunc(
+      [&](auto i) {
+        graphs[i].Reset();
+        while (!CycleCollector::Collect(AE_PTR_CYCLE_COLLECTOR_BUDGET)) {
+        }
+      },
+      count, deferred ? "deferred" : "synchronous", " destroy graph of ",
+      size, " objects");
+  TEST_ASSERT_EQUAL(count * size, Node::destroyed);
+  CycleCollector::SetDeferred(false);
+}
+
+void test_DestroyGraphBench() {
+  for (auto size : kGraphSizes) {
+    BenchDestroy(false, size);
+    BenchDestroy(true, size);
+  }
+}
+
+void BenchDropCopies(bool deferred, std::size_t size) {
+  static constexpr std::size_t kUpdateCopies = 100;
+  auto count = std::max(kBenchNodes / size, std::size_t{1});
+  auto graphs = MakeGraphs(size, 1);
+  CycleCollector::SetDeferred(deferred);
+  auto const& leaf = graphs.front()->children.back();
+
+  tests::BenchmarkFunc(
+      [&](auto i) {
+        // a temporary copy of the object referenced from the graph
+        auto copy = leaf;
+        copy.Reset();
+        if ((i % kUpdateCopies) == 0) {
+          CycleCollector::Collect(AE_PTR_CYCLE_COLLECTOR_BUDGET);
+        }
+      },
+      count, deferred ? "deferred" : "synchronous", " drop a copy in graph of ",
+      size, " objects");
+  CycleCollector::SetDeferred(false);
+}
+
+void test_DropCopiesBench() {
+  for (auto size : kGraphSizes) {
+    BenchDropCopies(false, size);
+    BenchDropCopies(true, size);
+  }
+}
+}  // namespace ae::test_ptr_cycles_bench
+#endif
+
+int test_ptr_cycles_bench() {
+  UNITY_BEGIN();
+#if defined AE_PTR_CYCLES_BENCH
+  RUN_TEST(ae::test_ptr_cycles_bench::test_DestroyGraphBench);
+  RUN_TEST(ae::test_ptr_cycles_bench::test_DropCopiesBench);
+#endif
+  return UNITY_END();
+}
@@ -253,6 +253,151 @@ void test_CycleRemoveThroughThreeLevels() {
   TEST_ASSERT_EQUAL(1, ObjJ::obj_j_destroyed);
 }
 
+struct ObjK {
+  static inline int obj_k_destroyed = 0;
+  ~ObjK() { ++obj_k_destroyed; }
+
+  Ptr<ObjK> next;
+
+  AE_REFLECT_MEMBERS(next)
+};
+
+void test_LongCycle() {
+  // more objects than fit into uint8 index
+  static constexpr int kCount = 1000;
+  ObjK::obj_k_destroyed = 0;
+  {
+    auto head = MakePtr<ObjK>();
+    auto* tail = &head;
+    for (int i = 1; i < kCount; ++i) {
+      (*tail)->next = MakePtr<ObjK>();
+      tail = &(*tail)->next;
+    }
+    (*tail)->next = head;
+    TEST_ASSERT_EQUAL(0, ObjK::obj_k_destroyed);
+  }
+  TEST_ASSERT_EQUAL(kCount, ObjK::obj_k_destroyed);
+}
+
+void test_DeferredCycleCollection() {
+  ObjA::obj_a_destroyed = 0;
+  ObjB::obj_b_destroyed = 0;
+  CycleCollector::SetDeferred(true);
+  PtrView<ObjA> a_view;
+  {
+    auto a = MakePtr<ObjA>();
+    auto b = MakePtr<ObjB>();
+    a->obj_b = b;
+    b->obj_a = a;
+    a_view = a;
+  }
+  // cycle is alive until collected
+  TEST_ASSERT_EQUAL(0, ObjA::obj_a_destroyed);
+  TEST_ASSERT_GREATER_THAN(0, CycleCollector::RootsCount());
+  {
+    // and may be referenced again
+    auto a = a_view.Lock();
+    TEST_ASSERT_TRUE(a);
+    TEST_ASSERT_TRUE(CycleCollector::Collect());
+    TEST_ASSERT_EQUAL(0, ObjA::obj_a_destroyed);
+    TEST_ASSERT_EQUAL(0, ObjB::obj_b_destroyed);
+  }
+  TEST_ASSERT_TRUE(CycleCollector::Collect());
+  TEST_ASSERT_EQUAL(1, ObjA::obj_a_destroyed);
+  TEST_ASSERT_EQUAL(1, ObjB::obj_b_destroyed);
+  TEST_ASSERT_FALSE(a_view.Lock());
+  CycleCollector::SetDeferred(false);
+}
+
+void test_DeferredCollectionBudget() {
+  static constexpr int kCount = 10;
+  ObjA::obj_a_destroyed = 0;
+  ObjB::obj_b_destroyed = 0;
+  CycleCollector::SetDeferred(true);
+  for (int i = 0; i < kCount; ++i) {
+    auto a = MakePtr<ObjA>();
+    a->obj_b = MakePtr<ObjB>();
+    a->obj_b->obj_a = a;
+  }
+  // each cycle has two objects
+  int updates = 0;
+  while (!CycleCollector::Collect(2)) {
+    ++updates;
+    TEST_ASSERT_EQUAL(updates, ObjA::obj_a_destroyed);
+  }
+  TEST_ASSERT_EQUAL(kCount, ObjA::obj_a_destroyed);
+  TEST_ASSERT_EQUAL(kCount, ObjB::obj_b_destroyed);
+  CycleCollector::SetDeferred(false);
+}
+
+/**
+ * \brief Ring of kCount ObjK, view refers to the node at middle.
+ */
+static Ptr<ObjK> MakeRing(int count, PtrView<ObjK>& middle) {
+  auto head = MakePtr<ObjK>();
+  auto* tail = &head;
+  for (int i = 1; i < count; ++i) {
+    (*tail)->next = MakePtr<ObjK>();
+    tail = &(*tail)->next;
+    if (i == count / 2) {
+      middle = *tail;
+    }
+  }
+  (*tail)->next = head;
+  return head;
+}
+
+void test_DeferredCollectionResumed() {
+  static constexpr int kCount = 100;
+  ObjK::obj_k_destroyed = 0;
+  CycleCollector::SetDeferred(true);
+  PtrView<ObjK> middle;
+  MakeRing(kCount, middle);
+
+  // the graph is visited by parts
+  TEST_ASSERT_FALSE(CycleCollector::Collect(10));
+  TEST_ASSERT_FALSE(CycleCollector::Collect(10));
+  {
+    // referenced again in the middle of collection
+    auto node = middle.Lock();
+    TEST_ASSERT_TRUE(node);
+    while (!CycleCollector::Collect(10)) {
+    }
+    TEST_ASSERT_EQUAL(0, ObjK::obj_k_destroyed);
+  }
+  while (!CycleCollector::Collect(10)) {
+    TEST_ASSERT_EQUAL(0, ObjK::obj_k_destroyed);
+  }
+  TEST_ASSERT_EQUAL(kCount, ObjK::obj_k_destroyed);
+  CycleCollector::SetDeferred(false);
+}
+
+void test_DeferredCollectionGraphChanged() {
+  static constexpr int kCount = 100;
+  ObjK::obj_k_destroyed = 0;
+  CycleCollector::SetDeferred(true);
+  PtrView<ObjK> middle;
+  MakeRing(kCount, middle);
+
+  TEST_ASSERT_FALSE(CycleCollector::Collect(kCount - 10));
+  Ptr<ObjK> rest;
+  {
+    // the ring is broken, its visited edge is moved out of the graph without
+    // reference count change
+    auto node = middle.Lock();
+    rest = std::move(node->next);
+  }
+  while (!CycleCollector::Collect(10)) {
+  }
+  TEST_ASSERT_EQUAL(0, ObjK::obj_k_destroyed);
+  TEST_ASSERT_TRUE(rest);
+
+  rest.Reset();
+  TEST_ASSERT_TRUE(CycleCollector::Collect());
+  TEST_ASSERT_EQUAL(kCount, ObjK::obj_k_destroyed);
+  CycleCollector::SetDeferred(false);
+}
+
 }  // namespace test_ptr_cycles
 }  // namespace ae
 
@@ -267,5 +412,10 @@ int test_ptr_cycles() {
   RUN_TEST(ae::test_ptr_cycles::test_ObjDnObjECycleWithPtrView);
   RUN_TEST(ae::test_ptr_cycles::test_CycleListPtr);
   RUN_TEST(ae::test_ptr_cycles::test_CycleRemoveThroughThreeLevels);
+  RUN_TEST(ae::test_ptr_cycles::test_LongCycle);
+  RUN_TEST(ae::test_ptr_cycles::test_DeferredCycleCollection);
+  RUN_TEST(ae::test_ptr_cycles::test_DeferredCollectionBudget);
+  RUN_TEST(ae::test_ptr_cycles::test_DeferredCollectionResumed);
+  RUN_TEST(ae::test_ptr_cycles::test_DeferredCollectionGraphChanged);
   return UNITY_END();
 }
@@ -33,6 +33,11 @@ extern int test_safe_stream_recv();
 extern int test_safe_stream_send_recv();
 extern int test_safe_stream();
 extern int test_safe_stream_reliability();
+extern int test_congestion_control();
+extern int test_safe_stream_congestion_bench();
+extern int test_safe_stream_send_bench();
+extern int test_chunk_list_bench();
+extern int test_safe_stream_fec_bench();
 
 int main() {
   int res = 0;
@@ -44,5 +49,12 @@ int main() {
   res += test_safe_stream_send_recv();
   res += test_safe_stream();
   res += test_safe_stream_reliability();
+  res += test_congestion_control();
+#if defined AE_SAFE_STREAM_BENCH
+  res += test_safe_stream_congestion_bench();
+  res += test_safe_stream_send_bench();
+  res += test_chunk_list_bench();
+  res += test_safe_stream_fec_bench();
+#endif
   return res;
 }
@@ -16,7 +16,9 @@
 
 #include "mock_bad_streams.h"
 
+#include <chrono>
 #include <random>
+#include <algorithm>
 
 #include "aether/tele.h"
 
@@ -99,4 +101,52 @@ void PacketDelayStream::LinkOut(ByteIStream& out) {
   stream_update_event_.Emit();
 }
 
+BottleneckStream::BottleneckStream(AeContext const& ae_context,
+                                   std::size_t bandwidth,
+                                   std::size_t queue_size, Duration latency)
+    : ae_context_{ae_context},
+      bandwidth_{bandwidth},
+      queue_size_{queue_size},
+      latency_{latency} {}
+
+WriteAction& BottleneckStream::Write(DataBuffer&& data_buffer) {
+  assert(out_);
+
+  if ((queued_size_ + data_buffer.size()) > queue_size_) {
+    AE_TELED_DEBUG("Bottleneck queue overflow!");
+    dropped_count_++;
+  } else {
+    auto current_time = Now();
+    auto transmit_time = std::chrono::duration_cast<Duration>(
+        std::chrono::duration<double>{static_cast<double>(data_buffer.size()) /
+                                      static_cast<double>(bandwidth_)});
+    link_free_time_ = std::max(link_free_time_, current_time) + transmit_time;
+
+    queued_size_ += data_buffer.size();
+    data_queue_.push(std::move(data_buffer));
+    ae_context_.scheduler().DelayedTask(
+        [this]() {
+          auto d = std::move(data_queue_.front());
+          data_queue_.pop();
+          queued_size_ -= d.size();
+          out_->Write(std::move(d));
+        },
+        link_free_time_ + latency_);
+  }
+
+  // return data sent is done
+  if (!dsw_ || dsw_->is_finished()) {
+    dsw_.emplace(ae_context_);
+  }
+  return *dsw_;
+}
+
+void BottleneckStream::LinkOut(ByteIStream& out) {
+  out_ = &out;
+  out_data_sub_ = out_->out_data_event().Subscribe(out_data_event_);
+  stream_update_event_.Emit();
+}
+
+std::size_t BottleneckStream::dropped_count() const { return dropped_count_; }
+
 }  // namespace ae
@@ -18,6 +18,7 @@
 #define TESTS_TEST_STREAM_MOCK_BAD_STREAMS_H_
 
 #include <queue>
+#include <cstddef>
 #include <optional>
 
 #include "aether/ae_context.h"
@@ -62,6 +63,34 @@ class PacketDelayStream : public ByteStream {
   std::queue<DataBuffer> data_queue_;
   std::optional<bad_streams_internal::DoneStreamWriteAction> dsw_;
 };
+
+/**
+ * \brief Link with limited bandwidth and queue.
+ * Packets are delivered one by one by bandwidth after latency, packets not
+ * fitting the queue are dropped.
+ */
+class BottleneckStream : public ByteStream {
+ public:
+  BottleneckStream(AeContext const& ae_context, std::size_t bandwidth,
+                   std::size_t queue_size, Duration latency);
+
+  WriteAction& Write(DataBuffer&& data_buffer) override;
+
+  void LinkOut(ByteIStream& out) override;
+
+  std::size_t dropped_count() const;
+
+ private:
+  AeContext ae_context_;
+  std::size_t bandwidth_;  //< bytes per second
+  std::size_t queue_size_;
+  Duration latency_;
+  std::size_t queued_size_{};
+  std::size_t dropped_count_{};
+  TimePoint link_free_time_{};
+  std::queue<DataBuffer> data_queue_;
+  std::optional<bad_streams_internal::DoneStreamWriteAction> dsw_;
+};
 }  // namespace ae
 
 #endif  // TESTS_TEST_STREAM_MOCK_BAD_STREAMS_H_
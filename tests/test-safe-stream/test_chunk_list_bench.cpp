@@ -0,0 +1,195 @@
+/*
+ * Copyright 2026 Aethernet Inc.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <unity.h>
+
+#include <array>
+#include <chrono>
+#include <random>
+#include <vector>
+#include <cstddef>
+#include <cstdint>
+#include <iomanip>
+#include <iostream>
+#include <algorithm>
+#include <string_view>
+
+#include "aether/safe_stream/details/sending_chunk_list.h"
+#include "aether/safe_stream/details/receiving_chunk_list.h"
+
+#if defined AE_SAFE_STREAM_BENCH
+namespace ae::test_chunk_list_bench {
+static constexpr std::size_t kCapacity = 20 * 1024;
+using IndexType = RingIndex<kCapacity>;
+using IndexRangeType = RingIndexRange<IndexType>;
+
+static constexpr std::size_t kWindowSize = 8 * 1024;
+static constexpr std::size_t kChunkSize = 256;
+static constexpr std::size_t kWindowChunks = kWindowSize / kChunkSize;
+static constexpr std::size_t kRounds = 20000;
+
+using Clock = std::chrono::steady_clock;
+
+void Print(std::string_view name, Clock::duration duration,
+           std::size_t operations) {
+  auto ns =
+      std::chrono::duration_cast<std::chrono::duration<double, std::nano>>(
+          duration);
+  std::cout << "┌" << '\n'
+            << "│Bench: " << name << "\n│\t" << std::setprecision(1)
+            << std::fixed << (ns.count() / static_cast<double>(operations))
+            << " ns per chunk"
+            << "\n└" << std::endl;
+}
+
+/**
+ * \brief Chunks of the window received in random order.
+ */
+void test_ReceiveOutOfOrder() {
+  auto rng = std::mt19937{42};
+  auto order = std::vector<std::size_t>(kWindowChunks);
+
+  auto begin = IndexType{0};
+  auto chunk_list = ReceiveChunkList<IndexType>{begin, kWindowSize};
+  std::size_t received = 0;
+
+  auto start = Clock::now();
+  for (std::size_t r = 0; r < kRounds; ++r) {
+    for (std::size_t i = 0; i < order.size(); ++i) {
+      order[i] = i;
+    }
+    std::shuffle(std::begin(order), std::end(order), rng);
+    auto const window_begin = begin;
+    for (auto i : order) {
+      auto left = window_begin + (i * kChunkSize);
+      chunk_list.AddChunk(IndexRangeType{left, left + kChunkSize - 1}, 0);
+      auto range = chunk_list.ReceiveChunk();
+      if (range.IsEmpty()) {
+        continue;
+      }
+      received += range.distance() + 1;
+      chunk_list.Acknowledge(range.right);
+      begin = range.right + 1;
+      chunk_list.set_buffer_begin(begin);
+    }
+  }
+  Print("receive chunks out of order", Clock::now() - start,
+        kRounds * kWindowChunks);
+  TEST_ASSERT_EQUAL(kRounds * kWindowSize, received);
+  TEST_ASSERT_TRUE(chunk_list.empty());
+}
+
+/**
+ * \brief A third of the chunks is lost and repeated after the gap is found.
+ */
+void test_ReceiveHighLoss() {
+  auto rng = std::mt19937{42};
+  auto loss = std::bernoulli_distribution{0.3};
+
+  auto begin = IndexType{0};
+  auto chunk_list = ReceiveChunkList<IndexType>{begin, kWindowSize};
+  std::size_t received = 0;
+  std::size_t missed_count = 0;
+
+  auto start = Clock::now();
+  for (std::size_t r = 0; r < kRounds; ++r) {
+    auto lost = std::vector<std::size_t>{};
+    for (std::size_t i = 0; i < kWindowChunks; ++i) {
+      if (loss(rng)) {
+        lost.push_back(i);
+        continue;
+      }
+      auto left = begin + (i * kChunkSize);
+      chunk_list.AddChunk(IndexRangeType{left, left + kChunkSize - 1}, 0);
+    }
+    // find the gaps and receive repeats
+    while (auto missed = chunk_list.FindMissedChunk()) {
+      ++missed_count;
+      auto ranges = std::array<IndexRangeType, 8>{};
+      TEST_ASSERT_NOT_EQUAL(0, chunk_list.ReceivedRanges(ranges));
+      chunk_list.AddChunk(*missed, 1);
+    }
+    for (auto i : lost) {
+      auto left = begin + (i * kChunkSize);
+      chunk_list.AddChunk(IndexRangeType{left, left + kChunkSize - 1}, 1);
+    }
+    auto range = chunk_list.ReceiveChunk();
+    received += range.distance() + 1;
+    chunk_list.Acknowledge(range.right);
+    begin = range.right + 1;
+    chunk_list.set_buffer_begin(begin);
+  }
+  Print("receive chunks with 30% loss", Clock::now() - start,
+        kRounds * kWindowChunks + missed_count);
+  TEST_ASSERT_EQUAL(kRounds * kWindowSize, received);
+  TEST_ASSERT_TRUE(chunk_list.empty());
+}
+
+/**
+ * \brief Half of the window acknowledged selectively, the other half is
+ * repeated and then acknowledged cumulatively.
+ */
+void test_SendSelectiveAck() {
+  auto rng = std::mt19937{42};
+  auto ack = std::bernoulli_distribution{0.5};
+
+  auto begin = IndexType{0};
+  auto chunk_list = SendingChunkList<IndexType>{begin, kWindowSize};
+  std::size_t operations = 0;
+
+  auto start = Clock::now();
+  for (std::size_t r = 0; r < kRounds; ++r) {
+    auto now = Now();
+    for (std::size_t i = 0; i < kWindowChunks; ++i) {
+      auto left = begin + (i * kChunkSize);
+      chunk_list.Register(IndexRangeType{left, left + kChunkSize - 1}, now);
+    }
+    for (std::size_t i = 0; i < kWindowChunks; ++i) {
+      if (ack(rng)) {
+        auto left = begin + (i * kChunkSize);
+        chunk_list.Acknowledge(IndexRangeType{left, left + kChunkSize - 1});
+      }
+    }
+    // repeat not acknowledged
+    auto index = chunk_list.SkipAcknowledged(begin);
+    while (Distance(begin, index) < kWindowSize) {
+      auto size = std::min({kChunkSize, kWindowSize - Distance(begin, index),
+                            chunk_list.UnacknowledgedSize(index)});
+      chunk_list.Register(IndexRangeType{index, index + size - 1}, now);
+      index = chunk_list.SkipAcknowledged(index + size);
+      ++operations;
+    }
+    chunk_list.RemoveUpTo(begin + kWindowSize - 1);
+    begin += kWindowSize;
+    chunk_list.set_buffer_begin(begin);
+    TEST_ASSERT_TRUE(chunk_list.empty());
+  }
+  Print("send chunks with selective acks", Clock::now() - start,
+        kRounds * kWindowChunks * 2 + operations);
+}
+
+}  // namespace ae::test_chunk_list_bench
+#endif
+
+int test_chunk_list_bench() {
+  UNITY_BEGIN();
+#if defined AE_SAFE_STREAM_BENCH
+  RUN_TEST(ae::test_chunk_list_bench::test_ReceiveOutOfOrder);
+  RUN_TEST(ae::test_chunk_list_bench::test_ReceiveHighLoss);
+  RUN_TEST(ae::test_chunk_list_bench::test_SendSelectiveAck);
+#endif
+  return UNITY_END();
+}
@@ -0,0 +1,145 @@
+/*
+ * Copyright 2026 Aethernet Inc.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <unity.h>
+
+#include <chrono>
+
+#include "aether/safe_stream/congestion_control.h"
+
+namespace ae::test_congestion_control {
+using namespace std::chrono_literals;
+
+static constexpr std::size_t kMaxWindow = 8192;
+static constexpr std::size_t kPayload = 100;
+static constexpr auto kRtt = Duration{20ms};
+
+void test_FixedWindow() {
+  auto cc = FixedWindowControl{kMaxWindow};
+  auto now = Now();
+  TEST_ASSERT_EQUAL(kMaxWindow, cc.window());
+  cc.OnAcked(kPayload, kRtt, now);
+  TEST_ASSERT_EQUAL(kMaxWindow, cc.window());
+  cc.OnLost(now);
+  TEST_ASSERT_EQUAL(kMaxWindow, cc.window());
+  TEST_ASSERT_TRUE(cc.SendTime(now) == now);
+}
+
+void test_AimdSlowStart() {
+  auto cc = AimdControl{kMaxWindow};
+  cc.SetMaxPayload(kPayload);
+  auto now = Now();
+  TEST_ASSERT_EQUAL(AimdControl::kInitialPayloads * kPayload, cc.window());
+
+  // window doubles each round trip
+  for (int round = 0; round < 3; ++round) {
+    auto window = cc.window();
+    for (std::size_t acked = 0; acked < window; acked += kPayload) {
+      cc.OnAcked(kPayload, kRtt, now);
+    }
+    TEST_ASSERT_EQUAL(2 * window, cc.window());
+    now += kRtt;
+  }
+
+  // never grows over max window
+  for (int i = 0; i < 1000; ++i) {
+    cc.OnAcked(kPayload, kRtt, now);
+  }
+  TEST_ASSERT_EQUAL(kMaxWindow, cc.window());
+}
+
+void test_AimdDecreaseOnLoss() {
+  auto cc = AimdControl{kMaxWindow};
+  cc.SetMaxPayload(kPayload);
+  auto now = Now();
+  for (int i = 0; i < 100; ++i) {
+    cc.OnAcked(kPayload, kRtt, now);
+  }
+  TEST_ASSERT_EQUAL(kMaxWindow, cc.window());
+
+  cc.OnLost(now);
+  TEST_ASSERT_EQUAL(kMaxWindow / 2, cc.window());
+  TEST_ASSERT_EQUAL(kMaxWindow / 2, cc.slow_start_threshold());
+  // the losses in the same round trip are the one congestion event
+  cc.OnLost(now + (kRtt / 2));
+  TEST_ASSERT_EQUAL(kMaxWindow / 2, cc.window());
+  now += kRtt;
+  cc.OnLost(now);
+  TEST_ASSERT_EQUAL(kMaxWindow / 4, cc.window());
+
+  // congestion avoidance, one payload per round trip
+  auto window = cc.window();
+  for (std::size_t acked = 0; acked < window; acked += kPayload) {
+    cc.OnAcked(kPayload, kRtt, now);
+  }
+  TEST_ASSERT_EQUAL(window + kPayload, cc.window());
+
+  // never less than min window
+  for (int i = 0; i < 20; ++i) {
+    now += kRtt;
+    cc.OnLost(now);
+  }
+  TEST_ASSERT_EQUAL(AimdControl::kMinPayloads * kPayload, cc.window());
+}
+
+void test_PacingSpreadsSending() {
+  auto cc = PacingControl{kMaxWindow};
+  cc.SetMaxPayload(kPayload);
+  auto now = Now();
+  // no bandwidth estimation yet, send without pacing
+  TEST_ASSERT_EQUAL(PacingControl::kInitialPayloads * kPayload, cc.window());
+  TEST_ASSERT_TRUE(cc.SendTime(now) == now);
+  cc.OnSent(kPayload, now);
+  TEST_ASSERT_TRUE(cc.SendTime(now) == now);
+
+  // deliver 1000 bytes each round trip, 50000 bytes per second
+  cc.OnAcked(kPayload, kRtt, now);
+  for (int round = 0; round < 10; ++round) {
+    for (int i = 0; i < 10; ++i) {
+      now += kRtt / 10;
+      cc.OnAcked(kPayload, kRtt, now);
+    }
+  }
+  TEST_ASSERT_UINT_WITHIN(500, 50000,
+                          static_cast<std::size_t>(cc.bandwidth()));
+  // bandwidth is not grown, startup is finished
+  // window is bandwidth delay product with gain
+  TEST_ASSERT_UINT_WITHIN(
+      kPayload, static_cast<std::size_t>(PacingControl::kWindowGain * 1000),
+      cc.window());
+
+  // next send is delayed by the payload send time
+  cc.OnSent(kPayload, now);
+  auto send_interval = cc.SendTime(now) - now;
+  TEST_ASSERT_GREATER_THAN(0, send_interval.count());
+  TEST_ASSERT_LESS_THAN(
+      std::chrono::duration_cast<SystemClock::duration>(kRtt).count(),
+      send_interval.count());
+  // sending after the paced time is not delayed
+  now += 2 * kRtt;
+  TEST_ASSERT_TRUE(cc.SendTime(now) == now);
+}
+
+}  // namespace ae::test_congestion_control
+
+int test_congestion_control() {
+  UNITY_BEGIN();
+  RUN_TEST(ae::test_congestion_control::test_FixedWindow);
+  RUN_TEST(ae::test_congestion_control::test_AimdSlowStart);
+  RUN_TEST(ae::test_congestion_control::test_AimdDecreaseOnLoss);
+  RUN_TEST(ae::test_congestion_control::test_PacingSpreadsSending);
+  return UNITY_END();
+}
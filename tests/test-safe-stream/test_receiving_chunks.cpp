@@ -16,17 +16,20 @@
 
 #include <unity.h>
 
+#include <array>
+
 #include "aether/safe_stream/details/receiving_chunk_list.h"
 
 namespace ae::test_receiving_chunks {
 static constexpr std::size_t kCapacity = 1024;
+static constexpr std::size_t kWindowSize = 500;
 using IndexType = RingIndex<kCapacity>;
 using IndexRangeType = RingIndexRange<IndexType>;
 using ChunkList = ReceiveChunkList<IndexType>;
 
 void test_AddChunks() {
   static constexpr IndexType buffer_begin = IndexType{0};
-  auto chunk_list = ChunkList{buffer_begin};
+  auto chunk_list = ChunkList{buffer_begin, kWindowSize};
 
   auto res =
       chunk_list.AddChunk(IndexRangeType{IndexType{0}, IndexType{69}}, 0);
@@ -55,7 +58,7 @@ void test_AddChunks() {
 
 void test_ReceiveChunks() {
   static constexpr IndexType buffer_begin = IndexType{0};
-  auto chunk_list = ChunkList{buffer_begin};
+  auto chunk_list = ChunkList{buffer_begin, kWindowSize};
 
   auto chunk0 = chunk_list.ReceiveChunk();
   TEST_ASSERT_TRUE(chunk0.IsEmpty());
@@ -96,7 +99,7 @@ void test_ReceiveChunks() {
 
 void test_ReceiveChunksInOrder() {
   static constexpr IndexType buffer_begin = IndexType{0};
-  auto chunk_list = ChunkList{buffer_begin};
+  auto chunk_list = ChunkList{buffer_begin, kWindowSize};
 
   // second
   chunk_list.AddChunk(IndexRangeType{IndexType{100}, IndexType{149}}, 0);
@@ -111,7 +114,7 @@ void test_ReceiveChunksInOrder() {
 
 void test_ReceiveChunksOverlap() {
   static constexpr IndexType buffer_begin = IndexType{0};
-  auto chunk_list = ChunkList{buffer_begin};
+  auto chunk_list = ChunkList{buffer_begin, kWindowSize};
 
   // first
   chunk_list.AddChunk(IndexRangeType{IndexType{0}, IndexType{99}}, 0);
@@ -163,7 +166,7 @@ void test_ReceiveChunksOverlap() {
 
 void test_FindMissedChunks() {
   static constexpr IndexType buffer_begin = IndexType{0};
-  auto chunk_list = ChunkList{buffer_begin};
+  auto chunk_list = ChunkList{buffer_begin, kWindowSize};
 
   auto missed0 = chunk_list.FindMissedChunk();
   TEST_ASSERT_FALSE(missed0.has_value());
@@ -182,6 +185,149 @@ void test_FindMissedChunks() {
   TEST_ASSERT_EQUAL(31, missed2->left);
   TEST_ASSERT_EQUAL(49, missed2->right);
 }
+
+void test_ReceivedRanges() {
+  static constexpr IndexType buffer_begin = IndexType{0};
+  auto chunk_list = ChunkList{buffer_begin, kWindowSize};
+
+  auto ranges = std::array<IndexRangeType, 8>{};
+  TEST_ASSERT_EQUAL(0, chunk_list.ReceivedRanges(ranges));
+
+  chunk_list.AddChunk(IndexRangeType{IndexType{50}, IndexType{79}}, 0);
+  chunk_list.AddChunk(IndexRangeType{IndexType{20}, IndexType{29}}, 0);
+  // adjacent
+  chunk_list.AddChunk(IndexRangeType{IndexType{80}, IndexType{89}}, 0);
+  // overlapped
+  chunk_list.AddChunk(IndexRangeType{IndexType{25}, IndexType{34}}, 0);
+  chunk_list.AddChunk(IndexRangeType{IndexType{100}, IndexType{109}}, 0);
+
+  TEST_ASSERT_EQUAL(3, chunk_list.ReceivedRanges(ranges));
+  TEST_ASSERT_EQUAL(20, ranges[0].left);
+  TEST_ASSERT_EQUAL(34, ranges[0].right);
+  TEST_ASSERT_EQUAL(50, ranges[1].left);
+  TEST_ASSERT_EQUAL(89, ranges[1].right);
+  TEST_ASSERT_EQUAL(100, ranges[2].left);
+  TEST_ASSERT_EQUAL(109, ranges[2].right);
+
+  auto limited = std::array<IndexRangeType, 2>{};
+  TEST_ASSERT_EQUAL(2, chunk_list.ReceivedRanges(limited));
+  TEST_ASSERT_EQUAL(89, limited[1].right);
+}
+
+void test_ReceiveChunksWrapAround() {
+  // begin near the ring end
+  auto buffer_begin = IndexType{kCapacity - 100};
+  auto chunk_list = ChunkList{buffer_begin, kWindowSize};
+
+  // the second chunk wraps around the ring end
+  chunk_list.AddChunk(
+      IndexRangeType{buffer_begin + 150, buffer_begin + 199}, 0);
+  chunk_list.AddChunk(IndexRangeType{buffer_begin + 50, buffer_begin + 129},
+                      0);
+
+  auto missed = chunk_list.FindMissedChunk();
+  TEST_ASSERT_TRUE(missed.has_value());
+  TEST_ASSERT_EQUAL(buffer_begin, missed->left);
+  TEST_ASSERT_EQUAL(buffer_begin + 49, missed->right);
+
+  auto ranges = std::array<IndexRangeType, 8>{};
+  TEST_ASSERT_EQUAL(2, chunk_list.ReceivedRanges(ranges));
+  TEST_ASSERT_EQUAL(buffer_begin + 50, ranges[0].left);
+  TEST_ASSERT_EQUAL(buffer_begin + 129, ranges[0].right);
+  TEST_ASSERT_EQUAL(buffer_begin + 150, ranges[1].left);
+  TEST_ASSERT_EQUAL(buffer_begin + 199, ranges[1].right);
+
+  chunk_list.AddChunk(IndexRangeType{buffer_begin, buffer_begin + 49}, 1);
+  auto chunk = chunk_list.ReceiveChunk();
+  TEST_ASSERT_EQUAL(buffer_begin, chunk.left);
+  TEST_ASSERT_EQUAL(buffer_begin + 129, chunk.right);
+
+  chunk_list.Acknowledge(chunk.right);
+  chunk_list.set_buffer_begin(chunk.right + 1);
+  TEST_ASSERT_FALSE(chunk_list.empty());
+
+  // repeat of the received chunk
+  auto res = chunk_list.AddChunk(
+      IndexRangeType{buffer_begin + 150, buffer_begin + 199}, 1);
+  TEST_ASSERT_EQUAL(ChunkAddResult::kAddRepeated, res);
+
+  chunk_list.AddChunk(IndexRangeType{buffer_begin + 130, buffer_begin + 149},
+                      0);
+  chunk = chunk_list.ReceiveChunk();
+  TEST_ASSERT_EQUAL(buffer_begin + 130, chunk.left);
+  TEST_ASSERT_EQUAL(buffer_begin + 199, chunk.right);
+  chunk_list.Acknowledge(chunk.right);
+  chunk_list.set_buffer_begin(chunk.right + 1);
+  TEST_ASSERT_TRUE(chunk_list.empty());
+  TEST_ASSERT_FALSE(chunk_list.FindMissedChunk().has_value());
+}
+
+void test_MissedRanges() {
+  auto buffer_begin = IndexType{kCapacity - 100};
+  auto chunk_list = ChunkList{buffer_begin, kWindowSize};
+
+  chunk_list.AddChunk(IndexRangeType{buffer_begin + 20, buffer_begin + 39},
+                      0);
+  chunk_list.AddChunk(
+      IndexRangeType{buffer_begin + 100, buffer_begin + 149}, 0);
+
+  // not received data after the last chunk is missed too
+  auto missed = std::array<IndexRangeType, 8>{};
+  TEST_ASSERT_EQUAL(3, chunk_list.MissedRanges(
+                           IndexRangeType{buffer_begin, buffer_begin + 199},
+                           missed));
+  TEST_ASSERT_EQUAL(buffer_begin, missed[0].left);
+  TEST_ASSERT_EQUAL(buffer_begin + 19, missed[0].right);
+  TEST_ASSERT_EQUAL(buffer_begin + 40, missed[1].left);
+  TEST_ASSERT_EQUAL(buffer_begin + 99, missed[1].right);
+  TEST_ASSERT_EQUAL(buffer_begin + 150, missed[2].left);
+  TEST_ASSERT_EQUAL(buffer_begin + 199, missed[2].right);
+
+  TEST_ASSERT_EQUAL(0, chunk_list.MissedRanges(
+                           IndexRangeType{buffer_begin + 100,
+                                          buffer_begin + 149},
+                           missed));
+
+  // all the missed ranges are counted, only the first ones are filled
+  auto limited = std::array<IndexRangeType, 2>{};
+  TEST_ASSERT_EQUAL(3, chunk_list.MissedRanges(
+                           IndexRangeType{buffer_begin, buffer_begin + 199},
+                           limited));
+  TEST_ASSERT_EQUAL(buffer_begin + 99, limited[1].right);
+}
+
+void test_RepeatCountsLimit() {
+  static constexpr IndexType buffer_begin = IndexType{0};
+  auto chunk_list = ReceiveChunkList<IndexType, 2>{buffer_begin, kWindowSize};
+
+  // out of the window
+  auto res = chunk_list.AddChunk(
+      IndexRangeType{IndexType{kWindowSize - 9}, IndexType{kWindowSize + 1}},
+      0);
+  TEST_ASSERT_EQUAL(ChunkAddResult::kInvalid, res);
+
+  for (std::size_t i = 0; i < 3; ++i) {
+    auto range = IndexRangeType{IndexType{i * 10}, IndexType{i * 10 + 9}};
+    chunk_list.AddChunk(range, 0);
+    res = chunk_list.AddChunk(range, static_cast<std::uint8_t>(i + 1));
+    TEST_ASSERT_EQUAL(ChunkAddResult::kAddRepeated, res);
+  }
+  // the least repeat count is dropped, so the repeat is acked again
+  res = chunk_list.AddChunk(IndexRangeType{IndexType{0}, IndexType{9}}, 1);
+  TEST_ASSERT_EQUAL(ChunkAddResult::kAddRepeated, res);
+  res = chunk_list.AddChunk(IndexRangeType{IndexType{20}, IndexType{29}}, 3);
+  TEST_ASSERT_EQUAL(ChunkAddResult::kDuplicate, res);
+
+  // acknowledged chunks' counts are freed
+  chunk_list.Acknowledge(IndexType{29});
+  chunk_list.set_buffer_begin(IndexType{30});
+  auto range = IndexRangeType{IndexType{30}, IndexType{39}};
+  chunk_list.AddChunk(range, 0);
+  res = chunk_list.AddChunk(range, 1);
+  TEST_ASSERT_EQUAL(ChunkAddResult::kAddRepeated, res);
+  res = chunk_list.AddChunk(range, 1);
+  TEST_ASSERT_EQUAL(ChunkAddResult::kDuplicate, res);
+}
 }  // namespace ae::test_receiving_chunks
 
 int test_receiving_chunks() {
@@ -191,5 +337,9 @@ int test_receiving_chunks() {
   RUN_TEST(ae::test_receiving_chunks::test_ReceiveChunksInOrder);
   RUN_TEST(ae::test_receiving_chunks::test_ReceiveChunksOverlap);
   RUN_TEST(ae::test_receiving_chunks::test_FindMissedChunks);
+  RUN_TEST(ae::test_receiving_chunks::test_ReceivedRanges);
+  RUN_TEST(ae::test_receiving_chunks::test_ReceiveChunksWrapAround);
+  RUN_TEST(ae::test_receiving_chunks::test_MissedRanges);
+  RUN_TEST(ae::test_receiving_chunks::test_RepeatCountsLimit);
   return UNITY_END();
 }
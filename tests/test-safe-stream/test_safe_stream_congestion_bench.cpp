@@ -0,0 +1,165 @@
+/*
+ * Copyright 2026 Aethernet Inc.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <unity.h>
+
+#include <chrono>
+#include <memory>
+#include <cstdint>
+#include <iomanip>
+#include <iostream>
+#include <string_view>
+
+#include "aether/safe_stream/safe_stream.h"
+#include "aether/safe_stream/congestion_control.h"
+
+#include "tests/test-stream/mock_write_stream.h"
+
+#include "mock_bad_streams.h"
+#include "stream-test-ctx.h"
+
+#if defined AE_SAFE_STREAM_BENCH
+namespace ae::test_safe_stream_congestion_bench {
+constexpr auto config = SafeStreamConfig{
+    8192,
+    400,
+    100,
+    std::chrono::milliseconds{50},
+    std::chrono::milliseconds{0},
+    std::chrono::milliseconds{10},
+};
+
+static constexpr std::size_t kCapacity = 20 * 1024;
+static constexpr std::size_t kMessageSize = 1024;
+static constexpr std::size_t kTotalSize = 100 * kMessageSize;
+// max size of data written but not received yet
+static constexpr std::size_t kMaxWrittenSize = 8 * kMessageSize;
+// the bottleneck queue is smaller than the window
+static constexpr std::size_t kBandwidth = 64 * 1024;
+static constexpr std::size_t kQueueSize = 4 * 1024;
+static constexpr auto kLatency = std::chrono::milliseconds{10};
+static constexpr auto kTimeout = std::chrono::seconds{60};
+
+enum class Control : std::uint8_t {
+  kFixed,
+  kAimd,
+  kPacing,
+};
+
+std::unique_ptr<ICongestionControl> MakeControl(Control control) {
+  switch (control) {
+    case Control::kFixed:
+      return std::make_unique<FixedWindowControl>(config.window_size);
+    case Control::kAimd:
+      return std::make_unique<AimdControl>(config.window_size);
+    case Control::kPacing:
+      return std::make_unique<PacingControl>(config.window_size);
+  }
+  return {};
+}
+
+std::string_view ControlName(Control control) {
+  switch (control) {
+    case Control::kFixed:
+      return "fixed window";
+    case Control::kAimd:
+      return "AIMD";
+    case Control::kPacing:
+      return "pacing";
+  }
+  return {};
+}
+
+double MeasureGoodput(Control control, float loss_rate, float delay_rate) {
+  TestContext ctx;
+
+  auto packet_loss = LostPacketsStream{ctx, loss_rate};
+  auto packet_delay =
+      PacketDelayStream{ctx, delay_rate, std::chrono::milliseconds{50}};
+  auto bottleneck = BottleneckStream{ctx, kBandwidth, kQueueSize, kLatency};
+  auto s_mock_stream = MockWriteStream{ctx, 1024};
+  auto r_mock_stream = MockWriteStream{ctx, 1024};
+
+  s_mock_stream.on_write_event().Subscribe(
+      [&](auto&& data) { r_mock_stream.WriteOut(data); });
+  r_mock_stream.on_write_event().Subscribe(
+      [&](auto&& data) { s_mock_stream.WriteOut(data); });
+
+  auto sender = SafeStream<kCapacity>{ctx, config};
+  auto receiver = SafeStream<kCapacity>{ctx, config};
+  sender.SetCongestionControl(MakeControl(control));
+
+  // only data goes through the bad link, acks are returned directly
+  Tie(sender, packet_loss, packet_delay, bottleneck, s_mock_stream);
+  Tie(receiver, r_mock_stream);
+
+  std::size_t written_size = 0;
+  std::size_t received_size = 0;
+  receiver.out_data_event().Subscribe(
+      [&](auto const& d) { received_size += d.size(); });
+
+  auto const message = DataBuffer(kMessageSize, 0x42);
+  auto begin = Now();
+  while ((received_size < kTotalSize) && ((Now() - begin) < kTimeout)) {
+    while ((written_size < kTotalSize) &&
+           ((written_size - received_size) < kMaxWrittenSize)) {
+      sender.Write(DataBuffer{message});
+      written_size += message.size();
+    }
+    ctx.Update(Now());
+  }
+  auto duration = std::chrono::duration_cast<std::chrono::duration<double>>(
+      Now() - begin);
+  TEST_ASSERT_EQUAL(kTotalSize, received_size);
+
+  auto goodput = static_cast<double>(received_size) / duration.count();
+  std::cout << "┌" << '\n'
+            << "│Bench: " << ControlName(control) << ", loss rate "
+            << loss_rate << ", delay rate " << delay_rate
+            << "\n│\tgoodput: " << std::setprecision(1) << std::fixed
+            << goodput << " B/s"
+            << "\n│\tdropped by bottleneck: " << bottleneck.dropped_count()
+            << "\n└" << std::endl;
+  return goodput;
+}
+
+void CompareGoodput(float loss_rate, float delay_rate) {
+  auto fixed = MeasureGoodput(Control::kFixed, loss_rate, delay_rate);
+  auto aimd = MeasureGoodput(Control::kAimd, loss_rate, delay_rate);
+  auto pacing = MeasureGoodput(Control::kPacing, loss_rate, delay_rate);
+  std::cout << "│\tgoodput against fixed window, AIMD: "
+            << std::setprecision(2) << (aimd / fixed)
+            << ", pacing: " << (pacing / fixed) << std::endl;
+}
+
+void test_GoodputBottleneck() { CompareGoodput(0.0F, 0.0F); }
+
+void test_GoodputBottleneckLoss() { CompareGoodput(0.02F, 0.0F); }
+
+void test_GoodputBottleneckDelay() { CompareGoodput(0.0F, 0.1F); }
+
+}  // namespace ae::test_safe_stream_congestion_bench
+#endif
+
+int test_safe_stream_congestion_bench() {
+  UNITY_BEGIN();
+#if defined AE_SAFE_STREAM_BENCH
+  RUN_TEST(ae::test_safe_stream_congestion_bench::test_GoodputBottleneck);
+  RUN_TEST(ae::test_safe_stream_congestion_bench::test_GoodputBottleneckLoss);
+  RUN_TEST(ae::test_safe_stream_congestion_bench::test_GoodputBottleneckDelay);
+#endif
+  return UNITY_END();
+}
@@ -0,0 +1,152 @@
+/*
+ * Copyright 2026 Aethernet Inc.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <unity.h>
+
+#include <chrono>
+#include <vector>
+#include <cstdint>
+#include <iomanip>
+#include <iostream>
+#include <algorithm>
+#include <string_view>
+
+#include "aether/safe_stream/safe_stream.h"
+
+#include "tests/test-stream/mock_write_stream.h"
+
+#include "mock_bad_streams.h"
+#include "stream-test-ctx.h"
+
+#if defined AE_SAFE_STREAM_BENCH
+namespace ae::test_safe_stream_fec_bench {
+constexpr auto MakeConfig(std::uint8_t fec_group_size) {
+  return SafeStreamConfig{
+      8192,
+      2048,
+      100,
+      std::chrono::milliseconds{200},
+      std::chrono::milliseconds{0},
+      std::chrono::milliseconds{50},
+      fec_group_size,
+  };
+}
+
+static constexpr std::size_t kCapacity = 20 * 1024;
+static constexpr std::size_t kPacketSize = 512;
+static constexpr std::size_t kMessageSize = 2048;
+static constexpr std::size_t kMessageCount = 100;
+static constexpr auto kMessageInterval = std::chrono::milliseconds{50};
+// slow link with long round trip
+static constexpr std::size_t kBandwidth = 256 * 1024;
+static constexpr std::size_t kQueueSize = 64 * 1024;
+static constexpr auto kLatency = std::chrono::milliseconds{50};
+static constexpr auto kTimeout = std::chrono::seconds{60};
+
+using Ms = std::chrono::duration<double, std::milli>;
+
+/**
+ * \brief Measure latency from message write to its full receive.
+ */
+std::vector<Ms> MeasureLatency(std::uint8_t fec_group_size, float loss_rate) {
+  TestContext ctx;
+
+  auto config = MakeConfig(fec_group_size);
+  auto packet_loss = LostPacketsStream{ctx, loss_rate};
+  auto bottleneck = BottleneckStream{ctx, kBandwidth, kQueueSize, kLatency};
+  auto s_mock_stream = MockWriteStream{ctx, kPacketSize};
+  auto r_mock_stream = MockWriteStream{ctx, kPacketSize};
+
+  s_mock_stream.on_write_event().Subscribe(
+      [&](auto&& data) { r_mock_stream.WriteOut(data); });
+  r_mock_stream.on_write_event().Subscribe(
+      [&](auto&& data) { s_mock_stream.WriteOut(data); });
+
+  auto sender = SafeStream<kCapacity>{ctx, config};
+  auto receiver = SafeStream<kCapacity>{ctx, config};
+
+  // only data goes through the bad link, acks are returned directly
+  Tie(sender, packet_loss, bottleneck, s_mock_stream);
+  Tie(receiver, r_mock_stream);
+
+  std::vector<TimePoint> write_times;
+  std::vector<Ms> latencies;
+  std::size_t received_size = 0;
+  receiver.out_data_event().Subscribe([&](auto const& d) {
+    received_size += d.size();
+    auto now = Now();
+    // all the fully received messages
+    while ((latencies.size() < write_times.size()) &&
+           (received_size >= (latencies.size() + 1) * kMessageSize)) {
+      latencies.emplace_back(now - write_times[latencies.size()]);
+    }
+  });
+
+  auto const message = DataBuffer(kMessageSize, 0x42);
+  auto begin = Now();
+  auto next_write = begin;
+  while ((latencies.size() < kMessageCount) && ((Now() - begin) < kTimeout)) {
+    auto now = Now();
+    if ((write_times.size() < kMessageCount) && (now >= next_write)) {
+      write_times.push_back(now);
+      sender.Write(DataBuffer{message});
+      next_write += kMessageInterval;
+    }
+    ctx.Update(now);
+  }
+  TEST_ASSERT_EQUAL(kMessageCount, latencies.size());
+  return latencies;
+}
+
+void PrintLatency(std::string_view name, float loss_rate,
+                  std::vector<Ms> latencies) {
+  std::sort(std::begin(latencies), std::end(latencies));
+  auto percentile = [&](std::size_t p) {
+    return latencies[(latencies.size() - 1) * p / 100].count();
+  };
+  std::cout << "┌" << '\n'
+            << "│Bench: " << name << ", loss rate " << loss_rate
+            << std::setprecision(1) << std::fixed
+            << "\n│\tlatency p50: " << percentile(50) << " ms"
+            << "\n│\tlatency p90: " << percentile(90) << " ms"
+            << "\n│\tlatency p99: " << percentile(99) << " ms"
+            << "\n│\tlatency max: " << latencies.back().count() << " ms"
+            << "\n└" << std::endl;
+}
+
+void CompareLatency(float loss_rate) {
+  PrintLatency("ARQ", loss_rate, MeasureLatency(0, loss_rate));
+  PrintLatency("FEC group 4", loss_rate, MeasureLatency(4, loss_rate));
+}
+
+void test_LatencyNoLoss() { CompareLatency(0.0F); }
+
+void test_LatencyLowLoss() { CompareLatency(0.02F); }
+
+void test_LatencyHighLoss() { CompareLatency(0.1F); }
+
+}  // namespace ae::test_safe_stream_fec_bench
+#endif
+
+int test_safe_stream_fec_bench() {
+  UNITY_BEGIN();
+#if defined AE_SAFE_STREAM_BENCH
+  RUN_TEST(ae::test_safe_stream_fec_bench::test_LatencyNoLoss);
+  RUN_TEST(ae::test_safe_stream_fec_bench::test_LatencyLowLoss);
+  RUN_TEST(ae::test_safe_stream_fec_bench::test_LatencyHighLoss);
+#endif
+  return UNITY_END();
+}
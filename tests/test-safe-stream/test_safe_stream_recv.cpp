@@ -16,6 +16,7 @@
 
 #include <unity.h>
 
+#include <span>
 #include <vector>
 #include <optional>
 
@@ -62,12 +63,16 @@ class MockSendConfirmRepeat final : public ISendAckRepeat {
 
   struct RepeatRequestData {
     std::uint16_t index;
+    std::vector<SelectiveAckRange> received;
   };
 
   void SendAck(std::uint16_t index) override { ack_data = AckData{index}; }
 
-  void SendRepeatRequest(std::uint16_t index) override {
-    repeat_request_data = RepeatRequestData{index};
+  void SendRepeatRequest(
+      std::uint16_t index,
+      std::span<SelectiveAckRange const> received) override {
+    repeat_request_data = RepeatRequestData{
+        index, {std::begin(received), std::end(received)}};
   }
 
   void Reset() {
@@ -317,6 +322,15 @@ void test_RecvActionRequestRepeatOnMissing() {
   TEST_ASSERT_EQUAL(
       static_cast<std::uint16_t>(begin_offset + message1.data.size()),
       static_cast<std::uint16_t>(mock_sender.repeat_request_data->index));
+  // and report already received chunk 3
+  TEST_ASSERT_EQUAL(1, mock_sender.repeat_request_data->received.size());
+  TEST_ASSERT_EQUAL(
+      static_cast<std::uint16_t>(begin_offset + message3.delta_offset),
+      mock_sender.repeat_request_data->received[0].left);
+  TEST_ASSERT_EQUAL(
+      static_cast<std::uint16_t>(begin_offset + message3.delta_offset +
+                                 message3.data.size() - 1),
+      mock_sender.repeat_request_data->received[0].right);
 }
 
 void test_RecvActionRepeatDataHandling() {
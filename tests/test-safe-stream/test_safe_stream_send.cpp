@@ -16,10 +16,13 @@
 
 #include <unity.h>
 
+#include <memory>
 #include <optional>
 
 #include "aether/config.h"
+#include "aether/mstream.h"
 #include "aether/ae_context.h"
+#include "aether/mstream_buffers.h"
 #include "aether/safe_stream/safe_stream_config.h"
 #include "aether/safe_stream/details/safe_stream_send_action.h"
 
@@ -62,6 +65,7 @@ class MockSendDataPush final : public ISendDataPush {
 
   WriteAction& PushData(std::uint16_t index,
                         DataMessage&& data_message) override {
+    pushed_bytes += data_message.data.size();
     send_data = SendData{index, std::move(data_message)};
     if (!wa_ || wa_->is_finished()) {
       wa_.emplace(context_);
@@ -70,8 +74,17 @@ class MockSendDataPush final : public ISendDataPush {
     return *wa_;
   }
 
+  void PushParity(std::uint16_t /* index */,
+                  FecParityMessage&& message) override {
+    ++parity_count;
+    parity_bytes += message.parity.size();
+  }
+
   AeContext context_;
   std::optional<SendData> send_data;
+  std::size_t pushed_bytes{};
+  std::size_t parity_count{};
+  std::size_t parity_bytes{};
   std::optional<MockStreamWriteAction> wa_;
 };
 
@@ -107,6 +120,25 @@ static constexpr std::string_view buffer_ballad =
     "until the network sets them free to travel to destiny.";
 
 // Helper function to create data of specific size
+class SentCountControl final : public ICongestionControl {
+ public:
+  explicit SentCountControl(std::size_t window_size)
+      : window_size_{window_size} {}
+
+  std::size_t window() const override { return window_size_; }
+  void OnSent(std::size_t size, TimePoint /* current_time */) override {
+    sent_size += size;
+  }
+  void OnAcked(std::size_t /* size */, Duration /* rtt */,
+               TimePoint /* current_time */) override {}
+  void OnLost(TimePoint /* current_time */) override {}
+
+  std::size_t sent_size{};
+
+ private:
+  std::size_t window_size_;
+};
+
 static auto CreateTestData(std::size_t size) {
   std::vector<std::uint8_t> data(size);
   for (std::size_t i = 0; i < size; ++i) {
@@ -172,6 +204,52 @@ void test_SendActionCreateAndSend() {
   TEST_ASSERT_FALSE(is_error);
 }
 
+void test_SendActionPushedBytes() {
+  TestContext ctx;
+
+  auto send_data_push = MockSendDataPush{ctx};
+  auto sender = Sender{ctx, send_data_push, config};
+  sender.SetMaxPayload(config.max_packet_size);
+
+  auto send_data = sender.SendData(ToSpan(retry_humor));
+  TEST_ASSERT_TRUE(send_data.IsOk());
+  // nothing pushed until update
+  TEST_ASSERT_EQUAL(0, send_data_push.pushed_bytes);
+
+  ctx.Update(Now());
+  TEST_ASSERT(send_data_push.send_data.has_value());
+  TEST_ASSERT_EQUAL(retry_humor.size(), send_data_push.pushed_bytes);
+
+  // each repeat pushes the data once again
+  auto timeout_time = Now() + config.wait_ack_timeout + kTick;
+  ctx.Update(timeout_time);
+  ctx.Update(timeout_time + kTick);
+  TEST_ASSERT_EQUAL(1, send_data_push.send_data->data_message.repeat_count);
+  TEST_ASSERT_EQUAL(2 * retry_humor.size(), send_data_push.pushed_bytes);
+}
+
+void test_DataSpansSerialization() {
+  auto const data = ToDataBuffer(packet_poetry);
+  auto const split = data.size() / 3;
+
+  auto expected = DataBuffer{};
+  {
+    auto writer = VectorWriter<>{expected};
+    auto stream = omstream{writer};
+    stream << data;
+  }
+  auto spans_data = DataBuffer{};
+  {
+    auto writer = VectorWriter<>{spans_data};
+    auto stream = omstream{writer};
+    stream << DataSpans{std::span{data}.subspan(0, split),
+                        std::span{data}.subspan(split)};
+  }
+  TEST_ASSERT_EQUAL(expected.size(), spans_data.size());
+  TEST_ASSERT_EQUAL_UINT8_ARRAY(expected.data(), spans_data.data(),
+                                expected.size());
+}
+
 void test_SendActionRepeatOnTimeout() {
   TestContext ctx;
 
@@ -682,6 +760,43 @@ void test_SendDataAndStop() {
   TEST_ASSERT_TRUE(sent);
 }
 
+void test_SendParityInWindow() {
+  // repeat is far after the test end
+  constexpr auto fec_config = SafeStreamConfig{
+      500,
+      100,
+      3,
+      std::chrono::milliseconds{1000},
+      std::chrono::milliseconds{25},
+      std::chrono::milliseconds{1000},
+      5,
+  };
+
+  TestContext ctx;
+
+  auto send_data_push = MockSendDataPush{ctx};
+  auto sender = Sender{ctx, send_data_push, fec_config};
+  auto control = std::make_unique<SentCountControl>(fec_config.window_size);
+  auto const& sent_count = *control;
+  sender.SetCongestionControl(std::move(control));
+  sender.SetMaxPayload(fec_config.max_packet_size);
+
+  auto send_data = sender.SendData(CreateTestData(1000));
+  TEST_ASSERT_TRUE(send_data.IsOk());
+
+  auto epoch = Now();
+  for (auto t = epoch; t < epoch + std::chrono::milliseconds{100}; t += kTick) {
+    ctx.Update(t);
+  }
+
+  // the window is filled before the group of 5 chunks, so it's closed early
+  TEST_ASSERT_GREATER_OR_EQUAL(1, send_data_push.parity_count);
+  // parity is charged to the congestion control and fits the window
+  TEST_ASSERT_EQUAL(send_data_push.pushed_bytes + send_data_push.parity_bytes,
+                    sent_count.sent_size);
+  TEST_ASSERT_LESS_OR_EQUAL(fec_config.window_size, sent_count.sent_size);
+}
+
 }  // namespace ae::test_safe_stream_send
 
 int test_safe_stream_send() {
@@ -690,11 +805,14 @@ int test_safe_stream_send() {
   RUN_TEST(ae::test_safe_stream_send::
                test_SendActionWindowSizeWithMultipleWaitingPackets);
   RUN_TEST(ae::test_safe_stream_send::test_SendActionRepeatOnTimeout);
+  RUN_TEST(ae::test_safe_stream_send::test_SendActionPushedBytes);
+  RUN_TEST(ae::test_safe_stream_send::test_DataSpansSerialization);
   RUN_TEST(ae::test_safe_stream_send::test_SendActionErrorOnMaxRepeatExceeded);
   RUN_TEST(ae::test_safe_stream_send::test_SendActionWindowSizeLimit);
   RUN_TEST(ae::test_safe_stream_send::test_SendActionRequestRepeat);
   RUN_TEST(ae::test_safe_stream_send::test_SendActionMultipleDataQueueing);
   RUN_TEST(ae::test_safe_stream_send::test_SendDataBiggerThanMaxPacketSize);
   RUN_TEST(ae::test_safe_stream_send::test_SendDataAndStop);
+  RUN_TEST(ae::test_safe_stream_send::test_SendParityInWindow);
   return UNITY_END();
 }
@@ -0,0 +1,122 @@
+/*
+ * Copyright 2026 Aethernet Inc.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <unity.h>
+
+#include <chrono>
+#include <cstdint>
+#include <iomanip>
+#include <iostream>
+
+#include "aether/safe_stream/safe_stream.h"
+
+#include "tests/test-stream/mock_write_stream.h"
+
+#include "stream-test-ctx.h"
+
+#if defined AE_SAFE_STREAM_BENCH
+namespace ae::test_safe_stream_send_bench {
+constexpr auto config = SafeStreamConfig{
+    8192,
+    400,
+    100,
+    std::chrono::milliseconds{50},
+    std::chrono::milliseconds{0},
+    std::chrono::milliseconds{10},
+};
+
+static constexpr std::size_t kCapacity = 64 * 1024;
+static constexpr std::size_t kTotalSize = 16 * 1024 * 1024;
+// max size of data written but not received yet
+static constexpr std::size_t kMaxWrittenSize = 16 * 1024;
+static constexpr std::size_t kPacketSize = 1400;
+static constexpr auto kTimeout = std::chrono::seconds{60};
+
+void MeasureThroughput(std::size_t message_size) {
+  TestContext ctx;
+
+  auto s_mock_stream = MockWriteStream{ctx, kPacketSize};
+  auto r_mock_stream = MockWriteStream{ctx, kPacketSize};
+
+  // the sender side carries only data messages, count it as packet copies
+  std::size_t sent_size = 0;
+  s_mock_stream.on_write_event().Subscribe([&](auto&& data) {
+    sent_size += data.size();
+    r_mock_stream.WriteOut(data);
+  });
+  r_mock_stream.on_write_event().Subscribe(
+      [&](auto&& data) { s_mock_stream.WriteOut(data); });
+
+  auto sender = SafeStream<kCapacity>{ctx, config};
+  auto receiver = SafeStream<kCapacity>{ctx, config};
+
+  Tie(sender, s_mock_stream);
+  Tie(receiver, r_mock_stream);
+
+  std::size_t written_size = 0;
+  std::size_t received_size = 0;
+  receiver.out_data_event().Subscribe(
+      [&](auto const& d) { received_size += d.size(); });
+
+  auto const message = DataBuffer(message_size, 0x42);
+  auto begin = Now();
+  while ((received_size < kTotalSize) && ((Now() - begin) < kTimeout)) {
+    while ((written_size < kTotalSize) &&
+           ((written_size - received_size) < kMaxWrittenSize)) {
+      sender.Write(DataBuffer{message});
+      written_size += message.size();
+    }
+    ctx.Update(Now());
+  }
+  auto duration = std::chrono::duration_cast<std::chrono::duration<double>>(
+      Now() - begin);
+  TEST_ASSERT_EQUAL(kTotalSize, received_size);
+
+  // once to the sending buffer and once to the packets with headers and
+  // repeats
+  TEST_ASSERT_GREATER_OR_EQUAL(kTotalSize, sent_size);
+  auto copies_per_byte = static_cast<double>(written_size + sent_size) /
+                         static_cast<double>(received_size);
+
+  std::cout << "┌" << '\n'
+            << "│Bench: send " << kTotalSize << " bytes by " << message_size
+            << " bytes messages"
+            << "\n│\tthroughput: " << std::setprecision(1) << std::fixed
+            << (static_cast<double>(received_size) / duration.count() /
+                (1024.0 * 1024.0))
+            << " MiB/s"
+            << "\n│\tcopies per payload byte: " << std::setprecision(2)
+            << copies_per_byte << "\n└" << std::endl;
+}
+
+void test_ThroughputSmallMessages() { MeasureThroughput(64); }
+
+void test_ThroughputPacketMessages() { MeasureThroughput(kPacketSize); }
+
+void test_ThroughputBigMessages() { MeasureThroughput(8 * 1024); }
+
+}  // namespace ae::test_safe_stream_send_bench
+#endif
+
+int test_safe_stream_send_bench() {
+  UNITY_BEGIN();
+#if defined AE_SAFE_STREAM_BENCH
+  RUN_TEST(ae::test_safe_stream_send_bench::test_ThroughputSmallMessages);
+  RUN_TEST(ae::test_safe_stream_send_bench::test_ThroughputPacketMessages);
+  RUN_TEST(ae::test_safe_stream_send_bench::test_ThroughputBigMessages);
+#endif
+  return UNITY_END();
+}
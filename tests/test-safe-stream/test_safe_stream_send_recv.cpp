@@ -16,6 +16,8 @@
 
 #include <unity.h>
 
+#include <span>
+#include <vector>
 #include <optional>
 
 #include "aether/safe_stream/safe_stream_config.h"
@@ -54,20 +56,31 @@ class TestSafeStreamActionsTransport {
     MakePushData(begin, std::move(data_message));
   }
 
+  virtual void PushParity(std::uint16_t begin, FecParityMessage message) {
+    MakePushParity(begin, std::move(message));
+  }
+
   virtual void SendAck(std::uint16_t offset) { MakeSendAck(offset); }
 
-  virtual void SendRepeatRequest(std::uint16_t offset) {
-    MakeSendRepeatRequest(offset);
+  virtual void SendRepeatRequest(
+      std::uint16_t offset, std::span<SelectiveAckRange const> received) {
+    MakeSendRepeatRequest(offset, received);
   }
 
   void MakePushData(std::uint16_t begin, DataMessage data_message) {
     recveiver_->PushData(begin, std::move(data_message));
   }
 
+  void MakePushParity(std::uint16_t begin, FecParityMessage message) {
+    recveiver_->PushParity(begin, std::move(message));
+  }
+
   void MakeSendAck(std::uint16_t offset) { sender_->Acknowledge(offset); }
 
-  void MakeSendRepeatRequest(std::uint16_t offset) {
+  void MakeSendRepeatRequest(std::uint16_t offset,
+                             std::span<SelectiveAckRange const> received) {
     sender_->RequestRepeat(offset);
+    sender_->SelectiveAcknowledge(received);
   }
 
   Sender* sender_;
@@ -121,6 +134,10 @@ class MockSendDataPush : public ISendDataPush {
     return *dswa_;
   }
 
+  void PushParity(std::uint16_t begin, FecParityMessage&& message) override {
+    transport_->PushParity(begin, std::move(message));
+  }
+
   AeContext context_;
   TestSafeStreamActionsTransport* transport_{};
   std::optional<DoneStreamWriteAction> dswa_;
@@ -135,8 +152,10 @@ class MockSendAckRepeat : public ISendAckRepeat {
   }
 
   void SendAck(std::uint16_t offset) override { transport_->SendAck(offset); }
-  void SendRepeatRequest(std::uint16_t offset) override {
-    transport_->SendRepeatRequest(offset);
+  void SendRepeatRequest(
+      std::uint16_t offset,
+      std::span<SelectiveAckRange const> received) override {
+    transport_->SendRepeatRequest(offset, received);
   }
 
   TestSafeStreamActionsTransport* transport_{};
@@ -340,6 +359,153 @@ void test_SafeStreamReInitReceiver() {
   TEST_ASSERT_EQUAL_STRING_LEN(test_data.data(), received.data(),
                                test_data.size());
 }
+
+class LossyTransport : public TestSafeStreamActionsTransport {
+ public:
+  using TestSafeStreamActionsTransport::TestSafeStreamActionsTransport;
+
+  void PushData(std::uint16_t begin, DataMessage data_message) override {
+    sent_bytes += data_message.data.size();
+    // lose the first chunk once
+    if (!lost && (data_message.delta_offset == 0)) {
+      lost = true;
+      return;
+    }
+    MakePushData(begin, std::move(data_message));
+  }
+
+  bool lost{};
+  std::size_t sent_bytes{};
+};
+
+/**
+ * \brief Test only lost data is repeated if the receiver reported received
+ * ranges.
+ */
+void test_SafeStreamSelectiveAck() {
+  // sender's repeat timeout is greater than receiver's repeat request
+  constexpr auto sack_config = SafeStreamConfig{
+      4096,
+      100,
+      3,
+      std::chrono::milliseconds{1000},
+      std::chrono::milliseconds{25},
+      std::chrono::milliseconds{80},
+  };
+  static constexpr std::size_t kChunkCount = 5;
+
+  TestContext ctx;
+
+  bool acked{};
+  DataBuffer received{};
+  IndexRangeType expected_range{};
+
+  auto send_transport = MockSendDataPush{ctx};
+  auto recv_transport = MockSendAckRepeat{};
+
+  auto sender = Sender{ctx, send_transport, sack_config};
+  sender.acknowledged_event().Subscribe([&](auto buffer_begin, auto end) {
+    if (IndexComparable{expected_range.right, buffer_begin} <= end) {
+      acked = true;
+    }
+  });
+  sender.SetMaxPayload(sack_config.max_packet_size);
+  auto receiver = Receiver{ctx, recv_transport, sack_config};
+
+  auto sender_to_receiver = LossyTransport{sender, receiver};
+  send_transport.Link(sender_to_receiver);
+  recv_transport.Link(sender_to_receiver);
+
+  receiver.receive_event().Subscribe([&](auto const& data) {
+    received.insert(std::end(received), std::begin(data), std::end(data));
+  });
+
+  auto send_data = DataBuffer(kChunkCount * sack_config.max_packet_size);
+  for (std::size_t i = 0; i < send_data.size(); ++i) {
+    send_data[i] = static_cast<std::uint8_t>(i);
+  }
+  auto send_res = sender.SendData(send_data);
+  TEST_ASSERT_TRUE(send_res.IsOk());
+  expected_range = send_res.value();
+
+  auto epoch = Now();
+  for (auto t = epoch; t < epoch + std::chrono::milliseconds{300}; t += kTick) {
+    ctx.Update(t);
+  }
+
+  TEST_ASSERT_TRUE(sender_to_receiver.lost);
+  TEST_ASSERT_TRUE(acked);
+  TEST_ASSERT_EQUAL(send_data.size(), received.size());
+  TEST_ASSERT_EQUAL_UINT8_ARRAY(send_data.data(), received.data(),
+                                send_data.size());
+  // only the lost chunk is repeated
+  TEST_ASSERT_EQUAL(send_data.size() + sack_config.max_packet_size,
+                    sender_to_receiver.sent_bytes);
+}
+
+/**
+ * \brief Test lost data is restored by parity without repeat.
+ */
+void test_SafeStreamFecRestore() {
+  // repeat is far after the test end
+  constexpr auto fec_config = SafeStreamConfig{
+      4096,
+      100,
+      3,
+      std::chrono::milliseconds{1000},
+      std::chrono::milliseconds{25},
+      std::chrono::milliseconds{1000},
+      5,
+  };
+  static constexpr std::size_t kChunkCount = 5;
+
+  TestContext ctx;
+
+  bool acked{};
+  DataBuffer received{};
+  IndexRangeType expected_range{};
+
+  auto send_transport = MockSendDataPush{ctx};
+  auto recv_transport = MockSendAckRepeat{};
+
+  auto sender = Sender{ctx, send_transport, fec_config};
+  sender.acknowledged_event().Subscribe([&](auto buffer_begin, auto end) {
+    if (IndexComparable{expected_range.right, buffer_begin} <= end) {
+      acked = true;
+    }
+  });
+  sender.SetMaxPayload(fec_config.max_packet_size);
+  auto receiver = Receiver{ctx, recv_transport, fec_config};
+
+  auto sender_to_receiver = LossyTransport{sender, receiver};
+  send_transport.Link(sender_to_receiver);
+  recv_transport.Link(sender_to_receiver);
+
+  receiver.receive_event().Subscribe([&](auto const& data) {
+    received.insert(std::end(received), std::begin(data), std::end(data));
+  });
+
+  auto send_data = DataBuffer(kChunkCount * fec_config.max_packet_size);
+  for (std::size_t i = 0; i < send_data.size(); ++i) {
+    send_data[i] = static_cast<std::uint8_t>(i * 7);
+  }
+  auto send_res = sender.SendData(send_data);
+  TEST_ASSERT_TRUE(send_res.IsOk());
+  expected_range = send_res.value();
+
+  auto epoch = Now();
+  for (auto t = epoch; t < epoch + std::chrono::milliseconds{100}; t += kTick) {
+    ctx.Update(t);
+  }
+
+  TEST_ASSERT_TRUE(sender_to_receiver.lost);
+  TEST_ASSERT_TRUE(acked);
+  TEST_ASSERT_EQUAL(send_data.size(), received.size());
+  TEST_ASSERT_EQUAL_UINT8_ARRAY(send_data.data(), received.data(),
+                                send_data.size());
+  // nothing is repeated
+  TEST_ASSERT_EQUAL(send_data.size(), sender_to_receiver.sent_bytes);
+}
 }  // namespace ae::test_safe_stream_send_recv
 
 int test_safe_stream_send_recv() {
@@ -347,5 +513,7 @@ int test_safe_stream_send_recv() {
   RUN_TEST(ae::test_safe_stream_send_recv::test_SafeStreamInitHandshake);
   RUN_TEST(ae::test_safe_stream_send_recv::test_SafeStreamReInitSender);
   RUN_TEST(ae::test_safe_stream_send_recv::test_SafeStreamReInitReceiver);
+  RUN_TEST(ae::test_safe_stream_send_recv::test_SafeStreamSelectiveAck);
+  RUN_TEST(ae::test_safe_stream_send_recv::test_SafeStreamFecRestore);
   return UNITY_END();
 }
@@ -16,11 +16,14 @@
 
 #include <unity.h>
 
+#include <limits>
+
 #include "aether/safe_stream/details/sending_chunk_list.h"
 
 namespace ae::test_sending_chunk_list {
 
 static constexpr std::size_t kCapacity = 1024;
+static constexpr std::size_t kWindowSize = 500;
 using IndexType = RingIndex<kCapacity>;
 using IndexRangeType = RingIndexRange<IndexType>;
 using ChunkList = SendingChunkList<IndexType>;
@@ -28,7 +31,7 @@ using ChunkList = SendingChunkList<IndexType>;
 void test_SendingChunkList() {
   constexpr auto begin = IndexType{0};
 
-  ChunkList chunk_list{begin};
+  ChunkList chunk_list{begin, kWindowSize};
 
   // add three chunks
   chunk_list.Register(IndexRangeType{IndexType{0}, IndexType{5}}, Now());
@@ -58,7 +61,7 @@ void test_SendingChunkList() {
 void test_SendingChunkListSelect() {
   constexpr auto begin = IndexType{0};
 
-  ChunkList chunk_list{begin};
+  ChunkList chunk_list{begin, kWindowSize};
 
   auto* s0 = chunk_list.Select(IndexRangeType{IndexType{6}, IndexType{10}});
   TEST_ASSERT_NULL(s0);
@@ -83,7 +86,7 @@ void test_SendingChunkListSelect() {
 void test_SendingChunkListRemoving() {
   constexpr auto begin = IndexType{0};
 
-  ChunkList chunk_list{begin};
+  ChunkList chunk_list{begin, kWindowSize};
 
   chunk_list.Register(IndexRangeType{IndexType{0}, IndexType{10}}, Now());
   TEST_ASSERT_FALSE(chunk_list.empty());
@@ -110,6 +113,121 @@ void test_SendingChunkListRemoving() {
   TEST_ASSERT_TRUE(chunk_list.empty());
 }
 
+void test_SendingChunkListSelectiveAck() {
+  constexpr auto begin = IndexType{0};
+
+  ChunkList chunk_list{begin, kWindowSize};
+
+  chunk_list.Register(IndexRangeType{IndexType{0}, IndexType{9}}, Now());
+  chunk_list.Register(IndexRangeType{IndexType{10}, IndexType{19}}, Now());
+  chunk_list.Register(IndexRangeType{IndexType{20}, IndexType{29}}, Now());
+  chunk_list.Register(IndexRangeType{IndexType{30}, IndexType{39}}, Now());
+  chunk_list.Register(IndexRangeType{IndexType{40}, IndexType{49}}, Now());
+
+  // nothing acknowledged
+  TEST_ASSERT_EQUAL(5, chunk_list.SkipAcknowledged(IndexType{5}));
+  TEST_ASSERT_EQUAL(std::numeric_limits<std::size_t>::max(),
+                    chunk_list.UnacknowledgedSize(IndexType{5}));
+
+  chunk_list.Acknowledge(IndexRangeType{IndexType{30}, IndexType{39}});
+  chunk_list.Acknowledge(IndexRangeType{IndexType{10}, IndexType{19}});
+  // adjacent ranges are merged
+  chunk_list.Acknowledge(IndexRangeType{IndexType{20}, IndexType{29}});
+
+  // acknowledged chunks are not waiting anymore
+  TEST_ASSERT_NULL(
+      chunk_list.Select(IndexRangeType{IndexType{10}, IndexType{39}}));
+  TEST_ASSERT_NOT_NULL(
+      chunk_list.Select(IndexRangeType{IndexType{40}, IndexType{49}}));
+  TEST_ASSERT_EQUAL(0, chunk_list.front().range.left);
+
+  TEST_ASSERT_EQUAL(0, chunk_list.SkipAcknowledged(IndexType{0}));
+  TEST_ASSERT_EQUAL(10, chunk_list.UnacknowledgedSize(IndexType{0}));
+  TEST_ASSERT_EQUAL(40, chunk_list.SkipAcknowledged(IndexType{10}));
+  TEST_ASSERT_EQUAL(40, chunk_list.SkipAcknowledged(IndexType{25}));
+  TEST_ASSERT_EQUAL(std::numeric_limits<std::size_t>::max(),
+                    chunk_list.UnacknowledgedSize(IndexType{40}));
+
+  // cumulative ack trims acknowledged ranges
+  chunk_list.RemoveUpTo(IndexType{14});
+  chunk_list.set_buffer_begin(IndexType{15});
+  TEST_ASSERT_EQUAL(40, chunk_list.SkipAcknowledged(IndexType{15}));
+  chunk_list.RemoveUpTo(IndexType{44});
+  chunk_list.set_buffer_begin(IndexType{45});
+  TEST_ASSERT_EQUAL(45, chunk_list.SkipAcknowledged(IndexType{45}));
+  TEST_ASSERT_EQUAL(std::numeric_limits<std::size_t>::max(),
+                    chunk_list.UnacknowledgedSize(IndexType{45}));
+}
+
+void test_SendingChunkListResplit() {
+  constexpr auto begin = IndexType{0};
+
+  ChunkList chunk_list{begin, kWindowSize};
+  chunk_list.Register(IndexRangeType{IndexType{0}, IndexType{9}}, Now());
+  chunk_list.Register(IndexRangeType{IndexType{10}, IndexType{19}}, Now());
+  chunk_list.Register(IndexRangeType{IndexType{20}, IndexType{29}}, Now());
+
+  // partially acknowledged chunk is kept from the acknowledged end
+  chunk_list.RemoveUpTo(IndexType{14});
+  chunk_list.set_buffer_begin(IndexType{15});
+  {
+    auto& front_chunk = chunk_list.front();
+    TEST_ASSERT_EQUAL(15, front_chunk.range.left);
+    TEST_ASSERT_EQUAL(19, front_chunk.range.right);
+  }
+
+  // repeat with bigger chunk replaces the chunks started inside it
+  chunk_list.Register(IndexRangeType{IndexType{15}, IndexType{24}}, Now());
+  auto& ch = chunk_list.front();
+  TEST_ASSERT_EQUAL(15, ch.range.left);
+  TEST_ASSERT_EQUAL(24, ch.range.right);
+  TEST_ASSERT_EQUAL_PTR(
+      &ch, chunk_list.Select(IndexRangeType{IndexType{15}, IndexType{29}}));
+  chunk_list.RemoveUpTo(IndexType{24});
+  chunk_list.set_buffer_begin(IndexType{25});
+  TEST_ASSERT_TRUE(chunk_list.empty());
+}
+
+void test_SendingChunkListFull() {
+  static constexpr std::size_t kMaxChunks = 4;
+  constexpr auto begin = IndexType{kCapacity - 20};
+
+  SendingChunkList<IndexType, kMaxChunks> chunk_list{begin, kWindowSize};
+  for (std::size_t i = 0; i < kMaxChunks; ++i) {
+    auto& chunk = chunk_list.Register(
+        IndexRangeType{begin + (i * 10), begin + (i * 10) + 9}, Now());
+    chunk.repeat_count++;
+  }
+  TEST_ASSERT_EQUAL(kMaxChunks, chunk_list.size());
+
+  // no free slots, the new chunk is joined with the last one
+  auto& joined = chunk_list.Register(
+      IndexRangeType{begin + 40, begin + 49}, Now());
+  TEST_ASSERT_EQUAL(kMaxChunks, chunk_list.size());
+  TEST_ASSERT_EQUAL(begin + 30, joined.range.left);
+  TEST_ASSERT_EQUAL(begin + 49, joined.range.right);
+  // the last chunk was sent once
+  TEST_ASSERT_EQUAL(1, joined.repeat_count);
+  TEST_ASSERT_EQUAL(begin, chunk_list.front().range.left);
+
+  // repeat from the middle of a chunk cuts it
+  chunk_list.RemoveUpTo(begin + 9);
+  chunk_list.set_buffer_begin(begin + 10);
+  auto& repeated = chunk_list.Register(
+      IndexRangeType{begin + 15, begin + 24}, Now());
+  // the chunk started inside is replaced
+  TEST_ASSERT_EQUAL(1, repeated.repeat_count);
+  TEST_ASSERT_EQUAL(kMaxChunks - 1, chunk_list.size());
+  {
+    auto* cut = chunk_list.Select(IndexRangeType{begin + 10, begin + 14});
+    TEST_ASSERT_NOT_NULL(cut);
+    TEST_ASSERT_EQUAL(begin + 14, cut->range.right);
+  }
+
+  chunk_list.RemoveUpTo(begin + 49);
+  chunk_list.set_buffer_begin(begin + 50);
+  TEST_ASSERT_TRUE(chunk_list.empty());
+}
 }  // namespace ae::test_sending_chunk_list
 
 int test_sending_chunk_list() {
@@ -117,5 +235,8 @@ int test_sending_chunk_list() {
   RUN_TEST(ae::test_sending_chunk_list::test_SendingChunkList);
   RUN_TEST(ae::test_sending_chunk_list::test_SendingChunkListSelect);
   RUN_TEST(ae::test_sending_chunk_list::test_SendingChunkListRemoving);
+  RUN_TEST(ae::test_sending_chunk_list::test_SendingChunkListSelectiveAck);
+  RUN_TEST(ae::test_sending_chunk_list::test_SendingChunkListResplit);
+  RUN_TEST(ae::test_sending_chunk_list::test_SendingChunkListFull);
   return UNITY_END();
 }
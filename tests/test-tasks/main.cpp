@@ -23,6 +23,12 @@ extern int test_task_queues();
 extern int test_task_manager();
 extern int test_manual_task_scheduler();
 extern int test_task_subscriptions();
+extern int test_timer_wheel_queue();
+extern int test_timer_wheel_bench();
+extern int test_task_submission();
+extern int test_task_submission_bench();
+extern int test_sharded_task_executor();
+extern int test_sharded_task_executor_bench();
 
 int main() {
   int res{};
@@ -30,5 +36,14 @@ int main() {
   res += test_task_manager();
   res += test_manual_task_scheduler();
   res += test_task_subscriptions();
+  res += test_timer_wheel_queue();
+  res += test_task_submission();
+  res += test_sharded_task_executor();
+
+#if defined AE_TASKS_BENCH
+  res += test_timer_wheel_bench();
+  res += test_task_submission_bench();
+  res += test_sharded_task_executor_bench();
+#endif
   return res;
 }
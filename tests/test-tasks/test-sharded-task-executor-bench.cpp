@@ -0,0 +1,106 @@
+/*
+ * Copyright 2026 Aethernet Inc.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <unity.h>
+
+#include <array>
+#include <atomic>
+#include <chrono>
+#include <memory>
+#include <thread>
+#include <cstdint>
+#include <algorithm>
+
+#include "aether/tasks/details/sharded_task_executor.h"
+
+#include "tests/benchmarking.h"
+
+namespace ae::test_sharded_task_executor_bench {
+using namespace std::chrono_literals;
+
+#if !defined NDEBUG
+static constexpr std::size_t kTaskCount = 20'000;
+#else
+static constexpr std::size_t kTaskCount = 200'000;
+#endif
+static constexpr std::size_t kClientCount = 8;
+// emulate message processing of a client
+static constexpr std::size_t kWorkIterations = 2000;
+
+using Scheduler = ManualTaskScheduler<TaskManagerConf<128>>;
+
+// each client re-posts its message task to its own shard
+struct BenchClient {
+  void Post() {
+    scheduler->Task([this]() { Process(); });
+  }
+
+  void Process() {
+    for (std::size_t i = 0; i < kWorkIterations; ++i) {
+      state = (state * 6364136223846793005ULL) + 1442695040888963407ULL;
+    }
+    if (++processed < (kTaskCount / kClientCount)) {
+      Post();
+    } else {
+      done->fetch_add(1, std::memory_order::release);
+    }
+  }
+
+  Scheduler* scheduler;
+  std::atomic_size_t* done;
+  std::size_t processed{};
+  std::uint64_t state{};
+};
+
+void RunClients(std::size_t shard_count, std::size_t worker_count) {
+  auto executor =
+      std::make_unique<ShardedTaskExecutor<Scheduler>>(shard_count,
+                                                        worker_count);
+  std::atomic_size_t done{};
+  std::array<BenchClient, kClientCount> clients;
+
+  tests::BenchmarkFunc(
+      [&](auto) {
+        for (std::size_t i = 0; i < kClientCount; ++i) {
+          clients[i].scheduler = &executor->shard(i);
+          clients[i].done = &done;
+          clients[i].Post();
+        }
+        while (done.load(std::memory_order::acquire) < kClientCount) {
+          std::this_thread::sleep_for(100us);
+        }
+      },
+      1, kClientCount, " clients process ", kTaskCount, " messages on ",
+      executor->shard_count(), " shards by ", executor->worker_count(),
+      " workers");
+  TEST_ASSERT_EQUAL(kClientCount, done.load());
+}
+
+void test_ShardedExecutorBench() {
+  auto const cores = std::max(1U, std::thread::hardware_concurrency());
+  // one shard is the same as the single Aether scheduler
+  RunClients(1, 1);
+  RunClients(kClientCount, 2);
+  RunClients(kClientCount, cores);
+}
+
+}  // namespace ae::test_sharded_task_executor_bench
+
+int test_sharded_task_executor_bench() {
+  UNITY_BEGIN();
+  RUN_TEST(ae::test_sharded_task_executor_bench::test_ShardedExecutorBench);
+  return UNITY_END();
+}
@@ -0,0 +1,143 @@
+/*
+ * Copyright 2026 Aethernet Inc.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <unity.h>
+
+#include <array>
+#include <atomic>
+#include <chrono>
+#include <thread>
+
+#include "aether/tasks/details/sharded_task_executor.h"
+
+namespace ae::test_sharded_task_executor {
+using namespace std::chrono_literals;
+using TimePoint = std::chrono::system_clock::time_point;
+using Scheduler = ManualTaskScheduler<TaskManagerConf<100>>;
+
+template <typename Pred>
+bool WaitFor(Pred&& pred, std::chrono::milliseconds timeout = 5s) {
+  auto until = TimePoint::clock::now() + timeout;
+  while (!pred()) {
+    if (TimePoint::clock::now() > until) {
+      return false;
+    }
+    std::this_thread::sleep_for(1ms);
+  }
+  return true;
+}
+
+void test_TasksInvoked() {
+  static constexpr auto kShards = 4;
+  static constexpr auto kCount = 50;
+  auto executor = ShardedTaskExecutor<Scheduler>{kShards, 2};
+  TEST_ASSERT_EQUAL(kShards, executor.shard_count());
+  TEST_ASSERT_EQUAL(2, executor.worker_count());
+
+  std::atomic_int invoked{};
+  for (int i = 0; i < kCount; ++i) {
+    for (std::size_t s = 0; s < kShards; ++s) {
+      while (executor.shard(s).Task([&]() { invoked++; }) == nullptr) {
+        std::this_thread::yield();
+      }
+    }
+  }
+  TEST_ASSERT_TRUE(WaitFor([&]() { return invoked == kShards * kCount; }));
+}
+
+void test_DelayedTasksInvoked() {
+  auto executor = ShardedTaskExecutor<Scheduler>{3, 2};
+
+  std::atomic_int invoked{};
+  auto before = TimePoint::clock::now();
+  for (std::size_t s = 0; s < executor.shard_count(); ++s) {
+    executor.shard(s).DelayedTask([&]() { invoked++; }, 20ms);
+  }
+  TEST_ASSERT_TRUE(WaitFor([&]() { return invoked == 3; }));
+  TEST_ASSERT_TRUE((TimePoint::clock::now() - before) >= 20ms);
+}
+
+void test_ShardTasksSerialized() {
+  static constexpr auto kShards = 2;
+  static constexpr auto kCount = 2000;
+  auto executor = ShardedTaskExecutor<Scheduler>{kShards, 4};
+
+  struct ShardState {
+    std::atomic_bool running{};
+    std::atomic_bool overlapped{};
+    int counter{};  // not atomic, protected by the shard
+  };
+  std::array<ShardState, kShards> states;
+  std::atomic_int done{};
+
+  for (std::size_t s = 0; s < kShards; ++s) {
+    for (int i = 0; i < kCount; ++i) {
+      while (executor.shard(s).Task([&, s]() {
+        auto& state = states[s];
+        if (state.running.exchange(true)) {
+          state.overlapped = true;
+        }
+        state.counter++;
+        state.running = false;
+        done++;
+      }) == nullptr) {
+        std::this_thread::yield();
+      }
+    }
+  }
+  TEST_ASSERT_TRUE(WaitFor([&]() { return done == kShards * kCount; }));
+  for (auto const& state : states) {
+    TEST_ASSERT_FALSE(state.overlapped.load());
+    TEST_ASSERT_EQUAL(kCount, state.counter);
+  }
+}
+
+void test_IdleWorkerStealsShard() {
+  // worker 0 starts from shards 0, 1, worker 1 from shards 2, 3
+  auto executor = ShardedTaskExecutor<Scheduler>{4, 2};
+
+  std::atomic_bool blocked{};
+  std::atomic_bool stolen{};
+  // block one worker until the task of the neighbour shard is invoked
+  executor.shard(2).Task([&]() {
+    blocked = true;
+    WaitFor([&]() { return stolen.load(); });
+  });
+  TEST_ASSERT_TRUE(WaitFor([&]() { return blocked.load(); }));
+  executor.shard(3).Task([&]() { stolen = true; });
+  TEST_ASSERT_TRUE(WaitFor([&]() { return stolen.load(); }, 1s));
+}
+
+void test_StopLeavesTasks() {
+  auto executor = ShardedTaskExecutor<Scheduler>{2, 2};
+  std::atomic_int invoked{};
+  executor.Stop();
+  executor.shard(0).Task([&]() { invoked++; });
+  std::this_thread::sleep_for(10ms);
+  TEST_ASSERT_EQUAL(0, invoked.load());
+}
+
+}  // namespace ae::test_sharded_task_executor
+
+int test_sharded_task_executor() {
+  UNITY_BEGIN();
+  RUN_TEST(ae::test_sharded_task_executor::test_TasksInvoked);
+  RUN_TEST(ae::test_sharded_task_executor::test_DelayedTasksInvoked);
+  RUN_TEST(ae::test_sharded_task_executor::test_ShardTasksSerialized);
+  RUN_TEST(ae::test_sharded_task_executor::test_IdleWorkerStealsShard);
+  RUN_TEST(ae::test_sharded_task_executor::test_StopLeavesTasks);
+  return UNITY_END();
+}
@@ -0,0 +1,99 @@
+/*
+ * Copyright 2026 Aethernet Inc.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <unity.h>
+
+#include <array>
+#include <atomic>
+#include <chrono>
+#include <memory>
+#include <thread>
+
+#include "aether/tasks/details/manual_task_scheduler.h"
+
+#include "tests/benchmarking.h"
+
+namespace ae::test_task_submission_bench {
+using namespace std::chrono_literals;
+
+#if !defined NDEBUG
+static constexpr std::size_t kBenchCount = 100'000;
+#else
+static constexpr std::size_t kBenchCount = 1'000'000;
+#endif
+static constexpr std::size_t kThreadCount = 4;
+
+using Scheduler = ManualTaskScheduler<TaskManagerConf<1024>>;
+
+void test_SingleThreadSubmitBench() {
+  auto scheduler = std::make_unique<Scheduler>();
+  std::size_t invoked = 0;
+
+  tests::BenchmarkFunc(
+      [&](auto i) {
+        scheduler->Task([&]() { ++invoked; });
+        if ((i % 64) == 0) {
+          scheduler->Update();
+        }
+      },
+      kBenchCount, "Submit task and update each 64 tasks");
+  scheduler->Update();
+  TEST_ASSERT_EQUAL(kBenchCount, invoked);
+}
+
+void test_MultiProducerSubmitBench() {
+  static constexpr auto kPerThread = kBenchCount / kThreadCount;
+  auto scheduler = std::make_unique<Scheduler>();
+  std::atomic_size_t invoked{};
+
+  tests::BenchmarkFunc(
+      [&](auto) {
+        std::array<std::thread, kThreadCount> producers;
+        for (auto& p : producers) {
+          p = std::thread{[&]() {
+            for (std::size_t i = 0; i < kPerThread; ++i) {
+              // wait for free space in pool
+              while (scheduler->Task([&]() {
+                invoked.fetch_add(1, std::memory_order::relaxed);
+              }) == nullptr) {
+                std::this_thread::yield();
+              }
+            }
+          }};
+        }
+        while (invoked.load(std::memory_order::relaxed) <
+               (kPerThread * kThreadCount)) {
+          auto next = scheduler->Update();
+          scheduler->WaitUntil(
+              std::min(next, std::chrono::system_clock::now() + 1ms));
+        }
+        for (auto& p : producers) {
+          p.join();
+        }
+      },
+      1, kThreadCount, " producers submit ", kPerThread * kThreadCount,
+      " tasks to the updating thread");
+  TEST_ASSERT_EQUAL(kPerThread * kThreadCount, invoked.load());
+}
+
+}  // namespace ae::test_task_submission_bench
+
+int test_task_submission_bench() {
+  UNITY_BEGIN();
+  RUN_TEST(ae::test_task_submission_bench::test_SingleThreadSubmitBench);
+  RUN_TEST(ae::test_task_submission_bench::test_MultiProducerSubmitBench);
+  return UNITY_END();
+}
@@ -0,0 +1,188 @@
+/*
+ * Copyright 2026 Aethernet Inc.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <unity.h>
+
+#include <array>
+#include <atomic>
+#include <chrono>
+#include <thread>
+#include <vector>
+
+#include "aether/tasks/details/mpsc_ring.h"
+#include "aether/tasks/details/lock_free_pool.h"
+#include "aether/tasks/details/task_subsctiption.h"
+#include "aether/tasks/details/manual_task_scheduler.h"
+
+namespace ae::test_task_submission {
+using namespace std::chrono_literals;
+using TimePoint = std::chrono::system_clock::time_point;
+
+void test_MpscRingFifo() {
+  static constexpr auto kCount = 8;
+  auto ring = MpscRing<int, kCount>{};
+
+  int value{};
+  TEST_ASSERT_FALSE(ring.Pop(value));
+  for (int r = 0; r < 3; ++r) {
+    for (int i = 0; i < kCount; ++i) {
+      TEST_ASSERT_TRUE(ring.Push(i));
+    }
+    TEST_ASSERT_FALSE(ring.Push(kCount));
+    for (int i = 0; i < kCount; ++i) {
+      TEST_ASSERT_TRUE(ring.Pop(value));
+      TEST_ASSERT_EQUAL(i, value);
+    }
+    TEST_ASSERT_FALSE(ring.Pop(value));
+  }
+}
+
+void test_MpscRingMultiProducer() {
+  static constexpr auto kThreadCount = 4;
+  static constexpr auto kCount = 10000;
+  auto ring = MpscRing<int, 64>{};
+
+  std::array<std::thread, kThreadCount> producers;
+  for (int t = 0; t < kThreadCount; ++t) {
+    producers[t] = std::thread{[&, t]() {
+      for (int i = 0; i < kCount; ++i) {
+        while (!ring.Push((t * kCount) + i)) {
+          std::this_thread::yield();
+        }
+      }
+    }};
+  }
+
+  // each producer order is kept
+  std::array<int, kThreadCount> last;
+  last.fill(-1);
+  int received = 0;
+  int value{};
+  while (received < kThreadCount * kCount) {
+    if (!ring.Pop(value)) {
+      std::this_thread::yield();
+      continue;
+    }
+    auto t = value / kCount;
+    TEST_ASSERT_GREATER_THAN(last[t], value % kCount);
+    last[t] = value % kCount;
+    ++received;
+  }
+  for (auto& p : producers) {
+    p.join();
+  }
+}
+
+void test_LockFreePool() {
+  static constexpr auto kCount = 16;
+  static constexpr auto kThreadCount = 4;
+  auto pool = LockFreePool<sizeof(int), alignof(int), kCount>{};
+
+  std::vector<int*> items;
+  for (int i = 0; i < kCount; ++i) {
+    auto* p = pool.create<int>(i);
+    TEST_ASSERT_NOT_NULL(p);
+    items.push_back(p);
+  }
+  TEST_ASSERT_TRUE(pool.full());
+  TEST_ASSERT_NULL(pool.create<int>(kCount));
+  for (auto* p : items) {
+    pool.destroy(p);
+  }
+  TEST_ASSERT_FALSE(pool.full());
+
+  std::array<std::thread, kThreadCount> workers;
+  std::atomic_bool corrupted{false};
+  for (int t = 0; t < kThreadCount; ++t) {
+    workers[t] = std::thread{[&, t]() {
+      for (int i = 0; i < 10000; ++i) {
+        auto* p = pool.create<int>(t);
+        if (p == nullptr) {
+          continue;
+        }
+        std::this_thread::yield();
+        if (*p != t) {
+          corrupted = true;
+        }
+        pool.destroy(p);
+      }
+    }};
+  }
+  for (auto& w : workers) {
+    w.join();
+  }
+  TEST_ASSERT_FALSE(corrupted.load());
+  // all the elements are free again
+  for (auto& p : items) {
+    p = pool.create<int>(0);
+    TEST_ASSERT_NOT_NULL(p);
+  }
+  TEST_ASSERT_TRUE(pool.full());
+}
+
+void test_WakeUpOnSubmit() {
+  auto task_sched = ManualTaskScheduler<TaskManagerConf<10>>{};
+  bool invoked = false;
+
+  auto before = TimePoint::clock::now();
+  auto producer = std::thread{[&]() {
+    std::this_thread::sleep_for(10ms);
+    task_sched.Task([&]() { invoked = true; });
+  }};
+  task_sched.WaitUntil(before + 10s);
+  task_sched.Update();
+  producer.join();
+
+  TEST_ASSERT_TRUE(invoked);
+  TEST_ASSERT_LESS_THAN(
+      5, std::chrono::duration_cast<std::chrono::seconds>(
+             TimePoint::clock::now() - before)
+             .count());
+}
+
+void test_CancelBeforeUpdate() {
+  static constexpr auto kCount = 10;
+  auto task_sched = ManualTaskScheduler<TaskManagerConf<kCount>>{};
+  int invoked = 0;
+
+  for (int i = 0; i < 3 * kCount; ++i) {
+    auto* task = task_sched.Task([&]() { invoked++; });
+    auto* delayed = task_sched.DelayedTask([&]() { invoked++; }, TimePoint{});
+    TEST_ASSERT_NOT_NULL(task);
+    TEST_ASSERT_NOT_NULL(delayed);
+    // cancel before update
+    TaskSubscription{task}.Reset();
+    TaskSubscription{delayed}.Reset();
+    // cancelled tasks are freed on update
+    if ((i % (kCount / 2)) == 0) {
+      task_sched.Update();
+    }
+  }
+  task_sched.Update();
+  TEST_ASSERT_EQUAL(0, invoked);
+}
+
+}  // namespace ae::test_task_submission
+
+int test_task_submission() {
+  UNITY_BEGIN();
+  RUN_TEST(ae::test_task_submission::test_MpscRingFifo);
+  RUN_TEST(ae::test_task_submission::test_MpscRingMultiProducer);
+  RUN_TEST(ae::test_task_submission::test_LockFreePool);
+  RUN_TEST(ae::test_task_submission::test_WakeUpOnSubmit);
+  RUN_TEST(ae::test_task_submission::test_CancelBeforeUpdate);
+  return UNITY_END();
+}
@@ -0,0 +1,101 @@
+/*
+ * Copyright 2026 Aethernet Inc.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <unity.h>
+
+#include <array>
+#include <chrono>
+#include <memory>
+#include <random>
+
+#include "aether/tasks/details/task_subsctiption.h"
+#include "aether/tasks/details/manual_task_scheduler.h"
+
+#include "tests/benchmarking.h"
+
+namespace ae::test_timer_wheel_bench {
+using namespace std::chrono_literals;
+using TimePoint = std::chrono::system_clock::time_point;
+
+static constexpr std::size_t kTimers = 4096;
+// timers rearmed on each 1ms step, like repeat and ack timers of streams
+static constexpr std::size_t kRearmPerStep = 8;
+#if !defined NDEBUG
+static constexpr std::size_t kSteps = 1'000;
+#else
+static constexpr std::size_t kSteps = 10'000;
+#endif
+// sorted queue keeps cancelled timers until expiration, let it fit them all
+static constexpr std::size_t kCapacity = 4 * kTimers;
+static constexpr auto kMaxDelay = 1000;
+
+template <typename DelayedQueue>
+using Scheduler = ManualTaskScheduler<
+    TaskManagerConf<kCapacity, task_manager_internal::kDefaultTaskSize,
+                    task_manager_internal::kDefaultTaskAlign, DelayedQueue>>;
+
+template <typename DelayedQueue>
+void TimersBench(char const* name) {
+  auto scheduler = std::make_unique<Scheduler<DelayedQueue>>();
+  auto subs = std::make_unique<std::array<TaskSubscription, kTimers>>();
+  auto rand = std::mt19937{42};
+  auto delay = std::uniform_int_distribution<int>{1, kMaxDelay};
+  auto timer = std::uniform_int_distribution<std::size_t>{0, kTimers - 1};
+  std::size_t fired = 0;
+
+  auto epoch = TimePoint::clock::now();
+  auto now = epoch;
+  auto arm = [&](std::size_t i) {
+    (*subs)[i] = scheduler->DelayedTask(
+        [&]() { ++fired; }, now + std::chrono::milliseconds{delay(rand)});
+  };
+
+  tests::BenchmarkFunc([&](auto i) { arm(i); }, kTimers, name, " arm ",
+                       kTimers, " timers");
+
+  tests::BenchmarkFunc(
+      [&](auto) {
+        now += 1ms;
+        for (std::size_t r = 0; r < kRearmPerStep; ++r) {
+          arm(timer(rand));
+        }
+        scheduler->Update(now);
+      },
+      kSteps, name, " rearm ", kRearmPerStep, " of ", kTimers,
+      " timers and update each 1ms");
+
+  tests::BenchmarkFunc([&](auto i) { (*subs)[i].Reset(); }, kTimers, name,
+                       " cancel ", kTimers, " timers");
+
+  scheduler->Update(now + std::chrono::milliseconds{kMaxDelay});
+  TEST_ASSERT_EQUAL(0, scheduler->overflow_counter());
+  TEST_ASSERT_GREATER_THAN(0, fired);
+}
+
+void test_SortedQueueBench() { TimersBench<SortedDelayedQueue>("Sorted"); }
+
+void test_TimerWheelBench() {
+  TimersBench<TimerWheelDelayedQueue<>>("Timer wheel");
+}
+
+}  // namespace ae::test_timer_wheel_bench
+
+int test_timer_wheel_bench() {
+  UNITY_BEGIN();
+  RUN_TEST(ae::test_timer_wheel_bench::test_SortedQueueBench);
+  RUN_TEST(ae::test_timer_wheel_bench::test_TimerWheelBench);
+  return UNITY_END();
+}
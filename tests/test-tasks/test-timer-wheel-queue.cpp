@@ -0,0 +1,239 @@
+/*
+ * Copyright 2026 Aethernet Inc.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <unity.h>
+
+#include <array>
+#include <chrono>
+#include <utility>
+
+#include <etl/generic_pool.h>
+
+#include "aether/tasks/details/timer_wheel_queue.h"
+#include "aether/tasks/details/task_subsctiption.h"
+#include "aether/tasks/details/manual_task_scheduler.h"
+
+namespace ae::test_timer_wheel_queue {
+using namespace std::chrono_literals;
+using TimePoint = std::chrono::system_clock::time_point;
+
+struct DelayedTask : public TimerWheelNode<TimePoint> {
+  static inline auto delete_count = 0;
+  explicit DelayedTask(int id, TimePoint et)
+      : TimerWheelNode{et}, task_id{id} {}
+  ~DelayedTask() override { delete_count++; }
+  void Invoke() && noexcept override {}
+  int task_id;
+};
+
+template <std::size_t kCount>
+using Pool =
+    etl::generic_pool<sizeof(DelayedTask), alignof(DelayedTask), kCount>;
+// small wheel to check cascading: 3 levels of 4 slots covers 64 ms
+template <std::size_t kCount>
+using Queue = TimerWheelTaskQueue<kCount, TimePoint, Pool<kCount>,
+                                  std::chrono::milliseconds, 2, 3>;
+
+void test_AddTimerWheelTask() {
+  static constexpr auto kCount = 10;
+
+  auto pool = Pool<kCount>{};
+  auto queue = Queue<kCount>{pool};
+  auto epoch = TimePoint::clock::now();
+
+  for (int i = 0; i < kCount; ++i) {
+    auto* ri = pool.create<DelayedTask>(i, epoch + std::chrono::seconds{i});
+    TEST_ASSERT_TRUE(queue.Add(ri));
+  }
+  TEST_ASSERT_EQUAL(kCount, queue.size());
+  auto rlast = DelayedTask{kCount + 1, TimePoint{}};
+  TEST_ASSERT_FALSE(queue.Add(&rlast));
+  TEST_ASSERT_EQUAL(epoch.time_since_epoch().count(),
+                    queue.next_expire_at().time_since_epoch().count());
+}
+
+void test_StealTimerWheelTask() {
+  static constexpr auto kCount = 10;
+  DelayedTask::delete_count = 0;
+
+  auto pool = Pool<kCount>{};
+  auto queue = Queue<kCount>{pool};
+  auto epoch = TimePoint::clock::now();
+
+  // delays cross all the levels and the overflow list
+  static constexpr std::array<int, kCount> kDelays{1,  3,  7,   15,  16,
+                                                   40, 63, 100, 500, 3000};
+  // add tasks in reverse order
+  for (int i = kCount - 1; i >= 0; --i) {
+    auto* ri = pool.create<DelayedTask>(
+        i, epoch + std::chrono::milliseconds{kDelays[i]});
+    TEST_ASSERT_TRUE(queue.Add(ri));
+  }
+
+  auto not_expired = decltype(queue)::list{};
+  queue.StealTasks(epoch, not_expired);
+  TEST_ASSERT_EQUAL(0, not_expired.size());
+
+  // the task is not stealed before expiration
+  for (int i = 0; i < kCount; ++i) {
+    auto expired = decltype(queue)::list{};
+    queue.StealTasks(epoch + std::chrono::milliseconds{kDelays[i]} - 1us,
+                     expired);
+    TEST_ASSERT_EQUAL(0, expired.size());
+    TEST_ASSERT_LESS_OR_EQUAL(
+        (epoch + std::chrono::milliseconds{kDelays[i]})
+            .time_since_epoch()
+            .count(),
+        queue.next_expire_at().time_since_epoch().count());
+
+    queue.StealTasks(epoch + std::chrono::milliseconds{kDelays[i]}, expired);
+    TEST_ASSERT_EQUAL(1, expired.size());
+    TEST_ASSERT_EQUAL(i, static_cast<DelayedTask*>(expired[0])->task_id);
+    queue.Free(expired);
+  }
+  TEST_ASSERT_EQUAL(0, queue.size());
+  TEST_ASSERT_EQUAL(kCount, DelayedTask::delete_count);
+  TEST_ASSERT_EQUAL(TimePoint::max().time_since_epoch().count(),
+                    queue.next_expire_at().time_since_epoch().count());
+}
+
+void test_StealAfterLongPause() {
+  static constexpr auto kCount = 10;
+  DelayedTask::delete_count = 0;
+
+  auto pool = Pool<kCount>{};
+  auto queue = Queue<kCount>{pool};
+  auto epoch = TimePoint::clock::now();
+
+  for (int i = 0; i < kCount; ++i) {
+    auto* ri = pool.create<DelayedTask>(
+        i, epoch + std::chrono::milliseconds{(i + 1) * 37});
+    TEST_ASSERT_TRUE(queue.Add(ri));
+  }
+
+  // limited by the container size
+  auto two_tasks = decltype(queue)::list_container<2>{};
+  queue.StealTasks(epoch + 10s, two_tasks);
+  TEST_ASSERT_EQUAL(2, two_tasks.size());
+  TEST_ASSERT_EQUAL(0, static_cast<DelayedTask*>(two_tasks[0])->task_id);
+  TEST_ASSERT_EQUAL(1, static_cast<DelayedTask*>(two_tasks[1])->task_id);
+  queue.Free(two_tasks);
+
+  auto rest = decltype(queue)::list{};
+  queue.StealTasks(epoch + 10s, rest);
+  TEST_ASSERT_EQUAL(kCount - 2, rest.size());
+  for (std::size_t i = 0; i < rest.size(); ++i) {
+    TEST_ASSERT_EQUAL(static_cast<int>(i + 2),
+                      static_cast<DelayedTask*>(rest[i])->task_id);
+  }
+  queue.Free(rest);
+  TEST_ASSERT_EQUAL(kCount, DelayedTask::delete_count);
+}
+
+void test_CancelReclaimsTask() {
+  static constexpr auto kCount = 4;
+  DelayedTask::delete_count = 0;
+
+  auto pool = Pool<kCount>{};
+  auto queue = Queue<kCount>{pool};
+  auto epoch = TimePoint::clock::now();
+
+  std::array<TaskSubscription, kCount> subs;
+  for (int i = 0; i < kCount; ++i) {
+    auto* ri = pool.create<DelayedTask>(i, epoch + 1h);
+    TEST_ASSERT_TRUE(queue.Add(ri));
+    subs[i] = ri;
+  }
+  TEST_ASSERT_EQUAL(0, pool.available());
+
+  subs[1].Reset();
+  subs[2].Reset();
+  // cancelled tasks are freed on the next queue access
+  queue.Reclaim();
+  TEST_ASSERT_EQUAL(2, DelayedTask::delete_count);
+  TEST_ASSERT_EQUAL(2, pool.available());
+  TEST_ASSERT_EQUAL(kCount - 2, queue.size());
+
+  // free slots may be used again
+  auto* r4 = pool.create<DelayedTask>(4, epoch + 1ms);
+  TEST_ASSERT_TRUE(queue.Add(r4));
+  subs[3].Reset();
+  auto* r5 = pool.create<DelayedTask>(5, epoch + 2ms);
+  TEST_ASSERT_TRUE(queue.Add(r5));
+
+  auto expired = decltype(queue)::list{};
+  queue.StealTasks(epoch + 2h, expired);
+  TEST_ASSERT_EQUAL(3, expired.size());
+  TEST_ASSERT_EQUAL(4, static_cast<DelayedTask*>(expired[0])->task_id);
+  TEST_ASSERT_EQUAL(5, static_cast<DelayedTask*>(expired[1])->task_id);
+  TEST_ASSERT_EQUAL(0, static_cast<DelayedTask*>(expired[2])->task_id);
+  // stealed task is only deactivated
+  subs[0].Reset();
+  TEST_ASSERT_EQUAL(0, expired[2]->active);
+  queue.Free(expired);
+  TEST_ASSERT_EQUAL(kCount + 2, DelayedTask::delete_count);
+}
+
+void test_TimerWheelScheduler() {
+  static constexpr auto kCount = 10;
+  // new tasks are created before the old ones are cancelled
+  using Conf =
+      TaskManagerConf<2 * kCount, task_manager_internal::kDefaultTaskSize,
+                      task_manager_internal::kDefaultTaskAlign,
+                      TimerWheelDelayedQueue<>>;
+  auto task_sched = ManualTaskScheduler<Conf>{};
+  std::array<int, kCount> invoked{};
+  std::array<TaskSubscription, kCount> subs;
+
+  auto epoch = TimePoint::clock::now();
+  for (auto i = 0; i < kCount; ++i) {
+    subs[i] = task_sched.DelayedTask([&, i]() { invoked[i]++; },
+                                     epoch + std::chrono::seconds{i + 1});
+  }
+  // rearm all the timers a lot of times, scheduler must not overflow
+  for (auto r = 0; r < 100; ++r) {
+    for (auto i = 0; i < kCount; ++i) {
+      subs[i] = task_sched.DelayedTask([&, i]() { invoked[i]++; },
+                                       epoch + std::chrono::seconds{i + 1});
+    }
+    task_sched.Update(epoch);
+  }
+  TEST_ASSERT_EQUAL(0, task_sched.overflow_counter());
+
+  // the wake up time is not later than the first expiration
+  auto tp = task_sched.Update(epoch);
+  TEST_ASSERT_LESS_OR_EQUAL((epoch + 1s).time_since_epoch().count(),
+                            tp.time_since_epoch().count());
+  for (auto i = 0; i < kCount; ++i) {
+    task_sched.Update(epoch + std::chrono::seconds{i + 1});
+    TEST_ASSERT_EQUAL(1, invoked[i]);
+  }
+  for (auto i : invoked) {
+    TEST_ASSERT_EQUAL(1, i);
+  }
+}
+
+}  // namespace ae::test_timer_wheel_queue
+
+int test_timer_wheel_queue() {
+  UNITY_BEGIN();
+  RUN_TEST(ae::test_timer_wheel_queue::test_AddTimerWheelTask);
+  RUN_TEST(ae::test_timer_wheel_queue::test_StealTimerWheelTask);
+  RUN_TEST(ae::test_timer_wheel_queue::test_StealAfterLongPause);
+  RUN_TEST(ae::test_timer_wheel_queue::test_CancelReclaimsTask);
+  RUN_TEST(ae::test_timer_wheel_queue::test_TimerWheelScheduler);
+  return UNITY_END();
+}
@@ -20,9 +20,20 @@ void setUp() {}
 void tearDown() {}
 
 extern int test_data_packet_collector();
+extern int test_tcp_send_action();
+extern int test_udp_send_action();
+extern int test_data_packet_collector_bench();
+extern int test_send_path_alloc_bench();
 
 int main() {
   int res = 0;
   res += test_data_packet_collector();
+  res += test_tcp_send_action();
+  res += test_udp_send_action();
+
+#if defined AE_TRANSPORT_BENCH
+  res += test_data_packet_collector_bench();
+  res += test_send_path_alloc_bench();
+#endif
   return res;
 }
@@ -0,0 +1,85 @@
+/*
+ * Copyright 2026 Aethernet Inc.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <unity.h>
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+#include <algorithm>
+
+#include "aether/mstream.h"
+#include "aether/mstream_buffers.h"
+#include "aether/transport/data_packet_collector.h"
+
+#include "tests/benchmarking.h"
+
+namespace ae::test_data_pc_bench {
+#if !defined NDEBUG
+static constexpr std::size_t kBenchCount = 10;
+#else
+static constexpr std::size_t kBenchCount = 100;
+#endif
+// typical tcp segment size
+static constexpr std::size_t kSegmentSize = 1400;
+
+std::vector<std::uint8_t> MakeStream(std::size_t packet_size,
+                                     std::size_t packet_count) {
+  std::vector<std::uint8_t> stream;
+  auto writer = VectorWriter<PacketSize>{stream};
+  auto os = omstream{writer};
+  for (std::size_t i = 0; i < packet_count; ++i) {
+    os << PacketSize{packet_size};
+    stream.insert(std::end(stream), packet_size,
+                  static_cast<std::uint8_t>(i));
+  }
+  return stream;
+}
+
+void CollectStream(std::size_t packet_size, std::size_t packet_count) {
+  auto stream = MakeStream(packet_size, packet_count);
+  StreamDataPacketCollector collector;
+  DataBuffer packet;
+  std::size_t received = 0;
+
+  tests::BenchmarkFunc(
+      [&](auto) {
+        for (std::size_t offset = 0; offset < stream.size();
+             offset += kSegmentSize) {
+          collector.AddData(stream.data() + offset,
+                            std::min(kSegmentSize, stream.size() - offset));
+          while (collector.PopPacket(packet)) {
+            ++received;
+          }
+        }
+      },
+      kBenchCount, "Collect ", packet_count, " packets of ", packet_size,
+      " bytes from ", kSegmentSize, " bytes segments");
+  TEST_ASSERT_EQUAL(kBenchCount * packet_count, received);
+}
+
+void test_ManySmallPacketsBench() { CollectStream(32, 100'000); }
+
+void test_FewBigPacketsBench() { CollectStream(64 * 1024, 50); }
+
+}  // namespace ae::test_data_pc_bench
+
+int test_data_packet_collector_bench() {
+  UNITY_BEGIN();
+  RUN_TEST(ae::test_data_pc_bench::test_ManySmallPacketsBench);
+  RUN_TEST(ae::test_data_pc_bench::test_FewBigPacketsBench);
+  return UNITY_END();
+}
@@ -17,6 +17,7 @@
 #include <unity.h>
 
 #include <cstdint>
+#include <algorithm>
 #include <string>
 #include <vector>
 
@@ -151,6 +152,58 @@ void test_BigPacketPartially() {
     TEST_ASSERT(!p.empty());
   }
 }
+
+void test_PeekAndDropPacket() {
+  StreamDataPacketCollector collector;
+  TEST_ASSERT_EQUAL(0, collector.PeekPacket().size());
+
+  auto packet = TestPacket();
+  collector.AddData(packet);
+  collector.AddData(MakeStreamPacket({1, 2, 3}));
+
+  auto view = collector.PeekPacket();
+  // packet is not copied, view points to the data after header
+  TEST_ASSERT_EQUAL(packet.size() - 1, view.size());
+  TEST_ASSERT_EQUAL_UINT8_ARRAY(packet.data() + 1, view.data(), view.size());
+  AssertPacket({std::begin(view), std::end(view)});
+  collector.DropPacket();
+
+  DataBuffer data;
+  TEST_ASSERT_TRUE(collector.PopPacket(data));
+  TEST_ASSERT_EQUAL(3, data.size());
+  TEST_ASSERT_EQUAL(3, data[2]);
+  TEST_ASSERT_FALSE(collector.PopPacket(data));
+  TEST_ASSERT_EQUAL(0, collector.PeekPacket().size());
+}
+
+void test_StreamInSmallParts() {
+  static constexpr std::size_t kPacketCount = 100;
+  StreamDataPacketCollector collector;
+
+  std::vector<std::uint8_t> stream;
+  for (std::size_t i = 0; i < kPacketCount; ++i) {
+    auto packet = MakeStreamPacket(std::vector<std::uint8_t>(
+        (i * 37) % 600, static_cast<std::uint8_t>(i)));
+    stream.insert(std::end(stream), std::begin(packet), std::end(packet));
+  }
+
+  std::size_t received = 0;
+  DataBuffer data;
+  for (std::size_t offset = 0; offset < stream.size(); offset += 7) {
+    auto size = std::min(std::size_t{7}, stream.size() - offset);
+    collector.AddData(stream.data() + offset, size);
+    while (collector.PopPacket(data)) {
+      // empty packets are skipped
+      while (((received * 37) % 600) == 0) {
+        ++received;
+      }
+      TEST_ASSERT_EQUAL((received * 37) % 600, data.size());
+      TEST_ASSERT_EQUAL(static_cast<std::uint8_t>(received), data.back());
+      ++received;
+    }
+  }
+  TEST_ASSERT_EQUAL(kPacketCount, received);
+}
 }  // namespace ae::test_data_pc
 
 int test_data_packet_collector() {
@@ -161,5 +214,7 @@ int test_data_packet_collector() {
   RUN_TEST(ae::test_data_pc::test_AddBigPacket);
   RUN_TEST(ae::test_data_pc::test_AddFewPacketInOne);
   RUN_TEST(ae::test_data_pc::test_BigPacketPartially);
+  RUN_TEST(ae::test_data_pc::test_PeekAndDropPacket);
+  RUN_TEST(ae::test_data_pc::test_StreamInSmallParts);
   return UNITY_END();
 }
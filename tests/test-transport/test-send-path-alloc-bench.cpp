@@ -0,0 +1,181 @@
+/*
+ * Copyright 2026 Aethernet Inc.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <unity.h>
+
+#include <new>
+#include <cstdlib>
+#include <cstdint>
+#include <iostream>
+
+#include "aether/ae_context.h"
+#include "aether/crypto/key.h"
+#include "aether/crypto/key_gen.h"
+#include "aether/crypto/sync_crypto_provider.h"
+#include "aether/api_protocol/api_protocol.h"
+#include "aether/types/data_buffer_pool.h"
+#include "aether/transport/data_packet_collector.h"
+#include "aether/transport/system_sockets/tcp/tcp.h"
+
+#include "tests/benchmarking.h"
+
+#if defined AE_TRANSPORT_BENCH
+// count all the allocations in the test
+static std::size_t allocation_count = 0;
+
+void* operator new(std::size_t size) {
+  ++allocation_count;
+  if (auto* p = std::malloc(size); p != nullptr) {
+    return p;
+  }
+  throw std::bad_alloc{};
+}
+void operator delete(void* p) noexcept { std::free(p); }
+void operator delete(void* p, std::size_t) noexcept { std::free(p); }
+#endif
+
+#if defined SYSTEM_SOCKET_TCP_TRANSPORT_ENABLED && defined AE_TRANSPORT_BENCH
+namespace ae::test_send_path_alloc_bench {
+#  if !defined NDEBUG
+static constexpr std::size_t kBenchCount = 10'000;
+#  else
+static constexpr std::size_t kBenchCount = 100'000;
+#  endif
+
+struct TestContext {
+  AeCtx ToAeContext() const {
+    static constexpr auto table =
+        AeCtxTable{nullptr, [](void* obj) -> TaskScheduler& {
+                     return static_cast<TestContext*>(obj)->sched;
+                   }};
+    return AeCtx{
+        const_cast<TestContext*>(this),  // NOLINT
+        &table,
+    };
+  }
+
+  TaskScheduler sched;
+};
+
+class TestKeyProvider : public ISyncKeyProvider {
+ public:
+  explicit TestKeyProvider(Key key) : key_{std::move(key)} { nonce_.Init(); }
+
+  Key GetKey() const override { return key_; }
+  CryptoNonce const& Nonce() const override {
+    nonce_.Next();
+    return nonce_;
+  }
+
+ private:
+  Key key_;
+  mutable CryptoNonce nonce_;
+};
+
+class MessageApi : public ApiClassImpl<MessageApi> {
+ public:
+  explicit MessageApi(ProtocolContext& protocol_context)
+      : ApiClassImpl{protocol_context}, send_message{protocol_context} {}
+
+  void SendMessageImpl(DataBuffer data) {
+    received_size += data.size();
+    DataBufferPool::Release(std::move(data));
+  }
+
+  AE_METHODS(RegMethod<03, &MessageApi::SendMessageImpl>);
+
+  Method<03, void(DataBuffer data)> send_message;
+
+  std::size_t received_size = 0;
+};
+
+// socket passes all sent data to the receiver's collector
+struct LoopbackSocket {
+  std::optional<std::size_t> Send(
+      Span<Span<std::uint8_t const> const> buffers) {
+    std::size_t sent = 0;
+    for (auto const& b : buffers) {
+      collector->AddData(b.data(), b.size());
+      sent += b.size();
+    }
+    return sent;
+  }
+
+  StreamDataPacketCollector* collector;
+};
+
+void SendMessagePath(std::size_t message_size) {
+  auto ctx = TestContext{};
+  auto pc = ProtocolContext{};
+  auto api = MessageApi{pc};
+
+  Key key;
+  CryptoSyncKeygen(key);
+  auto encrypt = SyncEncryptProvider{make_unique<TestKeyProvider>(key)};
+  auto decrypt = SyncDecryptProvider{make_unique<TestKeyProvider>(key)};
+
+  auto collector = StreamDataPacketCollector{};
+  auto socket = LoopbackSocket{&collector};
+  auto const message = DataBuffer(message_size, 0x42);
+
+  auto allocations_before = allocation_count;
+  tests::BenchmarkFunc(
+      [&](auto) {
+        // pack, encrypt and send
+        auto api_context = ApiContext{api};
+        api_context->send_message(DataBuffer{message});
+        auto packet = std::move(api_context).Pack();
+        encrypt.EncryptInPlace(packet);
+        {
+          auto send_action = tcp_internal::SendAction<LoopbackSocket>{
+              ctx, socket, std::move(packet)};
+          send_action.Send();
+        }
+        ctx.sched.Update();
+
+        // receive, decrypt and parse
+        auto received = DataBufferPool::Acquire(0);
+        while (collector.PopPacket(received)) {
+          if (decrypt.DecryptInPlace(received)) {
+            auto parser = ApiParser{pc, received};
+            parser.Parse(api);
+          }
+        }
+        DataBufferPool::Release(std::move(received));
+      },
+      kBenchCount, "Send and receive message of ", message_size, " bytes");
+  auto allocations = allocation_count - allocations_before;
+  std::cout << "│\tallocations per message: "
+            << static_cast<double>(allocations) / kBenchCount << std::endl;
+
+  TEST_ASSERT_EQUAL(kBenchCount * message_size, api.received_size);
+}
+
+void test_SmallMessageAllocations() { SendMessagePath(64); }
+
+void test_BigMessageAllocations() { SendMessagePath(4000); }
+
+}  // namespace ae::test_send_path_alloc_bench
+#endif
+
+int test_send_path_alloc_bench() {
+  UNITY_BEGIN();
+#if defined SYSTEM_SOCKET_TCP_TRANSPORT_ENABLED && defined AE_TRANSPORT_BENCH
+  RUN_TEST(ae::test_send_path_alloc_bench::test_SmallMessageAllocations);
+  RUN_TEST(ae::test_send_path_alloc_bench::test_BigMessageAllocations);
+#endif
+  return UNITY_END();
+}
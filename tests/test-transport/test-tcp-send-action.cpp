@@ -0,0 +1,201 @@
+/*
+ * Copyright 2026 Aethernet Inc.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <unity.h>
+
+#include <vector>
+#include <cstdint>
+#include <optional>
+#include <algorithm>
+
+#include "aether/ae_context.h"
+#include "aether/transport/packet_queue_manager.h"
+#include "aether/transport/data_packet_collector.h"
+#include "aether/transport/system_sockets/tcp/tcp.h"
+
+#if defined SYSTEM_SOCKET_TCP_TRANSPORT_ENABLED
+namespace ae::test_tcp_send_action {
+struct TestContext {
+  AeCtx ToAeContext() const {
+    static constexpr auto table =
+        AeCtxTable{nullptr, [](void* obj) -> TaskScheduler& {
+                     return static_cast<TestContext*>(obj)->sched;
+                   }};
+    return AeCtx{
+        const_cast<TestContext*>(this),  // NOLINT
+        &table,
+    };
+  }
+
+  TaskScheduler sched;
+};
+
+// socket stores all sent data, sends no more than max_send per call
+struct FakeSocket {
+  std::optional<std::size_t> Send(
+      Span<Span<std::uint8_t const> const> buffers) {
+    ++send_calls;
+    if (fail) {
+      return std::nullopt;
+    }
+    std::size_t sent = 0;
+    for (auto const& b : buffers) {
+      auto size = std::min(b.size(), max_send - sent);
+      data.insert(std::end(data), b.begin(), b.begin() + size);
+      sent += size;
+      if (sent == max_send) {
+        break;
+      }
+    }
+    return sent;
+  }
+
+  std::vector<std::uint8_t> data;
+  std::size_t send_calls = 0;
+  std::size_t max_send = 1024 * 1024;
+  bool fail = false;
+};
+
+using SendAction = tcp_internal::SendAction<FakeSocket>;
+using QueueManager = PacketQueueManager<SendAction, 8>;
+
+DataBuffer MakePayload(std::size_t size, std::uint8_t seed) {
+  auto payload = DataBuffer(size);
+  for (std::size_t i = 0; i < size; ++i) {
+    payload[i] = static_cast<std::uint8_t>(seed + i);
+  }
+  return payload;
+}
+
+// sent data must be collected back into the same packets
+void AssertPackets(std::vector<std::uint8_t> const& data,
+                   std::vector<DataBuffer> const& expected) {
+  StreamDataPacketCollector collector;
+  collector.AddData(data.data(), data.size());
+  for (auto const& e : expected) {
+    auto packet = collector.PopPacket();
+    TEST_ASSERT_EQUAL(e.size(), packet.size());
+    TEST_ASSERT_EQUAL_UINT8_ARRAY(e.data(), packet.data(), e.size());
+  }
+  TEST_ASSERT_TRUE(collector.PopPacket().empty());
+}
+
+void test_SendFramedPacket() {
+  auto ctx = TestContext{};
+  // small and big packets have different size prefix
+  for (auto size : {std::size_t{10}, std::size_t{1000}, std::size_t{70000}}) {
+    auto socket = FakeSocket{};
+    auto payload = MakePayload(size, 1);
+    auto action = SendAction{ctx, socket, DataBuffer{payload}};
+    bool success = false;
+    auto sub = action.status_event().Subscribe([&](auto status) {
+      success = status == WriteAction::Status::kSuccess;
+    });
+
+    action.Send();
+    TEST_ASSERT_TRUE(action.is_done());
+    ctx.sched.Update();
+    TEST_ASSERT_TRUE(success);
+    TEST_ASSERT_EQUAL(1, socket.send_calls);
+    AssertPackets(socket.data, {payload});
+  }
+}
+
+void test_QueuedPacketsCoalesced() {
+  static constexpr auto kCount = 5;
+  auto ctx = TestContext{};
+  auto socket = FakeSocket{};
+  auto queue = QueueManager{ctx};
+
+  std::vector<DataBuffer> payloads;
+  int success_count = 0;
+  std::vector<Subscription> subs;
+  for (int i = 0; i < kCount; ++i) {
+    payloads.emplace_back(MakePayload(100 + i, static_cast<std::uint8_t>(i)));
+    auto* action = queue.AddPacket(ctx, socket, DataBuffer{payloads.back()});
+    TEST_ASSERT_NOT_NULL(action);
+    subs.emplace_back(action->status_event().Subscribe([&](auto status) {
+      success_count += (status == WriteAction::Status::kSuccess) ? 1 : 0;
+    }));
+  }
+
+  ctx.sched.Update();
+  ctx.sched.Update();
+  TEST_ASSERT_EQUAL(1, socket.send_calls);
+  TEST_ASSERT_EQUAL(kCount, success_count);
+  AssertPackets(socket.data, payloads);
+}
+
+void test_PartialSend() {
+  static constexpr auto kCount = 3;
+  auto ctx = TestContext{};
+  auto socket = FakeSocket{};
+  socket.max_send = 7;
+  auto queue = QueueManager{ctx};
+
+  std::vector<DataBuffer> payloads;
+  int success_count = 0;
+  std::vector<Subscription> subs;
+  for (int i = 0; i < kCount; ++i) {
+    payloads.emplace_back(MakePayload(20, static_cast<std::uint8_t>(i)));
+    auto* action = queue.AddPacket(ctx, socket, DataBuffer{payloads.back()});
+    subs.emplace_back(action->status_event().Subscribe([&](auto status) {
+      success_count += (status == WriteAction::Status::kSuccess) ? 1 : 0;
+    }));
+  }
+  ctx.sched.Update();
+  // emulate socket ready to write events
+  for (int i = 0; (i < 100) && (success_count < kCount); ++i) {
+    queue.Send();
+    ctx.sched.Update();
+  }
+  TEST_ASSERT_EQUAL(kCount, success_count);
+  AssertPackets(socket.data, payloads);
+}
+
+void test_SendFailed() {
+  auto ctx = TestContext{};
+  auto socket = FakeSocket{};
+  socket.fail = true;
+  auto queue = QueueManager{ctx};
+
+  int fail_count = 0;
+  std::vector<Subscription> subs;
+  for (int i = 0; i < 2; ++i) {
+    auto* action = queue.AddPacket(ctx, socket, MakePayload(10, 0));
+    subs.emplace_back(action->status_event().Subscribe([&](auto status) {
+      fail_count += (status == WriteAction::Status::kFail) ? 1 : 0;
+    }));
+  }
+  ctx.sched.Update();
+  ctx.sched.Update();
+  TEST_ASSERT_EQUAL(1, socket.send_calls);
+  TEST_ASSERT_EQUAL(2, fail_count);
+}
+
+}  // namespace ae::test_tcp_send_action
+#endif
+
+int test_tcp_send_action() {
+  UNITY_BEGIN();
+#if defined SYSTEM_SOCKET_TCP_TRANSPORT_ENABLED
+  RUN_TEST(ae::test_tcp_send_action::test_SendFramedPacket);
+  RUN_TEST(ae::test_tcp_send_action::test_QueuedPacketsCoalesced);
+  RUN_TEST(ae::test_tcp_send_action::test_PartialSend);
+  RUN_TEST(ae::test_tcp_send_action::test_SendFailed);
+#endif
+  return UNITY_END();
+}
@@ -0,0 +1,204 @@
+/*
+ * Copyright 2026 Aethernet Inc.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <unity.h>
+
+#include <array>
+#include <vector>
+#include <cstdint>
+#include <optional>
+
+#include "aether/ae_context.h"
+#include "aether/transport/packet_queue_manager.h"
+#include "aether/transport/system_sockets/sockets/isocket.h"
+#include "aether/transport/system_sockets/udp/udp.h"
+
+#if defined SYSTEM_SOCKET_UDP_TRANSPORT_ENABLED
+namespace ae::test_udp_send_action {
+struct TestContext {
+  AeCtx ToAeContext() const {
+    static constexpr auto table =
+        AeCtxTable{nullptr, [](void* obj) -> TaskScheduler& {
+                     return static_cast<TestContext*>(obj)->sched;
+                   }};
+    return AeCtx{
+        const_cast<TestContext*>(this),  // NOLINT
+        &table,
+    };
+  }
+
+  TaskScheduler sched;
+};
+
+// socket stores all sent datagrams, sends no more than max_send per call
+struct FakeSocket {
+  std::optional<std::size_t> SendDatagrams(
+      Span<Span<std::uint8_t const> const> datagrams) {
+    ++send_calls;
+    if (fail_calls > 0) {
+      --fail_calls;
+      return std::nullopt;
+    }
+    std::size_t sent = 0;
+    for (auto const& d : datagrams) {
+      if (sent == max_send) {
+        break;
+      }
+      data.emplace_back(d.begin(), d.end());
+      ++sent;
+    }
+    return sent;
+  }
+
+  std::vector<DataBuffer> data;
+  std::size_t send_calls = 0;
+  std::size_t max_send = ISocket::kMaxSendDatagrams;
+  int fail_calls = 0;
+};
+
+// socket with the default SendDatagrams, sends only a half of the datagrams
+// after the first full_sends
+struct ShortSendSocket final : public ISocket {
+  using ISocket::Send;
+
+  ISocket& ReadyToWrite(ReadyToWriteCb) override { return *this; }
+  ISocket& RecvData(RecvDataCb) override { return *this; }
+  ISocket& Error(ErrorCb) override { return *this; }
+  ISocket& Connect(AddressPort const&, ConnectedCb) override { return *this; }
+  std::optional<std::size_t> Send(Span<std::uint8_t> data) override {
+    ++send_calls;
+    return (send_calls > full_sends) ? (data.size() / 2) : data.size();
+  }
+  void Disconnect() override {}
+
+  std::size_t send_calls = 0;
+  std::size_t full_sends = 0;
+};
+
+using SendAction = upd_internal::SendAction<FakeSocket>;
+using QueueManager = PacketQueueManager<SendAction, 8>;
+
+struct QueueTest {
+  explicit QueueTest(TestContext& ctx) : queue{ctx} {}
+
+  void Add(TestContext& ctx, FakeSocket& socket, std::size_t count) {
+    for (std::size_t i = 0; i < count; ++i) {
+      payloads.emplace_back(DataBuffer(10 + i, static_cast<std::uint8_t>(i)));
+      auto* action = queue.AddPacket(ctx, socket, DataBuffer{payloads.back()});
+      TEST_ASSERT_NOT_NULL(action);
+      subs.emplace_back(action->status_event().Subscribe([&](auto status) {
+        success_count += (status == WriteAction::Status::kSuccess) ? 1 : 0;
+        fail_count += (status == WriteAction::Status::kFail) ? 1 : 0;
+      }));
+    }
+  }
+
+  QueueManager queue;
+  std::vector<DataBuffer> payloads;
+  std::vector<Subscription> subs;
+  std::size_t success_count = 0;
+  std::size_t fail_count = 0;
+};
+
+void test_QueuedDatagramsBatched() {
+  static constexpr auto kCount = 5;
+  auto ctx = TestContext{};
+  auto socket = FakeSocket{};
+  auto test = QueueTest{ctx};
+  test.Add(ctx, socket, kCount);
+
+  ctx.sched.Update();
+  ctx.sched.Update();
+  TEST_ASSERT_EQUAL(1, socket.send_calls);
+  TEST_ASSERT_EQUAL(kCount, test.success_count);
+  TEST_ASSERT_EQUAL(kCount, socket.data.size());
+  for (std::size_t i = 0; i < kCount; ++i) {
+    TEST_ASSERT_EQUAL(test.payloads[i].size(), socket.data[i].size());
+    TEST_ASSERT_EQUAL_UINT8_ARRAY(test.payloads[i].data(),
+                                  socket.data[i].data(), socket.data[i].size());
+  }
+}
+
+void test_BusySocket() {
+  static constexpr auto kCount = 7;
+  auto ctx = TestContext{};
+  auto socket = FakeSocket{};
+  socket.max_send = 2;
+  auto test = QueueTest{ctx};
+  test.Add(ctx, socket, kCount);
+
+  // not sent datagrams are re-enqueued
+  for (int i = 0; (i < 100) && (test.success_count < kCount); ++i) {
+    ctx.sched.Update();
+  }
+  TEST_ASSERT_EQUAL(kCount, test.success_count);
+  TEST_ASSERT_EQUAL(4, socket.send_calls);
+  TEST_ASSERT_EQUAL(kCount, socket.data.size());
+  for (std::size_t i = 0; i < kCount; ++i) {
+    TEST_ASSERT_EQUAL(test.payloads[i].size(), socket.data[i].size());
+  }
+}
+
+void test_SendFailed() {
+  static constexpr auto kCount = 3;
+  auto ctx = TestContext{};
+  auto socket = FakeSocket{};
+  socket.fail_calls = 1;
+  auto test = QueueTest{ctx};
+  test.Add(ctx, socket, kCount);
+
+  // only the first datagram is failed, the rest are sent by the next call
+  for (int i = 0; (i < 100) && (test.success_count < (kCount - 1)); ++i) {
+    ctx.sched.Update();
+  }
+  TEST_ASSERT_EQUAL(2, socket.send_calls);
+  TEST_ASSERT_EQUAL(1, test.fail_count);
+  TEST_ASSERT_EQUAL(kCount - 1, test.success_count);
+}
+
+void test_ShortSendIsError() {
+  auto data = std::array<std::uint8_t, 10>{};
+  auto datagram = Span<std::uint8_t const>{data.data(), data.size()};
+  auto datagrams = std::array{datagram, datagram, datagram};
+  auto datagrams_span =
+      Span<Span<std::uint8_t const> const>{datagrams.data(), datagrams.size()};
+
+  auto socket = ShortSendSocket{};
+  // short send of the first datagram is an error
+  TEST_ASSERT_FALSE(socket.SendDatagrams(datagrams_span).has_value());
+
+  // short send of the next one stops sending
+  socket.send_calls = 0;
+  socket.full_sends = 1;
+  auto res = socket.SendDatagrams(datagrams_span);
+  TEST_ASSERT_TRUE(res.has_value());
+  TEST_ASSERT_EQUAL(1, *res);
+  TEST_ASSERT_EQUAL(2, socket.send_calls);
+}
+
+}  // namespace ae::test_udp_send_action
+#endif
+
+int test_udp_send_action() {
+  UNITY_BEGIN();
+#if defined SYSTEM_SOCKET_UDP_TRANSPORT_ENABLED
+  RUN_TEST(ae::test_udp_send_action::test_QueuedDatagramsBatched);
+  RUN_TEST(ae::test_udp_send_action::test_BusySocket);
+  RUN_TEST(ae::test_udp_send_action::test_SendFailed);
+  RUN_TEST(ae::test_udp_send_action::test_ShortSendIsError);
+#endif
+  return UNITY_END();
+}
@@ -24,11 +24,15 @@ extern int test_ring_index();
 extern int test_concat_arrays();
 extern int test_span();
 extern int test_static_map();
+extern int test_flat_hash_map();
 extern int test_statistics_counter();
 extern int test_uid();
 extern int test_nullable_type();
 extern int test_variant_type();
 extern int test_address_parser();
+extern int test_data_buffer_pool();
+extern int test_mstream();
+extern int test_mstream_bench();
 
 int main() {
   int res = 0;
@@ -37,10 +41,16 @@ int main() {
   res += test_concat_arrays();
   res += test_span();
   res += test_static_map();
+  res += test_flat_hash_map();
   res += test_statistics_counter();
   res += test_uid();
   res += test_nullable_type();
   res += test_variant_type();
   res += test_address_parser();
+  res += test_data_buffer_pool();
+  res += test_mstream();
+#if defined AE_MSTREAM_BENCH
+  res += test_mstream_bench();
+#endif
   return res;
 }
@@ -0,0 +1,116 @@
+/*
+ * Copyright 2026 Aethernet Inc.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <unity.h>
+
+#include <utility>
+
+#include "aether/types/data_buffer_pool.h"
+
+namespace ae::test_data_buffer_pool {
+void test_AcquireCapacity() {
+  for (auto size : {0, 10, 300, 5000, 100000}) {
+    auto buffer = DataBufferPool::Acquire(static_cast<std::size_t>(size));
+    TEST_ASSERT_TRUE(buffer.empty());
+    TEST_ASSERT_GREATER_OR_EQUAL(size + DataBufferPool::kTailroom,
+                                 buffer.capacity());
+    DataBufferPool::Release(std::move(buffer));
+  }
+}
+
+void test_ExactCapacityWithoutPool() {
+  if (DataBufferPool::kPoolSize != 0) {
+    TEST_IGNORE_MESSAGE("data buffer pool is enabled");
+  }
+  // not pooled buffers are not rounded up to the size class
+  for (auto size : {0, 10, 1500, 5000}) {
+    auto buffer = DataBufferPool::Acquire(static_cast<std::size_t>(size));
+    TEST_ASSERT_EQUAL(size + DataBufferPool::kTailroom, buffer.capacity());
+    DataBufferPool::Release(std::move(buffer));
+  }
+}
+
+void test_ReleasedBufferReused() {
+  if (DataBufferPool::kPoolSize == 0) {
+    TEST_IGNORE_MESSAGE("data buffer pool is disabled");
+  }
+  auto buffer = DataBufferPool::Acquire(100);
+  buffer.resize(100, 0xAA);
+  auto const* memory = buffer.data();
+  DataBufferPool::Release(std::move(buffer));
+
+  auto reused = DataBufferPool::Acquire(50);
+  TEST_ASSERT_EQUAL_PTR(memory, reused.data());
+  TEST_ASSERT_TRUE(reused.empty());
+  DataBufferPool::Release(std::move(reused));
+
+  // the same size class is reused only
+  auto other = DataBufferPool::Acquire(2000);
+  TEST_ASSERT_TRUE(memory != other.data());
+  DataBufferPool::Release(std::move(other));
+}
+
+void test_GrownBufferMovesToBiggerClass() {
+  if (DataBufferPool::kPoolSize == 0) {
+    TEST_IGNORE_MESSAGE("data buffer pool is disabled");
+  }
+  auto buffer = DataBufferPool::Acquire(100);
+  buffer.resize(3000);
+  auto const* memory = buffer.data();
+  DataBufferPool::Release(std::move(buffer));
+
+  auto reused = DataBufferPool::Acquire(500);
+  TEST_ASSERT_EQUAL_PTR(memory, reused.data());
+  DataBufferPool::Release(std::move(reused));
+}
+
+void test_NotPooledBuffers() {
+  if (DataBufferPool::kPoolSize == 0) {
+    TEST_IGNORE_MESSAGE("data buffer pool is disabled");
+  }
+  // pooled buffers are returned in LIFO order, so not pooled buffer must not
+  // hide the one released before
+  auto pooled = DataBufferPool::Acquire(0);
+  auto const* pooled_memory = pooled.data();
+  DataBufferPool::Release(std::move(pooled));
+  auto small = DataBuffer{};
+  small.reserve(10);
+  DataBufferPool::Release(std::move(small));
+  auto acquired = DataBufferPool::Acquire(0);
+  TEST_ASSERT_EQUAL_PTR(pooled_memory, acquired.data());
+  DataBufferPool::Release(std::move(acquired));
+
+  static constexpr auto kBiggest =
+      DataBufferPool::kSizeClasses.back() - DataBufferPool::kTailroom;
+  pooled = DataBufferPool::Acquire(kBiggest);
+  pooled_memory = pooled.data();
+  DataBufferPool::Release(std::move(pooled));
+  DataBufferPool::Release(DataBufferPool::Acquire(100000));
+  acquired = DataBufferPool::Acquire(kBiggest);
+  TEST_ASSERT_EQUAL_PTR(pooled_memory, acquired.data());
+  DataBufferPool::Release(std::move(acquired));
+}
+}  // namespace ae::test_data_buffer_pool
+
+int test_data_buffer_pool() {
+  UNITY_BEGIN();
+  RUN_TEST(ae::test_data_buffer_pool::test_AcquireCapacity);
+  RUN_TEST(ae::test_data_buffer_pool::test_ExactCapacityWithoutPool);
+  RUN_TEST(ae::test_data_buffer_pool::test_ReleasedBufferReused);
+  RUN_TEST(ae::test_data_buffer_pool::test_GrownBufferMovesToBiggerClass);
+  RUN_TEST(ae::test_data_buffer_pool::test_NotPooledBuffers);
+  return UNITY_END();
+}
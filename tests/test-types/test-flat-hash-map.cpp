@@ -0,0 +1,102 @@
+/*
+ * Copyright 2026 Aethernet Inc.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <unity.h>
+
+#include <map>
+#include <random>
+#include <string>
+#include <cstdint>
+
+#include "aether/types/flat_hash_map.h"
+
+namespace ae::test_flat_hash_map {
+void test_FlatHashMapInsertFindErase() {
+  auto map = FlatHashMap<std::uint32_t, std::string>{};
+  TEST_ASSERT_TRUE(map.empty());
+  TEST_ASSERT_NULL(map.Find(1));
+
+  auto [value, inserted] = map.Insert(1);
+  TEST_ASSERT_TRUE(inserted);
+  *value = "one";
+  map[2] = "two";
+  TEST_ASSERT_FALSE(map.Insert(1).second);
+  TEST_ASSERT_EQUAL(2, map.size());
+  TEST_ASSERT_EQUAL_STRING("one", map.Find(1)->c_str());
+  TEST_ASSERT_EQUAL_STRING("two", map[2].c_str());
+
+  TEST_ASSERT_TRUE(map.Erase(1));
+  TEST_ASSERT_FALSE(map.Erase(1));
+  TEST_ASSERT_NULL(map.Find(1));
+  TEST_ASSERT_TRUE(map.Contains(2));
+  TEST_ASSERT_EQUAL(1, map.size());
+
+  map.Clear();
+  TEST_ASSERT_TRUE(map.empty());
+  TEST_ASSERT_FALSE(map.Contains(2));
+}
+
+void test_FlatHashMapMatchesStdMap() {
+  // random inserts and erases, checked against std::map
+  auto map = FlatHashMap<std::uint32_t, std::uint32_t>{};
+  auto reference = std::map<std::uint32_t, std::uint32_t>{};
+  auto random = std::mt19937{42};
+  auto key_dist = std::uniform_int_distribution<std::uint32_t>{0, 4096};
+
+  for (std::uint32_t i = 0; i < 100'000; ++i) {
+    auto key = key_dist(random);
+    if ((random() % 3) == 0) {
+      TEST_ASSERT_EQUAL(reference.erase(key) != 0, map.Erase(key));
+    } else {
+      map[key] = i;
+      reference[key] = i;
+    }
+  }
+  TEST_ASSERT_EQUAL(reference.size(), map.size());
+  for (auto const& [key, value] : reference) {
+    auto const* found = map.Find(key);
+    TEST_ASSERT_NOT_NULL(found);
+    TEST_ASSERT_EQUAL(value, *found);
+  }
+  std::size_t count = 0;
+  map.ForEach([&](auto key, auto value) {
+    TEST_ASSERT_EQUAL(reference[key], value);
+    ++count;
+  });
+  TEST_ASSERT_EQUAL(reference.size(), count);
+}
+
+void test_FlatHashSet() {
+  auto set = FlatHashSet<std::uint64_t>{};
+  set.Reserve(1000);
+  for (std::uint64_t i = 0; i < 1000; ++i) {
+    TEST_ASSERT_TRUE(set.Insert(i << 32));
+  }
+  for (std::uint64_t i = 0; i < 1000; ++i) {
+    TEST_ASSERT_FALSE(set.Insert(i << 32));
+    TEST_ASSERT_FALSE(set.Contains((i << 32) + 1));
+  }
+  TEST_ASSERT_EQUAL(1000, set.size());
+}
+}  // namespace ae::test_flat_hash_map
+
+int test_flat_hash_map() {
+  UNITY_BEGIN();
+  RUN_TEST(ae::test_flat_hash_map::test_FlatHashMapInsertFindErase);
+  RUN_TEST(ae::test_flat_hash_map::test_FlatHashMapMatchesStdMap);
+  RUN_TEST(ae::test_flat_hash_map::test_FlatHashSet);
+  return UNITY_END();
+}
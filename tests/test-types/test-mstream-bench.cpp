@@ -0,0 +1,146 @@
+/*
+ * Copyright 2026 Aethernet Inc.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <unity.h>
+
+#include <vector>
+#include <cstdint>
+
+#include "aether/mstream.h"
+#include "aether/mstream_buffers.h"
+#include "aether/types/uid.h"
+#include "aether/work_cloud_api/ae_message.h"
+
+#include "tests/benchmarking.h"
+
+#if defined AE_MSTREAM_BENCH
+namespace ae::test_mstream_bench {
+static constexpr std::size_t kBenchCount = 10'000;
+static constexpr std::size_t kElements = 1000;
+
+std::vector<Uid> MakeUids() {
+  auto uids = std::vector<Uid>(kElements);
+  for (std::size_t i = 0; i < uids.size(); ++i) {
+    uids[i].value[0] = static_cast<std::uint8_t>(i);
+    uids[i].value[15] = static_cast<std::uint8_t>(i >> 8);
+  }
+  return uids;
+}
+
+void test_VectorUidBench() {
+  auto uids = MakeUids();
+  std::vector<std::uint8_t> buffer;
+  buffer.reserve((kElements * Uid::kSize) + 4);
+
+  tests::BenchmarkFunc(
+      [&](auto) {
+        buffer.clear();
+        auto writer = VectorWriter<std::uint32_t>{buffer};
+        auto os = omstream{writer};
+        os << static_cast<std::uint32_t>(uids.size());
+        for (auto const& uid : uids) {
+          os << uid;
+        }
+      },
+      kBenchCount, "write std::vector<Uid> element by element, size ",
+      kElements);
+
+  tests::BenchmarkFunc(
+      [&](auto) {
+        buffer.clear();
+        auto writer = VectorWriter<std::uint32_t>{buffer};
+        auto os = omstream{writer};
+        os << uids;
+      },
+      kBenchCount, "write std::vector<Uid> by bulk copy, size ", kElements);
+
+  auto read_uids = std::vector<Uid>{};
+  tests::BenchmarkFunc(
+      [&](auto) {
+        auto reader = VectorReader<std::uint32_t>{buffer};
+        auto is = imstream{reader};
+        std::uint32_t size{};
+        is >> size;
+        read_uids.resize(size);
+        for (auto& uid : read_uids) {
+          is >> uid;
+        }
+      },
+      kBenchCount, "read std::vector<Uid> element by element, size ",
+      kElements);
+
+  tests::BenchmarkFunc(
+      [&](auto) {
+        auto reader = VectorReader<std::uint32_t>{buffer};
+        auto is = imstream{reader};
+        is >> read_uids;
+      },
+      kBenchCount, "read std::vector<Uid> by bulk copy, size ", kElements);
+  TEST_ASSERT_TRUE(read_uids == uids);
+}
+
+void test_VectorAeMessageBench() {
+  auto uids = MakeUids();
+  auto messages = std::vector<AeMessage>{};
+  for (auto const& uid : uids) {
+    messages.push_back(AeMessage{uid, DataBuffer(100, 0x42)});
+  }
+  std::vector<std::uint8_t> buffer;
+
+  tests::BenchmarkFunc(
+      [&](auto) {
+        buffer.clear();
+        auto writer = VectorWriter<std::uint32_t>{buffer};
+        auto os = omstream{writer};
+        os << messages;
+      },
+      kBenchCount / 10, "write std::vector<AeMessage>, size ", kElements);
+
+  auto read_messages = std::vector<AeMessage>{};
+  tests::BenchmarkFunc(
+      [&](auto) {
+        auto reader = VectorReader<std::uint32_t>{buffer};
+        auto is = imstream{reader};
+        is >> read_messages;
+      },
+      kBenchCount / 10, "read std::vector<AeMessage>, size ", kElements);
+  TEST_ASSERT_EQUAL(messages.size(), read_messages.size());
+
+  auto views = std::vector<AeMessageView>{};
+  tests::BenchmarkFunc(
+      [&](auto) {
+        auto reader =
+            SpanReader<std::uint32_t>{
+                Span<std::uint8_t const>{buffer.data(), buffer.size()}};
+        auto is = imstream{reader};
+        is >> views;
+      },
+      kBenchCount / 10, "read std::vector<AeMessageView> in place, size ",
+      kElements);
+  TEST_ASSERT_EQUAL(messages.size(), views.size());
+}
+
+}  // namespace ae::test_mstream_bench
+#endif
+
+int test_mstream_bench() {
+  UNITY_BEGIN();
+#if defined AE_MSTREAM_BENCH
+  RUN_TEST(ae::test_mstream_bench::test_VectorUidBench);
+  RUN_TEST(ae::test_mstream_bench::test_VectorAeMessageBench);
+#endif
+  return UNITY_END();
+}
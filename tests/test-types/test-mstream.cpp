@@ -0,0 +1,128 @@
+/*
+ * Copyright 2026 Aethernet Inc.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <unity.h>
+
+#include <array>
+#include <string>
+#include <vector>
+#include <cstdint>
+
+#include "aether/mstream.h"
+#include "aether/mstream_buffers.h"
+#include "aether/types/uid.h"
+#include "aether/types/server_id.h"
+
+namespace ae::test_mstream {
+static_assert(IsBulkSerializable<std::uint32_t>::value);
+static_assert(IsBulkSerializable<ServerId>::value);
+static_assert(IsBulkSerializable<Uid>::value);
+static_assert(IsBulkSerializable<std::array<std::int16_t, 3>>::value);
+static_assert(!IsBulkSerializable<bool>::value);
+static_assert(!IsBulkSerializable<std::string>::value);
+
+static constexpr auto kUid =
+    Uid::FromString("f81d4fae-7dec-11d0-a765-00a0c91e6bf6");
+
+void test_BulkVectorSameAsElementwise() {
+  auto uids = std::vector<Uid>{};
+  for (std::uint8_t i = 0; i < 10; ++i) {
+    auto uid = kUid;
+    uid.value[0] = i;
+    uids.push_back(uid);
+  }
+  auto arrays = std::vector<std::array<std::int16_t, 3>>{
+      {1, -2, 3}, {-4, 5, -6}, {7, -8, 9}};
+
+  std::vector<std::uint8_t> bulk;
+  {
+    auto writer = VectorWriter<std::uint32_t>{bulk};
+    auto os = omstream{writer};
+    os << uids << arrays;
+  }
+
+  std::vector<std::uint8_t> elementwise;
+  {
+    auto writer = VectorWriter<std::uint32_t>{elementwise};
+    auto os = omstream{writer};
+    os << static_cast<std::uint32_t>(uids.size());
+    for (auto const& uid : uids) {
+      os << uid;
+    }
+    os << static_cast<std::uint32_t>(arrays.size());
+    for (auto const& array : arrays) {
+      for (auto v : array) {
+        os << v;
+      }
+    }
+  }
+  TEST_ASSERT_TRUE(bulk == elementwise);
+
+  auto read_uids = std::vector<Uid>{};
+  auto read_arrays = std::vector<std::array<std::int16_t, 3>>{};
+  auto reader = VectorReader<std::uint32_t>{bulk};
+  auto is = imstream{reader};
+  is >> read_uids >> read_arrays;
+  TEST_ASSERT_TRUE(is.result() == ReadResult::kYes);
+  TEST_ASSERT_TRUE(read_uids == uids);
+  TEST_ASSERT_TRUE(read_arrays == arrays);
+}
+
+void test_BoundedReadRejectsBigSize() {
+  // size claims much more than the data has
+  std::vector<std::uint8_t> data;
+  {
+    auto writer = VectorWriter<std::uint32_t>{data};
+    auto os = omstream{writer};
+    os << std::uint32_t{0xFFFFFFF0} << kUid << std::uint8_t{1};
+  }
+
+  {
+    auto uids = std::vector<Uid>{};
+    auto reader = VectorReader<std::uint32_t>{data};
+    auto is = imstream{reader};
+    is >> uids;
+    TEST_ASSERT_TRUE(is.result() == ReadResult::kNo);
+    TEST_ASSERT_TRUE(uids.empty());
+  }
+  {
+    auto str = std::string{};
+    auto reader = SpanReader<std::uint32_t>{
+        Span<std::uint8_t const>{data.data(), data.size()}};
+    auto is = imstream{reader};
+    is >> str;
+    TEST_ASSERT_TRUE(is.result() == ReadResult::kNo);
+    TEST_ASSERT_TRUE(str.empty());
+  }
+  {
+    // elements are read one by one with capacity limited by the input
+    auto strings = std::vector<std::string>{};
+    auto reader = VectorReader<std::uint32_t>{data};
+    auto is = imstream{reader};
+    is >> strings;
+    TEST_ASSERT_TRUE(is.result() == ReadResult::kNo);
+    TEST_ASSERT_LESS_OR_EQUAL(data.size(), strings.capacity());
+  }
+}
+
+}  // namespace ae::test_mstream
+
+int test_mstream() {
+  UNITY_BEGIN();
+  RUN_TEST(ae::test_mstream::test_BulkVectorSameAsElementwise);
+  RUN_TEST(ae::test_mstream::test_BoundedReadRejectsBigSize);
+  return UNITY_END();
+}